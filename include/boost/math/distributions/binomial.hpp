@@ -84,6 +84,7 @@
 #include <boost/math/distributions/complement.hpp> // complements
 #include <boost/math/distributions/detail/common_error_handling.hpp> // error checks
 #include <boost/math/distributions/detail/inv_discrete_quantile.hpp> // error checks
+#include <boost/math/distributions/detail/discrete_range.hpp> // pdf_range and cdf_range
 #include <boost/math/special_functions/fpclassify.hpp> // isnan.
 #include <boost/math/tools/roots.hpp> // for root finding.
 
@@ -715,6 +716,73 @@ namespace boost
          return (1 - 6 * p * q) / (n * p * q);
       }
 
+      namespace binomial_detail
+      {
+        template <class T>
+        struct pdf_ratio
+        { // pdf(k + 1) / pdf(k) = (n - k) p / ((k + 1) (1 - p))
+          pdf_ratio(T n, T p) : m_n(n), m_odds(p / (1 - p)) {}
+          T operator()(T k)const
+          {
+            return (m_n - k) * m_odds / (k + 1);
+          }
+          T m_n, m_odds;
+        };
+
+        template <class RealType, class Policy, class OutputIterator>
+        OutputIterator range_imp(const binomial_distribution<RealType, Policy>& dist, RealType k0, RealType k1,
+          bool cumulative, bool invert, const char* function, OutputIterator out)
+        {
+          BOOST_MATH_STD_USING
+          typedef typename policies::evaluation<RealType, Policy>::type value_type;
+          typedef typename policies::normalise<
+            Policy,
+            policies::promote_float<false>,
+            policies::promote_double<false>,
+            policies::discrete_quantile<>,
+            policies::assert_undefined<> >::type forwarding_policy;
+
+          RealType n = dist.trials();
+          RealType p = dist.success_fraction();
+          RealType result = 0;
+          if(!check_dist_and_k(function, n, p, k0, &result, Policy())
+            || !check_dist_and_k(function, n, p, k1, &result, Policy())
+            || !detail::check_discrete_range(function, k0, k1, &result, Policy()))
+          {
+            return out;
+          }
+          return detail::discrete_range<value_type, forwarding_policy>(dist, value_type(k0), value_type(k1),
+            value_type(floor(p * (n + 1))), pdf_ratio<value_type>(n, p), cumulative, invert, function, out);
+        }
+      } // namespace binomial_detail
+
+      // pdf and cdf at every k in [k0, k1], written to out:
+      template <class RealType, class Policy, class OutputIterator>
+      inline OutputIterator pdf_range(const binomial_distribution<RealType, Policy>& dist,
+        const typename binomial_distribution<RealType, Policy>::value_type& k0,
+        const typename binomial_distribution<RealType, Policy>::value_type& k1, OutputIterator out)
+      {
+        return binomial_detail::range_imp(dist, k0, k1, false, false,
+          "boost::math::pdf_range(binomial_distribution<%1%> const&, %1%, %1%)", out);
+      }
+
+      template <class RealType, class Policy, class OutputIterator>
+      inline OutputIterator cdf_range(const binomial_distribution<RealType, Policy>& dist,
+        const typename binomial_distribution<RealType, Policy>::value_type& k0,
+        const typename binomial_distribution<RealType, Policy>::value_type& k1, OutputIterator out)
+      {
+        return binomial_detail::range_imp(dist, k0, k1, true, false,
+          "boost::math::cdf_range(binomial_distribution<%1%> const&, %1%, %1%)", out);
+      }
+
+      template <class RealType, class Policy, class U, class OutputIterator>
+      inline OutputIterator cdf_range(const complemented2_type<binomial_distribution<RealType, Policy>, U>& c,
+        const typename binomial_distribution<RealType, Policy>::value_type& k1, OutputIterator out)
+      {
+        return binomial_detail::range_imp(c.dist, static_cast<RealType>(c.param), k1, true, true,
+          "boost::math::cdf_range(complement(binomial_distribution<%1%> const&, %1%), %1%)", out);
+      }
+
     } // namespace math
   } // namespace boost
 
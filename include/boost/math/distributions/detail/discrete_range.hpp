@@ -0,0 +1,186 @@
+//  Copyright 2020 Boost.Math contributors
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_DISTRIBUTIONS_DETAIL_DISCRETE_RANGE_HPP
+#define BOOST_MATH_DISTRIBUTIONS_DETAIL_DISCRETE_RANGE_HPP
+
+#include <cstddef>
+#include <vector>
+#include <boost/math/distributions/complement.hpp>
+#include <boost/math/policies/error_handling.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/tools/precision.hpp>
+
+//
+// Implementation of pdf_range and cdf_range for the discrete distributions,
+// which evaluate the pdf or cdf at every k in [k0, k1].
+//
+// Starting from the value at the mode (or the end of the range nearest to it),
+// each pdf value is obtained from its neighbour by multiplying by the ratio
+// pdf(k+1) / pdf(k), which is a rational function of k for all of these
+// distributions.  Each step adds no more than a couple of ulp to the relative
+// error, so the exact pdf is recomputed every few dozen terms, and wherever the
+// recurrence underflows.  Moving away from the mode the terms only decrease, so
+// once the exact pdf is zero the remaining terms in that direction are too.
+//
+// The cdf is then a running sum of the pdf values from the exact cdf at k0, or
+// for the complement a running sum downwards from the exact complement at k1, so
+// that every sum is of positive terms.  The sums are compensated so that their
+// rounding errors do not accumulate either.
+//
+namespace boost{ namespace math{ namespace detail{
+
+   template <class T, class Policy>
+   inline bool check_discrete_range(const char* function, const T& k0, const T& k1, T* result, const Policy& pol)
+   {
+      BOOST_MATH_STD_USING
+      if(floor(k0) != k0)
+      {
+         *result = policies::raise_domain_error<T>(
+            function, "Start of range must be an integer but got %1%", k0, pol);
+         return false;
+      }
+      if(floor(k1) != k1)
+      {
+         *result = policies::raise_domain_error<T>(
+            function, "End of range must be an integer but got %1%", k1, pol);
+         return false;
+      }
+      return true;
+   }
+
+   template <class Distribution, class T>
+   struct discrete_exact_pdf
+   {
+      discrete_exact_pdf(const Distribution& d) : dist(d) {}
+      T operator()(T k)const
+      {
+         return pdf(dist, static_cast<typename Distribution::value_type>(k));
+      }
+      const Distribution& dist;
+   };
+
+   //
+   // Fills p with pdf(k0 + i) for i in [0, n), given the ratio pdf(k + 1) / pdf(k):
+   //
+   template <class T, class Pdf, class Ratio>
+   void discrete_pdf_range_imp(T k0, std::size_t n, T mode, const Pdf& exact, const Ratio& ratio, std::vector<T>& p)
+   {
+      // Number of terms between exact evaluations:
+      const std::size_t block = 32;
+      p.resize(n);
+      if(n == 0)
+         return;
+      std::size_t anchor = 0;
+      if(mode >= k0 + T(n - 1))
+         anchor = n - 1;
+      else if(mode > k0)
+         anchor = static_cast<std::size_t>(mode - k0);
+
+      bool zero = false;
+      for(std::size_t i = anchor; i < n; ++i)
+      {
+         if(zero)
+         {
+            p[i] = 0;
+            continue;
+         }
+         T k = k0 + T(i);
+         T v = 0;
+         bool recurse = (i - anchor) % block != 0;
+         if(recurse)
+         {
+            v = p[i - 1] * ratio(T(k - 1));
+            recurse = (v >= tools::min_value<T>()) && (boost::math::isfinite)(v);
+         }
+         if(!recurse)
+         {
+            v = exact(k);
+            zero = v == 0;
+         }
+         p[i] = v;
+      }
+      zero = false;
+      for(std::size_t i = anchor; i-- > 0;)
+      {
+         if(zero)
+         {
+            p[i] = 0;
+            continue;
+         }
+         T k = k0 + T(i);
+         T v = 0;
+         bool recurse = (anchor - i) % block != 0;
+         if(recurse)
+         {
+            v = p[i + 1] / ratio(k);
+            recurse = (v >= tools::min_value<T>()) && (boost::math::isfinite)(v);
+         }
+         if(!recurse)
+         {
+            v = exact(k);
+            zero = v == 0;
+         }
+         p[i] = v;
+      }
+   }
+
+   //
+   // Replaces the pdf values in p with the cdf, given the cdf at the first point,
+   // or with the complement of the cdf given the complement at the last point:
+   //
+   template <class T>
+   void discrete_cdf_range_imp(std::vector<T>& p, T first, bool invert)
+   {
+      BOOST_MATH_STD_USING
+      std::size_t n = p.size();
+      if(n == 0)
+         return;
+      T sum = first;
+      T compensation = 0;
+      T next = invert ? p[n - 1] : p[0];
+      for(std::size_t j = 0; j < n; ++j)
+      {
+         std::size_t i = invert ? n - 1 - j : j;
+         if(j != 0)
+         {
+            // The complement at k - 1 is the complement at k plus pdf(k):
+            T term = invert ? next : p[i];
+            next = p[i];
+            T t = sum + term;
+            if(fabs(sum) >= fabs(term))
+               compensation += (sum - t) + term;
+            else
+               compensation += (term - t) + sum;
+            sum = t;
+         }
+         T v = sum + compensation;
+         p[i] = v > 1 ? T(1) : v;
+      }
+   }
+
+   template <class T, class Policy, class Distribution, class Ratio, class OutputIterator>
+   OutputIterator discrete_range(const Distribution& dist, T k0, T k1, T mode, const Ratio& ratio,
+      bool cumulative, bool invert, const char* function, OutputIterator out)
+   {
+      typedef typename Distribution::value_type RealType;
+      if(k1 < k0)
+         return out;
+      std::size_t n = static_cast<std::size_t>(k1 - k0) + 1;
+      std::vector<T> p;
+      discrete_pdf_range_imp(k0, n, mode, discrete_exact_pdf<Distribution, T>(dist), ratio, p);
+      if(cumulative)
+      {
+         T first = invert ? T(cdf(complement(dist, static_cast<RealType>(k1)))) : T(cdf(dist, static_cast<RealType>(k0)));
+         discrete_cdf_range_imp(p, first, invert);
+      }
+      for(std::size_t i = 0; i < n; ++i, ++out)
+         *out = policies::checked_narrowing_cast<RealType, Policy>(p[i], function);
+      return out;
+   }
+
+}}} // namespaces
+
+#endif // BOOST_MATH_DISTRIBUTIONS_DETAIL_DISCRETE_RANGE_HPP
@@ -14,6 +14,7 @@
 #include <boost/math/distributions/detail/hypergeometric_pdf.hpp>
 #include <boost/math/distributions/detail/hypergeometric_cdf.hpp>
 #include <boost/math/distributions/detail/hypergeometric_quantile.hpp>
+#include <boost/math/distributions/detail/discrete_range.hpp>
 #include <boost/math/special_functions/fpclassify.hpp>
 
 
@@ -283,6 +284,74 @@ namespace boost { namespace math {
    {
       return kurtosis_excess(dist) + 3;
    } // RealType kurtosis_excess(const hypergeometric_distribution<RealType, Policy>& dist)
+
+   namespace detail
+   {
+      template <class T>
+      struct hypergeometric_pdf_ratio
+      {
+         // pdf(x + 1) / pdf(x) = (r - x) (n - x) / ((x + 1) (N - n - r + x + 1)), as
+         // used by hypergeometric_cdf_imp:
+         hypergeometric_pdf_ratio(unsigned r, unsigned n, unsigned N)
+            : m_r(r), m_n(n), m_offset(T(N) - T(n) - T(r) + 1) {}
+         T operator()(T x)const
+         {
+            return (m_r - x) * (m_n - x) / ((x + 1) * (m_offset + x));
+         }
+         T m_r, m_n, m_offset;
+      };
+
+      template <class RealType, class Policy, class OutputIterator>
+      OutputIterator hypergeometric_range_imp(const hypergeometric_distribution<RealType, Policy>& dist, RealType x0, RealType x1,
+         bool cumulative, bool invert, const char* function, OutputIterator out)
+      {
+         BOOST_MATH_STD_USING
+         typedef typename policies::evaluation<RealType, Policy>::type value_type;
+         typedef typename policies::normalise<
+            Policy,
+            policies::promote_float<false>,
+            policies::promote_double<false>,
+            policies::discrete_quantile<>,
+            policies::assert_undefined<> >::type forwarding_policy;
+
+         RealType result = 0;
+         if(!dist.check_params(function, &result) || !check_discrete_range(function, x0, x1, &result, Policy()))
+            return out;
+         if(!(x0 >= 0))
+         {
+            policies::raise_domain_error<RealType>(
+               function, "Random variable out of range: must be >= 0 but got %1%", x0, Policy());
+            return out;
+         }
+         if(!dist.check_x(static_cast<unsigned>(x0), function, &result) || !dist.check_x(static_cast<unsigned>(x1), function, &result))
+            return out;
+         return discrete_range<value_type, forwarding_policy>(dist, value_type(x0), value_type(x1), value_type(mode(dist)),
+            hypergeometric_pdf_ratio<value_type>(dist.defective(), dist.sample_count(), dist.total()),
+            cumulative, invert, function, out);
+      }
+   } // namespace detail
+
+   // pdf and cdf at every x in [x0, x1], written to out:
+   template <class RealType, class Policy, class OutputIterator>
+   inline OutputIterator pdf_range(const hypergeometric_distribution<RealType, Policy>& dist, unsigned x0, unsigned x1, OutputIterator out)
+   {
+      return detail::hypergeometric_range_imp(dist, RealType(x0), RealType(x1), false, false,
+         "boost::math::pdf_range(const hypergeometric_distribution<%1%>&, const %1%&, const %1%&)", out);
+   }
+
+   template <class RealType, class Policy, class OutputIterator>
+   inline OutputIterator cdf_range(const hypergeometric_distribution<RealType, Policy>& dist, unsigned x0, unsigned x1, OutputIterator out)
+   {
+      return detail::hypergeometric_range_imp(dist, RealType(x0), RealType(x1), true, false,
+         "boost::math::cdf_range(const hypergeometric_distribution<%1%>&, const %1%&, const %1%&)", out);
+   }
+
+   template <class RealType, class Policy, class U, class OutputIterator>
+   inline OutputIterator cdf_range(const complemented2_type<hypergeometric_distribution<RealType, Policy>, U>& c, unsigned x1, OutputIterator out)
+   {
+      return detail::hypergeometric_range_imp(c.dist, static_cast<RealType>(c.param), RealType(x1), true, true,
+         "boost::math::cdf_range(complement(const hypergeometric_distribution<%1%>&, const %1%&), const %1%&)", out);
+   }
 }} // namespaces
 
 // This include must be at the end, *after* the accessors
@@ -51,6 +51,7 @@
 #include <boost/math/special_functions/fpclassify.hpp> // isnan.
 #include <boost/math/tools/roots.hpp> // for root finding.
 #include <boost/math/distributions/detail/inv_discrete_quantile.hpp>
+#include <boost/math/distributions/detail/discrete_range.hpp> // pdf_range and cdf_range
 
 #include <boost/type_traits/is_floating_point.hpp>
 #include <boost/type_traits/is_integral.hpp>
@@ -592,6 +593,75 @@ namespace boost
           max_iter);
     } // quantile complement
 
+    namespace negative_binomial_detail
+    {
+      template <class T>
+      struct pdf_ratio
+      { // pdf(k + 1) / pdf(k) = (r + k) (1 - p) / (k + 1)
+        pdf_ratio(T r, T p) : m_r(r), m_q(1 - p) {}
+        T operator()(T k)const
+        {
+          return (m_r + k) * m_q / (k + 1);
+        }
+        T m_r, m_q;
+      };
+
+      template <class RealType, class Policy, class OutputIterator>
+      OutputIterator range_imp(const negative_binomial_distribution<RealType, Policy>& dist, RealType k0, RealType k1,
+        bool cumulative, bool invert, const char* function, OutputIterator out)
+      {
+        BOOST_MATH_STD_USING
+        typedef typename policies::evaluation<RealType, Policy>::type value_type;
+        typedef typename policies::normalise<
+          Policy,
+          policies::promote_float<false>,
+          policies::promote_double<false>,
+          policies::discrete_quantile<>,
+          policies::assert_undefined<> >::type forwarding_policy;
+
+        RealType r = dist.successes();
+        RealType p = dist.success_fraction();
+        RealType result = 0;
+        if(!check_dist_and_k(function, r, p, k0, &result, Policy())
+          || !check_dist_and_k(function, r, p, k1, &result, Policy())
+          || !detail::check_discrete_range(function, k0, k1, &result, Policy()))
+        {
+          return out;
+        }
+        // The mode is zero for r <= 1, and otherwise as given by mode():
+        value_type m = r > 1 ? value_type(floor((r - 1) * (1 - p) / p)) : value_type(0);
+        return detail::discrete_range<value_type, forwarding_policy>(dist, value_type(k0), value_type(k1),
+          m, pdf_ratio<value_type>(r, p), cumulative, invert, function, out);
+      }
+    } // namespace negative_binomial_detail
+
+    // pdf and cdf at every k in [k0, k1], written to out:
+    template <class RealType, class Policy, class OutputIterator>
+    inline OutputIterator pdf_range(const negative_binomial_distribution<RealType, Policy>& dist,
+      const typename negative_binomial_distribution<RealType, Policy>::value_type& k0,
+      const typename negative_binomial_distribution<RealType, Policy>::value_type& k1, OutputIterator out)
+    {
+      return negative_binomial_detail::range_imp(dist, k0, k1, false, false,
+        "boost::math::pdf_range(const negative_binomial_distribution<%1%>&, %1%, %1%)", out);
+    }
+
+    template <class RealType, class Policy, class OutputIterator>
+    inline OutputIterator cdf_range(const negative_binomial_distribution<RealType, Policy>& dist,
+      const typename negative_binomial_distribution<RealType, Policy>::value_type& k0,
+      const typename negative_binomial_distribution<RealType, Policy>::value_type& k1, OutputIterator out)
+    {
+      return negative_binomial_detail::range_imp(dist, k0, k1, true, false,
+        "boost::math::cdf_range(const negative_binomial_distribution<%1%>&, %1%, %1%)", out);
+    }
+
+    template <class RealType, class Policy, class U, class OutputIterator>
+    inline OutputIterator cdf_range(const complemented2_type<negative_binomial_distribution<RealType, Policy>, U>& c,
+      const typename negative_binomial_distribution<RealType, Policy>::value_type& k1, OutputIterator out)
+    {
+      return negative_binomial_detail::range_imp(c.dist, static_cast<RealType>(c.param), k1, true, true,
+        "boost::math::cdf_range(complement(const negative_binomial_distribution<%1%>&, %1%), %1%)", out);
+    }
+
  } // namespace math
 } // namespace boost
 
@@ -30,8 +30,26 @@ namespace boost
 
       namespace detail{
 
+         //
+         // The terms of the series below which depend only upon the
+         // distribution parameters, kept by non_central_beta_evaluator
+         // so that they are computed once rather than for every x:
+         //
+         template <class T>
+         struct non_central_beta_cache
+         {
+            non_central_beta_cache() : have_p_poisson(false), have_q_poisson(false), p_poisson(0), q_poisson(0) {}
+            // Poisson weights at the starting points of
+            // non_central_beta_p and non_central_beta_q:
+            bool have_p_poisson, have_q_poisson;
+            T p_poisson, q_poisson;
+            // Terms of the central incomplete beta functions at the
+            // starting points, which have fixed a and b:
+            ibeta_term_cache<T> ibeta_terms;
+         };
+
          template <class T, class Policy>
-         T non_central_beta_p(T a, T b, T lam, T x, T y, const Policy& pol, T init_val = 0)
+         T non_central_beta_p(T a, T b, T lam, T x, T y, const Policy& pol, T init_val = 0, non_central_beta_cache<T>* cache = 0)
          {
             BOOST_MATH_STD_USING
                using namespace boost::math;
@@ -52,15 +70,27 @@ namespace boost
             if(k == 0)
                k = 1;
                // Starting Poisson weight:
-            T pois = gamma_p_derivative(T(k+1), l2, pol);
+            T pois;
+            if(cache && cache->have_p_poisson)
+               pois = cache->p_poisson;
+            else
+            {
+               pois = gamma_p_derivative(T(k+1), l2, pol);
+               if(cache)
+               {
+                  cache->p_poisson = pois;
+                  cache->have_p_poisson = true;
+               }
+            }
             if(pois == 0)
                return init_val;
             // recurance term:
             T xterm;
             // Starting beta term:
+            ibeta_term_cache<T>* terms = cache ? &cache->ibeta_terms : 0;
             T beta = x < y
-               ? detail::ibeta_imp(T(a + k), b, x, pol, false, true, &xterm)
-               : detail::ibeta_imp(b, T(a + k), y, pol, true, true, &xterm);
+               ? detail::ibeta_imp(T(a + k), b, x, pol, false, true, &xterm, terms)
+               : detail::ibeta_imp(b, T(a + k), y, pol, true, true, &xterm, terms);
 
             xterm *= y / (a + b + k - 1);
             T poisf(pois), betaf(beta), xtermf(xterm);
@@ -112,7 +142,7 @@ namespace boost
          }
 
          template <class T, class Policy>
-         T non_central_beta_q(T a, T b, T lam, T x, T y, const Policy& pol, T init_val = 0)
+         T non_central_beta_q(T a, T b, T lam, T x, T y, const Policy& pol, T init_val = 0, non_central_beta_cache<T>* cache = 0)
          {
             BOOST_MATH_STD_USING
                using namespace boost::math;
@@ -138,24 +168,37 @@ namespace boost
                else if(k == 0)
                   k = 1;
             }
-            if(k == 0)
+            if(cache && cache->have_q_poisson)
             {
-               // Starting Poisson weight:
-               pois = exp(-l2);
+               pois = cache->q_poisson;
             }
             else
             {
-               // Starting Poisson weight:
-               pois = gamma_p_derivative(T(k+1), l2, pol);
+               if(k == 0)
+               {
+                  // Starting Poisson weight:
+                  pois = exp(-l2);
+               }
+               else
+               {
+                  // Starting Poisson weight:
+                  pois = gamma_p_derivative(T(k+1), l2, pol);
+               }
+               if(cache)
+               {
+                  cache->q_poisson = pois;
+                  cache->have_q_poisson = true;
+               }
             }
             if(pois == 0)
                return init_val;
             // recurance term:
             T xterm;
             // Starting beta term:
+            ibeta_term_cache<T>* terms = cache ? &cache->ibeta_terms : 0;
             T beta = x < y
-               ? detail::ibeta_imp(T(a + k), b, x, pol, true, true, &xterm)
-               : detail::ibeta_imp(b, T(a + k), y, pol, false, true, &xterm);
+               ? detail::ibeta_imp(T(a + k), b, x, pol, true, true, &xterm, terms)
+               : detail::ibeta_imp(b, T(a + k), y, pol, false, true, &xterm, terms);
 
             xterm *= y / (a + b + k - 1);
             T poisf(pois), betaf(beta), xtermf(xterm);
@@ -212,7 +255,8 @@ namespace boost
          }
 
          template <class RealType, class Policy>
-         inline RealType non_central_beta_cdf(RealType x, RealType y, RealType a, RealType b, RealType l, bool invert, const Policy&)
+         inline RealType non_central_beta_cdf(RealType x, RealType y, RealType a, RealType b, RealType l, bool invert, const Policy&,
+            non_central_beta_cache<typename policies::evaluation<RealType, Policy>::type>* cache = 0)
          {
             typedef typename policies::evaluation<RealType, Policy>::type value_type;
             typedef typename policies::normalise<
@@ -243,7 +287,8 @@ namespace boost
                   static_cast<value_type>(x),
                   static_cast<value_type>(y),
                   forwarding_policy(),
-                  static_cast<value_type>(invert ? 0 : -1));
+                  static_cast<value_type>(invert ? 0 : -1),
+                  cache);
                invert = !invert;
             }
             else
@@ -255,7 +300,8 @@ namespace boost
                   static_cast<value_type>(x),
                   static_cast<value_type>(y),
                   forwarding_policy(),
-                  static_cast<value_type>(invert ? -1 : 0));
+                  static_cast<value_type>(invert ? -1 : 0),
+                  cache);
             }
             if(invert)
                result = -result;
@@ -917,6 +963,92 @@ namespace boost
          return detail::nc_beta_quantile(c.dist, c.param, true);
       } // quantile complement.
 
+      //
+      // Evaluates the cdf of one distribution at many x: the Poisson weights,
+      // and the terms of the central incomplete beta functions which do not
+      // depend upon x, are computed on first use and kept for subsequent
+      // calls.  Results are the same as cdf(dist, x) and cdf(complement(dist, x)).
+      //
+      template <class RealType = double, class Policy = policies::policy<> >
+      class non_central_beta_evaluator
+      {
+         typedef typename policies::evaluation<RealType, Policy>::type eval_type;
+      public:
+         typedef RealType value_type;
+         typedef Policy policy_type;
+
+         explicit non_central_beta_evaluator(const non_central_beta_distribution<RealType, Policy>& dist)
+            : m_dist(dist) {}
+
+         const non_central_beta_distribution<RealType, Policy>& distribution()const
+         {
+            return m_dist;
+         }
+
+         RealType cdf(const RealType& x)
+         {
+            return evaluate(x, false);
+         }
+         RealType ccdf(const RealType& x)
+         {
+            return evaluate(x, true);
+         }
+
+         template <class InputIterator, class OutputIterator>
+         OutputIterator cdf(InputIterator first, InputIterator last, OutputIterator result)
+         {
+            for(; first != last; ++first, ++result)
+               *result = evaluate(static_cast<RealType>(*first), false);
+            return result;
+         }
+         template <class InputIterator, class OutputIterator>
+         OutputIterator ccdf(InputIterator first, InputIterator last, OutputIterator result)
+         {
+            for(; first != last; ++first, ++result)
+               *result = evaluate(static_cast<RealType>(*first), true);
+            return result;
+         }
+
+      private:
+         RealType evaluate(const RealType& x, bool invert)
+         {
+            const char* function = "boost::math::non_central_beta_distribution<%1%>::cdf(%1%)";
+            RealType a = m_dist.alpha();
+            RealType b = m_dist.beta();
+            RealType l = m_dist.non_centrality();
+            RealType r;
+            if(!beta_detail::check_alpha(
+               function,
+               a, &r, Policy())
+               ||
+            !beta_detail::check_beta(
+               function,
+               b, &r, Policy())
+               ||
+            !detail::check_non_centrality(
+               function,
+               l,
+               &r,
+               Policy())
+               ||
+            !beta_detail::check_x(
+               function,
+               x,
+               &r,
+               Policy()))
+                  return (RealType)r;
+
+            if(l == 0)
+               return invert ? boost::math::cdf(complement(beta_distribution<RealType, Policy>(a, b), x))
+                  : boost::math::cdf(beta_distribution<RealType, Policy>(a, b), x);
+
+            return detail::non_central_beta_cdf(x, RealType(1 - x), a, b, l, invert, Policy(), &m_cache);
+         }
+
+         non_central_beta_distribution<RealType, Policy> m_dist;
+         detail::non_central_beta_cache<eval_type> m_cache;
+      };
+
    } // namespace math
 } // namespace boost
 
@@ -21,6 +21,7 @@
 #include <boost/math/tools/roots.hpp> // for root finding.
 #include <boost/math/distributions/detail/generic_mode.hpp>
 #include <boost/math/distributions/detail/generic_quantile.hpp>
+#include <vector>
 
 namespace boost
 {
@@ -32,8 +33,40 @@ namespace boost
 
       namespace detail{
 
+         //
+         // The terms of the series below which depend only upon the
+         // non-centrality, kept by non_central_chi_squared_evaluator so
+         // that they are computed once rather than for every x:
+         //
+         template <class T>
+         struct non_central_chi_squared_cache
+         {
+            non_central_chi_squared_cache() : have_poisson(false), poisson(0) {}
+            // Poisson weight at the starting point of
+            // non_central_chi_square_q and non_central_chi_square_p:
+            bool have_poisson;
+            T poisson;
+            // Poisson weights and their partial sums for Ding's method:
+            std::vector<T> ding_weights;
+            std::vector<T> ding_sums;
+         };
+
+         template <class T, class Policy>
+         inline T non_central_chi_square_poisson(int k, T lambda, const Policy& pol, non_central_chi_squared_cache<T>* cache)
+         {
+            if(cache && cache->have_poisson)
+               return cache->poisson;
+            T result = boost::math::gamma_p_derivative(static_cast<T>(1 + k), lambda, pol);
+            if(cache)
+            {
+               cache->poisson = result;
+               cache->have_poisson = true;
+            }
+            return result;
+         }
+
          template <class T, class Policy>
-         T non_central_chi_square_q(T x, T f, T theta, const Policy& pol, T init_sum = 0)
+         T non_central_chi_square_q(T x, T f, T theta, const Policy& pol, T init_sum = 0, non_central_chi_squared_cache<T>* cache = 0)
          {
             //
             // Computes the complement of the Non-Central Chi-Square
@@ -73,7 +106,7 @@ namespace boost
             //
             int k = iround(lambda, pol);
             // Forwards and backwards Poisson weights:
-            T poisf = boost::math::gamma_p_derivative(static_cast<T>(1 + k), lambda, pol);
+            T poisf = non_central_chi_square_poisson(k, lambda, pol, cache);
             T poisb = poisf * k / lambda;
             // Initial forwards central chi squared term:
             T gamf = boost::math::gamma_q(del + k, y, pol);
@@ -128,7 +161,7 @@ namespace boost
          }
 
          template <class T, class Policy>
-         T non_central_chi_square_p_ding(T x, T f, T theta, const Policy& pol, T init_sum = 0)
+         T non_central_chi_square_p_ding(T x, T f, T theta, const Policy& pol, T init_sum = 0, non_central_chi_squared_cache<T>* cache = 0)
          {
             //
             // This is an implementation of:
@@ -151,7 +184,12 @@ namespace boost
                return 0;
             T tk = boost::math::gamma_p_derivative(f/2 + 1, x/2, pol);
             T lambda = theta / 2;
-            T vk = exp(-lambda);
+            if(cache && cache->ding_weights.empty())
+            {
+               cache->ding_weights.push_back(exp(-lambda));
+               cache->ding_sums.push_back(cache->ding_weights[0]);
+            }
+            T vk = cache ? cache->ding_sums[0] : exp(-lambda);
             T uk = vk;
             T sum = init_sum + tk * vk;
             if(sum == 0)
@@ -165,8 +203,22 @@ namespace boost
             for(i = 1; static_cast<boost::uintmax_t>(i) < max_iter; ++i)
             {
                tk = tk * x / (f + 2 * i);
-               uk = uk * lambda / i;
-               vk = vk + uk;
+               if(cache && (static_cast<std::size_t>(i) < cache->ding_sums.size()))
+               {
+                  vk = cache->ding_sums[i];
+               }
+               else
+               {
+                  if(cache)
+                     uk = cache->ding_weights.back();
+                  uk = uk * lambda / i;
+                  vk = vk + uk;
+                  if(cache)
+                  {
+                     cache->ding_weights.push_back(uk);
+                     cache->ding_sums.push_back(vk);
+                  }
+               }
                lterm = term;
                term = vk * tk;
                sum += term;
@@ -183,7 +235,7 @@ namespace boost
 
 
          template <class T, class Policy>
-         T non_central_chi_square_p(T y, T n, T lambda, const Policy& pol, T init_sum)
+         T non_central_chi_square_p(T y, T n, T lambda, const Policy& pol, T init_sum, non_central_chi_squared_cache<T>* cache = 0)
          {
             //
             // This is taken more or less directly from:
@@ -225,7 +277,7 @@ namespace boost
             // Central chi squared term for backward iteration:
             T gamkb = gamkf;
             // Forwards Poisson weight:
-            T poiskf = gamma_p_derivative(static_cast<T>(k+1), del, pol);
+            T poiskf = non_central_chi_square_poisson(k, del, pol, cache);
             // Backwards Poisson weight:
             T poiskb = poiskf;
             // Forwards gamma function recursion term:
@@ -321,7 +373,8 @@ namespace boost
          }
 
          template <class RealType, class Policy>
-         inline RealType non_central_chi_squared_cdf(RealType x, RealType k, RealType l, bool invert, const Policy&)
+         inline RealType non_central_chi_squared_cdf(RealType x, RealType k, RealType l, bool invert, const Policy&,
+            non_central_chi_squared_cache<typename policies::evaluation<RealType, Policy>::type>* cache = 0)
          {
             typedef typename policies::evaluation<RealType, Policy>::type value_type;
             typedef typename policies::normalise<
@@ -343,7 +396,8 @@ namespace boost
                   static_cast<value_type>(k),
                   static_cast<value_type>(l),
                   forwarding_policy(),
-                  static_cast<value_type>(invert ? 0 : -1));
+                  static_cast<value_type>(invert ? 0 : -1),
+                  cache);
                invert = !invert;
             }
             else if(l < 200)
@@ -355,7 +409,8 @@ namespace boost
                   static_cast<value_type>(k),
                   static_cast<value_type>(l),
                   forwarding_policy(),
-                  static_cast<value_type>(invert ? -1 : 0));
+                  static_cast<value_type>(invert ? -1 : 0),
+                  cache);
             }
             else
             {
@@ -369,7 +424,8 @@ namespace boost
                   static_cast<value_type>(k),
                   static_cast<value_type>(l),
                   forwarding_policy(),
-                  static_cast<value_type>(invert ? -1 : 0));
+                  static_cast<value_type>(invert ? -1 : 0),
+                  cache);
             }
             if(invert)
                result = -result;
@@ -985,6 +1041,83 @@ namespace boost
          return detail::nccs_quantile(c.dist, c.param, true);
       } // quantile complement.
 
+      //
+      // Evaluates the cdf of one distribution at many x: the Poisson weights,
+      // which depend only upon the non-centrality, are computed on first use
+      // and kept for subsequent calls.  Results are the same as cdf(dist, x)
+      // and cdf(complement(dist, x)).
+      //
+      template <class RealType = double, class Policy = policies::policy<> >
+      class non_central_chi_squared_evaluator
+      {
+         typedef typename policies::evaluation<RealType, Policy>::type eval_type;
+      public:
+         typedef RealType value_type;
+         typedef Policy policy_type;
+
+         explicit non_central_chi_squared_evaluator(const non_central_chi_squared_distribution<RealType, Policy>& dist)
+            : m_dist(dist) {}
+
+         const non_central_chi_squared_distribution<RealType, Policy>& distribution()const
+         {
+            return m_dist;
+         }
+
+         RealType cdf(const RealType& x)
+         {
+            return evaluate(x, false);
+         }
+         RealType ccdf(const RealType& x)
+         {
+            return evaluate(x, true);
+         }
+
+         template <class InputIterator, class OutputIterator>
+         OutputIterator cdf(InputIterator first, InputIterator last, OutputIterator result)
+         {
+            for(; first != last; ++first, ++result)
+               *result = evaluate(static_cast<RealType>(*first), false);
+            return result;
+         }
+         template <class InputIterator, class OutputIterator>
+         OutputIterator ccdf(InputIterator first, InputIterator last, OutputIterator result)
+         {
+            for(; first != last; ++first, ++result)
+               *result = evaluate(static_cast<RealType>(*first), true);
+            return result;
+         }
+
+      private:
+         RealType evaluate(const RealType& x, bool invert)
+         {
+            const char* function = "boost::math::non_central_chi_squared_distribution<%1%>::cdf(%1%)";
+            RealType k = m_dist.degrees_of_freedom();
+            RealType l = m_dist.non_centrality();
+            RealType r;
+            if(!detail::check_df(
+               function,
+               k, &r, Policy())
+               ||
+            !detail::check_non_centrality(
+               function,
+               l,
+               &r,
+               Policy())
+               ||
+            !detail::check_positive_x(
+               function,
+               x,
+               &r,
+               Policy()))
+                  return r;
+
+            return detail::non_central_chi_squared_cdf(x, k, l, invert, Policy(), &m_cache);
+         }
+
+         non_central_chi_squared_distribution<RealType, Policy> m_dist;
+         detail::non_central_chi_squared_cache<eval_type> m_cache;
+      };
+
    } // namespace math
 } // namespace boost
 
@@ -396,6 +396,90 @@ namespace boost
          return (x / (1 - x)) * (c.dist.degrees_of_freedom2() / c.dist.degrees_of_freedom1());
       } // quantile complement.
 
+      //
+      // Evaluates the cdf of one distribution at many x, keeping the terms
+      // of the underlying noncentral beta which do not depend upon x, see
+      // non_central_beta_evaluator.  Results are the same as cdf(dist, x) and
+      // cdf(complement(dist, x)).
+      //
+      template <class RealType = double, class Policy = policies::policy<> >
+      class non_central_f_evaluator
+      {
+         typedef typename policies::evaluation<RealType, Policy>::type eval_type;
+      public:
+         typedef RealType value_type;
+         typedef Policy policy_type;
+
+         explicit non_central_f_evaluator(const non_central_f_distribution<RealType, Policy>& dist)
+            : m_dist(dist) {}
+
+         const non_central_f_distribution<RealType, Policy>& distribution()const
+         {
+            return m_dist;
+         }
+
+         RealType cdf(const RealType& x)
+         {
+            return evaluate(x, false, "cdf(const non_central_f_distribution<%1%>&, %1%)");
+         }
+         RealType ccdf(const RealType& x)
+         {
+            return evaluate(x, true, "cdf(complement(const non_central_f_distribution<%1%>&, %1%))");
+         }
+
+         template <class InputIterator, class OutputIterator>
+         OutputIterator cdf(InputIterator first, InputIterator last, OutputIterator result)
+         {
+            for(; first != last; ++first, ++result)
+               *result = this->cdf(static_cast<RealType>(*first));
+            return result;
+         }
+         template <class InputIterator, class OutputIterator>
+         OutputIterator ccdf(InputIterator first, InputIterator last, OutputIterator result)
+         {
+            for(; first != last; ++first, ++result)
+               *result = this->ccdf(static_cast<RealType>(*first));
+            return result;
+         }
+
+      private:
+         RealType evaluate(const RealType& x, bool invert, const char* function)
+         {
+            RealType r;
+            if(!detail::check_df(
+               function,
+               m_dist.degrees_of_freedom1(), &r, Policy())
+                  ||
+               !detail::check_df(
+                  function,
+                  m_dist.degrees_of_freedom2(), &r, Policy())
+                  ||
+               !detail::check_non_centrality(
+                  function,
+                  m_dist.non_centrality(),
+                  &r,
+                  Policy()))
+                  return r;
+
+            if((x < 0) || !(boost::math::isfinite)(x))
+            {
+               return policies::raise_domain_error<RealType>(
+                  function, "Random Variable parameter was %1%, but must be > 0 !", x, Policy());
+            }
+
+            RealType alpha = m_dist.degrees_of_freedom1() / 2;
+            RealType beta = m_dist.degrees_of_freedom2() / 2;
+            RealType y = x * alpha / beta;
+            RealType c = y / (1 + y);
+            RealType cp = 1 / (1 + y);
+            return detail::non_central_beta_cdf(c, cp, alpha, beta,
+               m_dist.non_centrality(), invert, Policy(), &m_cache);
+         }
+
+         non_central_f_distribution<RealType, Policy> m_dist;
+         detail::non_central_beta_cache<eval_type> m_cache;
+      };
+
    } // namespace math
 } // namespace boost
 
@@ -26,8 +26,33 @@ namespace boost
 
       namespace detail{
 
+         //
+         // The terms of the series below which depend only upon the
+         // distribution parameters, kept by non_central_t_evaluator
+         // so that they are computed once rather than for every t:
+         //
+         template <class T>
+         struct non_central_t_cache
+         {
+            non_central_t_cache() : have_p_poisson(false), have_q_poisson(false), p_poisson(0), q_poisson(0)
+            {
+               have_normal_cdf[0] = have_normal_cdf[1] = false;
+               normal_cdf[0] = normal_cdf[1] = 0;
+            }
+            // Poisson weights at the starting points of non_central_t2_p and
+            // non_central_t2_q, without the final factor of delta / sqrt(2)
+            // which changes sign when t < 0:
+            bool have_p_poisson, have_q_poisson;
+            T p_poisson, q_poisson;
+            // The standard normal cdf at -delta, for t >= 0 and t < 0:
+            bool have_normal_cdf[2];
+            T normal_cdf[2];
+            // The even terms are those of a noncentral beta:
+            non_central_beta_cache<T> beta;
+         };
+
          template <class T, class Policy>
-         T non_central_t2_p(T v, T delta, T x, T y, const Policy& pol, T init_val)
+         T non_central_t2_p(T v, T delta, T x, T y, const Policy& pol, T init_val, non_central_t_cache<T>* cache = 0)
          {
             BOOST_MATH_STD_USING
             //
@@ -47,16 +72,27 @@ namespace boost
             T pois;
             if(k == 0) k = 1;
             // Starting Poisson weight:
-            pois = gamma_p_derivative(T(k+1), d2, pol) 
-               * tgamma_delta_ratio(T(k + 1), T(0.5f))
-               * delta / constants::root_two<T>();
+            if(cache && cache->have_p_poisson)
+               pois = cache->p_poisson;
+            else
+            {
+               pois = gamma_p_derivative(T(k+1), d2, pol) 
+                  * tgamma_delta_ratio(T(k + 1), T(0.5f));
+               if(cache)
+               {
+                  cache->p_poisson = pois;
+                  cache->have_p_poisson = true;
+               }
+            }
+            pois = pois * delta / constants::root_two<T>();
             if(pois == 0)
                return init_val;
             T xterm, beta;
             // Recurrence & starting beta terms:
+            ibeta_term_cache<T>* terms = cache ? &cache->beta.ibeta_terms : 0;
             beta = x < y
-               ? detail::ibeta_imp(T(k + 1), T(v / 2), x, pol, false, true, &xterm)
-               : detail::ibeta_imp(T(v / 2), T(k + 1), y, pol, true, true, &xterm);
+               ? detail::ibeta_imp(T(k + 1), T(v / 2), x, pol, false, true, &xterm, terms)
+               : detail::ibeta_imp(T(v / 2), T(k + 1), y, pol, true, true, &xterm, terms);
             xterm *= y / (v / 2 + k);
             T poisf(pois), betaf(beta), xtermf(xterm);
             T sum = init_val;
@@ -105,7 +141,7 @@ namespace boost
          }
 
          template <class T, class Policy>
-         T non_central_t2_q(T v, T delta, T x, T y, const Policy& pol, T init_val)
+         T non_central_t2_q(T v, T delta, T x, T y, const Policy& pol, T init_val, non_central_t_cache<T>* cache = 0)
          {
             BOOST_MATH_STD_USING
             //
@@ -125,23 +161,38 @@ namespace boost
             if(k == 0) k = 1;
             // Starting Poisson weight:
             T pois;
-            if((k < (int)(max_factorial<T>::value)) && (d2 < tools::log_max_value<T>()) && (log(d2) * k < tools::log_max_value<T>()))
+            bool reduced = (k < (int)(max_factorial<T>::value)) && (d2 < tools::log_max_value<T>()) && (log(d2) * k < tools::log_max_value<T>());
+            if(cache && cache->have_q_poisson)
             {
-               //
-               // For small k we can optimise this calculation by using
-               // a simpler reduced formula:
-               //
-               pois = exp(-d2);
-               pois *= pow(d2, static_cast<T>(k));
-               pois /= boost::math::tgamma(T(k + 1 + 0.5), pol);
-               pois *= delta / constants::root_two<T>();
+               pois = cache->q_poisson;
             }
             else
             {
-               pois = gamma_p_derivative(T(k+1), d2, pol) 
-                  * tgamma_delta_ratio(T(k + 1), T(0.5f))
-                  * delta / constants::root_two<T>();
+               if(reduced)
+               {
+                  //
+                  // For small k we can optimise this calculation by using
+                  // a simpler reduced formula:
+                  //
+                  pois = exp(-d2);
+                  pois *= pow(d2, static_cast<T>(k));
+                  pois /= boost::math::tgamma(T(k + 1 + 0.5), pol);
+               }
+               else
+               {
+                  pois = gamma_p_derivative(T(k+1), d2, pol) 
+                     * tgamma_delta_ratio(T(k + 1), T(0.5f));
+               }
+               if(cache)
+               {
+                  cache->q_poisson = pois;
+                  cache->have_q_poisson = true;
+               }
             }
+            if(reduced)
+               pois *= delta / constants::root_two<T>();
+            else
+               pois = pois * delta / constants::root_two<T>();
             if(pois == 0)
                return init_val;
             // Recurance term:
@@ -150,9 +201,10 @@ namespace boost
             // Starting beta term:
             if(k != 0)
             {
+               ibeta_term_cache<T>* terms = cache ? &cache->beta.ibeta_terms : 0;
                beta = x < y 
-                  ? detail::ibeta_imp(T(k + 1), T(v / 2), x, pol, true, true, &xterm) 
-                  : detail::ibeta_imp(T(v / 2), T(k + 1), y, pol, false, true, &xterm);
+                  ? detail::ibeta_imp(T(k + 1), T(v / 2), x, pol, true, true, &xterm, terms) 
+                  : detail::ibeta_imp(T(v / 2), T(k + 1), y, pol, false, true, &xterm, terms);
 
                xterm *= y / (v / 2 + k);
             }
@@ -203,7 +255,7 @@ namespace boost
          }
 
          template <class T, class Policy>
-         T non_central_t_cdf(T v, T delta, T t, bool invert, const Policy& pol)
+         T non_central_t_cdf(T v, T delta, T t, bool invert, const Policy& pol, non_central_t_cache<T>* cache = 0)
          {
             BOOST_MATH_STD_USING
             if ((boost::math::isinf)(v))
@@ -213,6 +265,7 @@ namespace boost
             }
             //
             // Otherwise, for t < 0 we have to use the reflection formula:
+            bool reflected = t < 0;
             if(t < 0)
             {
                t = -t;
@@ -258,13 +311,24 @@ namespace boost
                //
                if(x != 0)
                {
-                  result = non_central_beta_p(a, b, d2, x, y, pol);
-                  result = non_central_t2_p(v, delta, x, y, pol, result);
+                  result = non_central_beta_p(a, b, d2, x, y, pol, T(0), cache ? &cache->beta : 0);
+                  result = non_central_t2_p(v, delta, x, y, pol, result, cache);
                   result /= 2;
                }
                else
                   result = 0;
-               result += cdf(boost::math::normal_distribution<T, Policy>(), -delta);
+               if(cache && cache->have_normal_cdf[reflected])
+                  result += cache->normal_cdf[reflected];
+               else
+               {
+                  T n = cdf(boost::math::normal_distribution<T, Policy>(), -delta);
+                  if(cache)
+                  {
+                     cache->normal_cdf[reflected] = n;
+                     cache->have_normal_cdf[reflected] = true;
+                  }
+                  result += n;
+               }
             }
             else
             {
@@ -274,8 +338,8 @@ namespace boost
                invert = !invert;
                if(x != 0)
                {
-                  result = non_central_beta_q(a, b, d2, x, y, pol);
-                  result = non_central_t2_q(v, delta, x, y, pol, result);
+                  result = non_central_beta_q(a, b, d2, x, y, pol, T(0), cache ? &cache->beta : 0);
+                  result = non_central_t2_q(v, delta, x, y, pol, result, cache);
                   result /= 2;
                }
                else // x == 0
@@ -1190,6 +1254,101 @@ namespace boost
          return detail::non_central_t_quantile(function, v, l, RealType(1-q), q, Policy());
       } // quantile complement.
 
+      //
+      // Evaluates the cdf of one distribution at many t: the Poisson weights,
+      // the terms of the central incomplete beta functions which do not depend
+      // upon t, and the normal cdf at -delta, are computed on first use and kept
+      // for subsequent calls.  Results are the same as cdf(dist, t) and
+      // cdf(complement(dist, t)).
+      //
+      template <class RealType = double, class Policy = policies::policy<> >
+      class non_central_t_evaluator
+      {
+         typedef typename policies::evaluation<RealType, Policy>::type eval_type;
+         typedef typename policies::normalise<
+            Policy, 
+            policies::promote_float<false>, 
+            policies::promote_double<false>, 
+            policies::discrete_quantile<>,
+            policies::assert_undefined<> >::type forwarding_policy;
+      public:
+         typedef RealType value_type;
+         typedef Policy policy_type;
+
+         explicit non_central_t_evaluator(const non_central_t_distribution<RealType, Policy>& dist)
+            : m_dist(dist) {}
+
+         const non_central_t_distribution<RealType, Policy>& distribution()const
+         {
+            return m_dist;
+         }
+
+         RealType cdf(const RealType& x)
+         {
+            return evaluate(x, false, "boost::math::cdf(non_central_t_distribution<%1%>&, %1%)");
+         }
+         RealType ccdf(const RealType& x)
+         {
+            return evaluate(x, true, "boost::math::cdf(const complement(non_central_t_distribution<%1%>&), %1%)");
+         }
+
+         template <class InputIterator, class OutputIterator>
+         OutputIterator cdf(InputIterator first, InputIterator last, OutputIterator result)
+         {
+            for(; first != last; ++first, ++result)
+               *result = this->cdf(static_cast<RealType>(*first));
+            return result;
+         }
+         template <class InputIterator, class OutputIterator>
+         OutputIterator ccdf(InputIterator first, InputIterator last, OutputIterator result)
+         {
+            for(; first != last; ++first, ++result)
+               *result = this->ccdf(static_cast<RealType>(*first));
+            return result;
+         }
+
+      private:
+         RealType evaluate(const RealType& x, bool invert, const char* function)
+         {
+            RealType v = m_dist.degrees_of_freedom();
+            RealType l = m_dist.non_centrality();
+            RealType r;
+            if(!detail::check_df_gt0_to_inf(
+               function,
+               v, &r, Policy())
+               ||
+            !detail::check_finite(
+               function,
+               l,
+               &r,
+               Policy())
+               ||
+            !detail::check_x(
+               function,
+               x,
+               &r,
+               Policy()))
+                  return (RealType)r;
+            if(invert && (boost::math::isinf)(v))
+               return boost::math::cdf(complement(normal_distribution<RealType, Policy>(l, 1), x));
+            if(l == 0)
+            {
+               return invert ? boost::math::cdf(complement(students_t_distribution<RealType, Policy>(v), x))
+                  : boost::math::cdf(students_t_distribution<RealType, Policy>(v), x);
+            }
+            return policies::checked_narrowing_cast<RealType, forwarding_policy>(
+               detail::non_central_t_cdf(
+                  static_cast<eval_type>(v), 
+                  static_cast<eval_type>(l), 
+                  static_cast<eval_type>(x), 
+                  invert, Policy(), &m_cache),
+               function);
+         }
+
+         non_central_t_distribution<RealType, Policy> m_dist;
+         detail::non_central_t_cache<eval_type> m_cache;
+      };
+
    } // namespace math
 } // namespace boost
 
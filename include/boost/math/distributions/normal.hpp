@@ -274,6 +274,143 @@ inline RealType quantile(const complemented2_type<normal_distribution<RealType,
    return result;
 } // quantile
 
+//
+// Range versions of pdf, cdf and quantile.  The distribution parameters are
+// validated once per range rather than once per value, and for float and double
+// the erfc and erfc_inv evaluations go through the same block kernels as the range
+// versions of those functions, see boost/math/special_functions/detail/erf_batch.hpp.
+// Arguments that need error handling (NaN's, probabilities outside (0,1)) are
+// handed on to the scalar versions above.
+//
+namespace detail{
+
+template <class RealType, class Policy>
+struct normal_pdf_batch
+{
+   typedef RealType value_type;
+   normal_pdf_batch(const normal_distribution<RealType, Policy>& d) : dist(d) {}
+   void operator()(const double* x, double* result, std::size_t n)const
+   {
+      BOOST_MATH_STD_USING
+      double mean = dist.mean();
+      double sd = dist.standard_deviation();
+      double denom = sd * sqrt(2 * constants::pi<double>());
+      for(std::size_t i = 0; i < n; ++i)
+      {
+         double exponent = x[i] - mean;
+         result[i] = -exponent * exponent / (2 * sd * sd);
+      }
+      for(std::size_t i = 0; i < n; ++i)
+         result[i] = exp(result[i]) / denom;
+      for(std::size_t i = 0; i < n; ++i)
+      {
+         if((boost::math::isnan)(x[i]))
+            result[i] = static_cast<double>(apply(static_cast<RealType>(x[i])));
+      }
+   }
+   RealType apply(const RealType& x)const { return pdf(dist, x); }
+   normal_distribution<RealType, Policy> dist;
+};
+
+template <class RealType, class Policy>
+struct normal_cdf_batch
+{
+   typedef RealType value_type;
+   normal_cdf_batch(const normal_distribution<RealType, Policy>& d) : dist(d) {}
+   void operator()(const double* x, double* result, std::size_t n)const
+   {
+      double diff[tools::detail::batch_block_size];
+      double mean = dist.mean();
+      double scale = dist.standard_deviation() * constants::root_two<double>();
+      for(std::size_t i = 0; i < n; ++i)
+         diff[i] = -((x[i] - mean) / scale);
+      erf_batch_kernel(diff, result, n, true);
+      for(std::size_t i = 0; i < n; ++i)
+         result[i] /= 2;
+      for(std::size_t i = 0; i < n; ++i)
+      {
+         if((boost::math::isnan)(x[i]))
+            result[i] = static_cast<double>(apply(static_cast<RealType>(x[i])));
+      }
+   }
+   RealType apply(const RealType& x)const { return cdf(dist, x); }
+   normal_distribution<RealType, Policy> dist;
+};
+
+template <class RealType, class Policy>
+struct normal_quantile_batch
+{
+   typedef RealType value_type;
+   normal_quantile_batch(const normal_distribution<RealType, Policy>& d) : dist(d) {}
+   void operator()(const double* p, double* result, std::size_t n)const
+   {
+      double p2[tools::detail::batch_block_size];
+      double mean = dist.mean();
+      double scale = dist.standard_deviation() * constants::root_two<double>();
+      for(std::size_t i = 0; i < n; ++i)
+         p2[i] = 2 * p[i];
+      erf_inv_batch_kernel(p2, result, n, true);
+      for(std::size_t i = 0; i < n; ++i)
+         result[i] = -result[i] * scale + mean;
+      for(std::size_t i = 0; i < n; ++i)
+      {
+         if(!((p[i] > 0) && (p[i] < 1)))
+            result[i] = static_cast<double>(apply(static_cast<RealType>(p[i])));
+      }
+   }
+   RealType apply(const RealType& p)const { return quantile(dist, p); }
+   normal_distribution<RealType, Policy> dist;
+};
+
+template <class InputIterator, class OutputIterator, class Functor>
+inline OutputIterator normal_batch_imp(InputIterator first, InputIterator last, OutputIterator out, const Functor& f, const boost::true_type&)
+{
+   return tools::detail::batch_transform<double>(first, last, out, f);
+}
+
+template <class InputIterator, class OutputIterator, class Functor>
+OutputIterator normal_batch_imp(InputIterator first, InputIterator last, OutputIterator out, const Functor& f, const boost::false_type&)
+{
+   typedef typename Functor::value_type value_type;
+   for(; first != last; ++first, ++out)
+      *out = f.apply(static_cast<value_type>(*first));
+   return out;
+}
+
+template <class RealType, class Policy, class InputIterator, class OutputIterator, class Functor>
+OutputIterator normal_batch(const char* function, const normal_distribution<RealType, Policy>& dist, InputIterator first, InputIterator last, OutputIterator out, const Functor& f)
+{
+   RealType result = 0;
+   if((false == detail::check_scale(function, dist.standard_deviation(), &result, Policy()))
+      || (false == detail::check_location(function, dist.mean(), &result, Policy())))
+   {
+      for(; first != last; ++first, ++out)
+         *out = result;
+      return out;
+   }
+   return normal_batch_imp(first, last, out, f, boost::integral_constant<bool, erf_batch_use_kernel<RealType>::value>());
+}
+
+} // namespace detail
+
+template <class RealType, class Policy, class InputIterator, class OutputIterator>
+inline OutputIterator pdf(const normal_distribution<RealType, Policy>& dist, InputIterator first, InputIterator last, OutputIterator result)
+{
+   return detail::normal_batch("boost::math::pdf(const normal_distribution<%1%>&, %1%)", dist, first, last, result, detail::normal_pdf_batch<RealType, Policy>(dist));
+}
+
+template <class RealType, class Policy, class InputIterator, class OutputIterator>
+inline OutputIterator cdf(const normal_distribution<RealType, Policy>& dist, InputIterator first, InputIterator last, OutputIterator result)
+{
+   return detail::normal_batch("boost::math::cdf(const normal_distribution<%1%>&, %1%)", dist, first, last, result, detail::normal_cdf_batch<RealType, Policy>(dist));
+}
+
+template <class RealType, class Policy, class InputIterator, class OutputIterator>
+inline OutputIterator quantile(const normal_distribution<RealType, Policy>& dist, InputIterator first, InputIterator last, OutputIterator result)
+{
+   return detail::normal_batch("boost::math::quantile(const normal_distribution<%1%>&, %1%)", dist, first, last, result, detail::normal_quantile_batch<RealType, Policy>(dist));
+}
+
 template <class RealType, class Policy>
 inline RealType mean(const normal_distribution<RealType, Policy>& dist)
 {
@@ -45,6 +45,7 @@
 #include <boost/math/special_functions/factorials.hpp> // factorials.
 #include <boost/math/tools/roots.hpp> // for root finding.
 #include <boost/math/distributions/detail/inv_discrete_quantile.hpp>
+#include <boost/math/distributions/detail/discrete_range.hpp> // pdf_range and cdf_range
 
 #include <utility>
 
@@ -512,6 +513,72 @@ namespace boost
          max_iter);
    } // quantile complement.
 
+    namespace poisson_detail
+    {
+      template <class T>
+      struct pdf_ratio
+      { // pdf(k + 1) / pdf(k) = mean / (k + 1)
+        pdf_ratio(T mean) : m_mean(mean) {}
+        T operator()(T k)const
+        {
+          return m_mean / (k + 1);
+        }
+        T m_mean;
+      };
+
+      template <class RealType, class Policy, class OutputIterator>
+      OutputIterator range_imp(const poisson_distribution<RealType, Policy>& dist, RealType k0, RealType k1,
+        bool cumulative, bool invert, const char* function, OutputIterator out)
+      {
+        BOOST_MATH_STD_USING
+        typedef typename policies::evaluation<RealType, Policy>::type value_type;
+        typedef typename policies::normalise<
+          Policy,
+          policies::promote_float<false>,
+          policies::promote_double<false>,
+          policies::discrete_quantile<>,
+          policies::assert_undefined<> >::type forwarding_policy;
+
+        RealType mean = dist.mean();
+        RealType result = 0;
+        if(!check_dist_and_k(function, mean, k0, &result, Policy())
+          || !check_dist_and_k(function, mean, k1, &result, Policy())
+          || !detail::check_discrete_range(function, k0, k1, &result, Policy()))
+        {
+          return out;
+        }
+        return detail::discrete_range<value_type, forwarding_policy>(dist, value_type(k0), value_type(k1),
+          value_type(floor(mean)), pdf_ratio<value_type>(mean), cumulative, invert, function, out);
+      }
+    } // namespace poisson_detail
+
+    // pdf and cdf at every k in [k0, k1], written to out:
+    template <class RealType, class Policy, class OutputIterator>
+    inline OutputIterator pdf_range(const poisson_distribution<RealType, Policy>& dist,
+      const typename poisson_distribution<RealType, Policy>::value_type& k0,
+      const typename poisson_distribution<RealType, Policy>::value_type& k1, OutputIterator out)
+    {
+      return poisson_detail::range_imp(dist, k0, k1, false, false,
+        "boost::math::pdf_range(const poisson_distribution<%1%>&, %1%, %1%)", out);
+    }
+
+    template <class RealType, class Policy, class OutputIterator>
+    inline OutputIterator cdf_range(const poisson_distribution<RealType, Policy>& dist,
+      const typename poisson_distribution<RealType, Policy>::value_type& k0,
+      const typename poisson_distribution<RealType, Policy>::value_type& k1, OutputIterator out)
+    {
+      return poisson_detail::range_imp(dist, k0, k1, true, false,
+        "boost::math::cdf_range(const poisson_distribution<%1%>&, %1%, %1%)", out);
+    }
+
+    template <class RealType, class Policy, class U, class OutputIterator>
+    inline OutputIterator cdf_range(const complemented2_type<poisson_distribution<RealType, Policy>, U>& c,
+      const typename poisson_distribution<RealType, Policy>::value_type& k1, OutputIterator out)
+    {
+      return poisson_detail::range_imp(c.dist, static_cast<RealType>(c.param), k1, true, true,
+        "boost::math::cdf_range(complement(const poisson_distribution<%1%>&, %1%), %1%)", out);
+    }
+
   } // namespace math
 } // namespace boost
 
@@ -0,0 +1,290 @@
+//  Copyright 2020 Boost.Math contributors
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_DISTRIBUTIONS_QUANTILE_GRID_HPP
+#define BOOST_MATH_DISTRIBUTIONS_QUANTILE_GRID_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <boost/math/distributions/complement.hpp>
+#include <boost/math/policies/policy.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/tools/precision.hpp>
+
+//
+// Quantiles of a continuous distribution at many probabilities at once.
+//
+// Each quantile is found by Newton iteration on the cdf (or on the complement of
+// the cdf for p > 1/2), starting from a quadratic extrapolation of the previous
+// three answers rather than from a cold initial guess, and bracketed on one side
+// by the previous answer.  The pdf at the previous iterate gives a finite
+// difference estimate of the second derivative of the cdf, which is used both to
+// add the second order term to each Newton step and to stop as soon as the error
+// predicted for that step is below the tolerance.  On a finely spaced sorted grid
+// that is normally a single cdf and pdf evaluation per point.
+//
+// Any point where the iteration fails - a step leaving the bracket, a zero pdf,
+// or no convergence within a few steps - is passed to quantile(), as are
+// probabilities outside (0, 1) so that errors are raised in the usual way.
+//
+namespace boost { namespace math {
+namespace detail {
+
+template<class Distribution>
+class quantile_grid_walker
+{
+public:
+    using value_type = typename Distribution::value_type;
+    using policy_type = typename Distribution::policy_type;
+
+    explicit quantile_grid_walker(const Distribution& dist)
+        : m_dist(dist), m_history(0), m_pdf_at(0), m_pdf(0)
+    {
+        using std::ldexp;
+        m_tolerance = ldexp(value_type(1), 1 - policies::digits<value_type, policy_type>());
+        std::pair<value_type, value_type> r = support(dist);
+        m_lower = r.first;
+        m_upper = r.second;
+    }
+
+    value_type operator()(value_type p)
+    {
+        if (!(p > 0) || !(p < 1))
+        {
+            // Errors and the end points of the support are left to the distribution:
+            m_history = 0;
+            return quantile(m_dist, p);
+        }
+        if ((m_history > 0) && (p == m_p[0]))
+        {
+            return m_q[0];
+        }
+        value_type q;
+        if ((m_history == 0) || !refine(p, q))
+        {
+            q = quantile(m_dist, p);
+        }
+        m_p[2] = m_p[1];
+        m_q[2] = m_q[1];
+        m_p[1] = m_p[0];
+        m_q[1] = m_q[0];
+        m_p[0] = p;
+        m_q[0] = q;
+        if (m_history < 3)
+        {
+            ++m_history;
+        }
+        return q;
+    }
+
+private:
+    bool refine(value_type p, value_type& result)
+    {
+        using std::abs;
+        using boost::math::isfinite;
+        const unsigned max_iterations = 8;
+        // The quantile is monotonic, so the previous answer bounds this one:
+        value_type lower = m_lower;
+        value_type upper = m_upper;
+        if (p > m_p[0])
+        {
+            lower = m_q[0];
+        }
+        else
+        {
+            upper = m_q[0];
+        }
+        // Newton divided differences in p of the previous answers:
+        value_type q = m_q[0];
+        if (m_history > 1)
+        {
+            value_type d01 = (m_q[0] - m_q[1]) / (m_p[0] - m_p[1]);
+            q += d01 * (p - m_p[0]);
+            if (m_history > 2)
+            {
+                value_type d12 = (m_q[1] - m_q[2]) / (m_p[1] - m_p[2]);
+                q += (d01 - d12) / (m_p[0] - m_p[2]) * (p - m_p[0]) * (p - m_p[1]);
+            }
+        }
+        else if (m_pdf > 0)
+        {
+            q += (p - m_p[0]) / m_pdf;
+        }
+        if (!(q > lower) || !(q < upper) || !(isfinite)(q))
+        {
+            q = m_q[0];
+        }
+        // The pdf may well be infinite at the ends of the support:
+        if (!(q > m_lower) || !(q < m_upper))
+        {
+            return false;
+        }
+        bool upper_half = p > value_type(0.5);
+        // Exact for p > 1/2:
+        value_type complement_p = 1 - p;
+        for (unsigned k = 0; k < max_iterations; ++k)
+        {
+            // residual = p - cdf(q), computed from whichever of cdf and its complement is accurate:
+            value_type residual = upper_half ? value_type(cdf(complement(m_dist, q)) - complement_p) : value_type(p - cdf(m_dist, q));
+            value_type density = pdf(m_dist, q);
+            if (!(density > 0) || !(isfinite)(density) || !(isfinite)(residual))
+            {
+                return false;
+            }
+            // Near a zero of the quantile any error in the cdf is magnified by the
+            // condition number p / (q pdf(q)), so leave such points to quantile():
+            if ((std::min)(p, complement_p) > 16 * abs(q) * density)
+            {
+                return false;
+            }
+            if (residual > 0)
+            {
+                lower = (std::max)(lower, q);
+            }
+            else if (residual < 0)
+            {
+                upper = (std::min)(upper, q);
+            }
+            else
+            {
+                m_pdf_at = q;
+                m_pdf = density;
+                result = q;
+                return true;
+            }
+            value_type delta = residual / density;
+            // Second order term from the finite difference estimate of cdf'':
+            value_type correction = 0;
+            bool have_curvature = (m_pdf > 0) && (q != m_pdf_at);
+            if (have_curvature)
+            {
+                value_type curvature = (density - m_pdf) / (q - m_pdf_at);
+                correction = -curvature * delta * delta / (2 * density);
+                // Far from the root the estimate means nothing:
+                if (!(abs(correction) <= abs(delta) / 2))
+                {
+                    correction = 0;
+                    have_curvature = false;
+                }
+            }
+            m_pdf_at = q;
+            m_pdf = density;
+            value_type next = q + delta + correction;
+            if (!(next > lower) || !(next < upper))
+            {
+                return false;
+            }
+            // A step whose second order term is negligible leaves an error of third
+            // order; the |delta| bound guards against a poor estimate of the curvature:
+            value_type limit = m_tolerance * abs(next);
+            if ((abs(delta) <= limit) || (have_curvature && (abs(correction) <= limit) && (delta * delta <= limit * abs(next))))
+            {
+                result = next;
+                return true;
+            }
+            q = next;
+        }
+        return false;
+    }
+
+    Distribution m_dist;
+    value_type m_tolerance;
+    value_type m_lower;
+    value_type m_upper;
+    // The last three probabilities and quantiles, most recent first:
+    value_type m_p[3];
+    value_type m_q[3];
+    std::size_t m_history;
+    // The most recent evaluation of the pdf, and where it was made:
+    value_type m_pdf_at;
+    value_type m_pdf;
+};
+
+}
+
+template<class Distribution, class InputIterator, class OutputIterator>
+OutputIterator quantile_grid(const Distribution& dist, InputIterator first, InputIterator last, OutputIterator out)
+{
+    detail::quantile_grid_walker<Distribution> walker(dist);
+    for (; first != last; ++first, ++out)
+    {
+        *out = walker(static_cast<typename Distribution::value_type>(*first));
+    }
+    return out;
+}
+
+// Splits the grid into tasks contiguous pieces, each of which is started by calling
+// executor(f) with f a std::function<void()>.  The object returned by the executor
+// must have a get() member which waits for f to complete, and rethrows anything
+// thrown by f, as std::future<void> does.
+template<class Distribution, class RandomAccessIterator1, class RandomAccessIterator2, class Executor>
+RandomAccessIterator2 quantile_grid(const Distribution& dist, RandomAccessIterator1 first, RandomAccessIterator1 last, RandomAccessIterator2 out,
+                                    std::size_t tasks, Executor executor)
+{
+    // The first point of each piece costs a full call to quantile:
+    const std::size_t min_task_size = 64;
+    std::size_t n = static_cast<std::size_t>(std::distance(first, last));
+    tasks = (std::min)(tasks, n / min_task_size);
+    if (tasks <= 1)
+    {
+        return quantile_grid(dist, first, last, out);
+    }
+    using future_type = decltype(executor(std::function<void()>()));
+    std::vector<future_type> futures;
+    futures.reserve(tasks);
+    for (std::size_t t = 0; t < tasks; ++t)
+    {
+        std::size_t begin = n * t / tasks;
+        std::size_t end = n * (t + 1) / tasks;
+        futures.push_back(executor(std::function<void()>([&dist, first, out, begin, end]() {
+            quantile_grid(dist, first + begin, first + end, out + begin);
+        })));
+    }
+    // Every task must finish before returning, even if an earlier one threw:
+    std::exception_ptr error;
+    for (auto& f : futures)
+    {
+        try
+        {
+            f.get();
+        }
+        catch (...)
+        {
+            if (!error)
+            {
+                error = std::current_exception();
+            }
+        }
+    }
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+    return out + n;
+}
+
+// As above using threads threads, or std::thread::hardware_concurrency() if threads is zero:
+template<class Distribution, class RandomAccessIterator1, class RandomAccessIterator2>
+RandomAccessIterator2 quantile_grid(const Distribution& dist, RandomAccessIterator1 first, RandomAccessIterator1 last, RandomAccessIterator2 out,
+                                    unsigned threads)
+{
+    if (threads == 0)
+    {
+        threads = (std::max)(std::thread::hardware_concurrency(), 1u);
+    }
+    return quantile_grid(dist, first, last, out, threads, [](std::function<void()> f) {
+        return std::async(std::launch::async, std::move(f));
+    });
+}
+
+}}
+#endif
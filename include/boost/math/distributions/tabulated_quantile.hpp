@@ -0,0 +1,265 @@
+//  Copyright 2020 Boost.Math contributors
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_DISTRIBUTIONS_TABULATED_QUANTILE_HPP
+#define BOOST_MATH_DISTRIBUTIONS_TABULATED_QUANTILE_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/distributions/complement.hpp>
+#include <boost/math/policies/error_handling.hpp>
+#include <boost/math/special_functions/chebyshev.hpp>
+#include <boost/math/tools/precision.hpp>
+
+//
+// A piecewise Chebyshev approximation to the quantile of a continuous distribution
+// with fixed parameters, for inverse transform sampling and the like.
+//
+// The probabilities in (0, 1/2) are split into the dyadic bands [2^-(k+1), 2^-k],
+// and those in [1/2, 1) into the same bands of 1-p, which are exactly representable
+// for p >= 1/2.  Within a band the quantile of a distribution with a power law or
+// exponential tail looks much the same at every scale, so each band is divided into
+// 2^m equal pieces with m chosen per band, and on each piece the quantile is
+// interpolated at Chebyshev nodes.  Finding the piece is then a frexp and a
+// multiplication, with no search.
+//
+// Each fit is checked against the exact quantile half way between the nodes and at
+// the ends of the piece, and the largest error found is reported by
+// max_relative_error().  On pieces where the quantile changes sign, the error is
+// measured relative to the largest magnitude of the quantile on the piece instead.
+//
+namespace boost { namespace math {
+
+template<class Distribution>
+class tabulated_quantile
+{
+public:
+    using value_type = typename Distribution::value_type;
+    using policy_type = typename Distribution::policy_type;
+
+    // Number of Chebyshev coefficients in each piece:
+    static constexpr std::size_t order = 16;
+
+    tabulated_quantile(const Distribution& dist,
+                       value_type tolerance = 256*std::numeric_limits<value_type>::epsilon(),
+                       value_type min_probability = value_type(1)/value_type(4294967296uLL))
+        : m_dist(dist), m_lower_limit(1), m_upper_limit(1), m_max_error(0)
+    {
+        static const char* function = "boost::math::tabulated_quantile<%1%>::tabulated_quantile";
+        using std::ldexp;
+        using std::abs;
+        if (!(tolerance > 0))
+        {
+            policies::raise_domain_error<value_type>(function, "The tolerance must be > 0, but got %1%.", tolerance, policy_type());
+            return;
+        }
+        if (!(min_probability > 0) || !(min_probability <= value_type(0.25)))
+        {
+            policies::raise_domain_error<value_type>(function, "The minimum probability must be in (0, 1/4], but got %1%.", min_probability, policy_type());
+            return;
+        }
+        std::size_t bands = 1;
+        while (ldexp(value_type(1), -static_cast<int>(bands + 2)) >= min_probability)
+        {
+            ++bands;
+        }
+        // Each side stops early if the quantile underflows, since there only an
+        // absolute error is achievable:
+        for (std::size_t k = 1; k <= bands; ++k)
+        {
+            if ((k > 1) && (abs(exact(ldexp(value_type(1), -static_cast<int>(k + 1)), false)) < tools::min_value<value_type>()))
+            {
+                break;
+            }
+            m_lower.push_back(build_band(k, false, tolerance, function));
+        }
+        for (std::size_t k = 1; k <= bands; ++k)
+        {
+            if ((k > 1) && (abs(exact(ldexp(value_type(1), -static_cast<int>(k + 1)), true)) < tools::min_value<value_type>()))
+            {
+                break;
+            }
+            m_upper.push_back(build_band(k, true, tolerance, function));
+        }
+        m_lower_limit = ldexp(value_type(1), -static_cast<int>(m_lower.size() + 1));
+        m_upper_limit = ldexp(value_type(1), -static_cast<int>(m_upper.size() + 1));
+    }
+
+    value_type operator()(value_type p) const
+    {
+        // The tails, and any errors, are handled by the distribution.  For p >= 1/2
+        // 1 - p is exact, and any p < 1/2 passes the second test:
+        value_type complement_p = 1 - p;
+        if (!(p >= m_lower_limit) || !(complement_p >= m_upper_limit))
+        {
+            return quantile(m_dist, p);
+        }
+        using std::frexp;
+        bool upper = p >= value_type(0.5);
+        value_type s = upper ? complement_p : p;
+        int e;
+        frexp(s, &e);
+        std::size_t k = e < 0 ? static_cast<std::size_t>(-e) : 1;
+        const band& b = upper ? m_upper[k - 1] : m_lower[k - 1];
+        std::size_t j = static_cast<std::size_t>((s - b.lower) / b.width);
+        if (j >= b.pieces)
+        {
+            j = b.pieces - 1;
+        }
+        value_type a = b.lower + j*b.width;
+        return detail::unchecked_chebyshev_clenshaw_recurrence(&m_coefficients[(b.first + j)*order], order, a, value_type(a + b.width), s);
+    }
+
+    const Distribution& distribution() const
+    {
+        return m_dist;
+    }
+
+    // Probabilities p with p < lower_limit() or 1 - p < upper_limit() are passed to quantile(distribution(), p):
+    value_type lower_limit() const
+    {
+        return m_lower_limit;
+    }
+
+    value_type upper_limit() const
+    {
+        return m_upper_limit;
+    }
+
+    value_type max_relative_error() const
+    {
+        return m_max_error;
+    }
+
+    std::size_t pieces() const
+    {
+        return m_coefficients.size()/order;
+    }
+
+private:
+    struct band
+    {
+        value_type lower;
+        value_type width;
+        std::size_t first;
+        std::size_t pieces;
+    };
+
+    // The quantile at p = s, or at p = 1 - s for the upper bands:
+    value_type exact(value_type s, bool upper) const
+    {
+        return upper ? quantile(complement(m_dist, s)) : quantile(m_dist, s);
+    }
+
+    band build_band(std::size_t k, bool upper, value_type tolerance, const char* function)
+    {
+        using std::ldexp;
+        using std::cos;
+        using std::abs;
+        using boost::math::constants::pi;
+        const std::size_t max_doublings = 12;
+
+        band b;
+        b.lower = ldexp(value_type(1), -static_cast<int>(k + 1));
+        b.first = m_coefficients.size()/order;
+
+        std::vector<value_type> f(order);
+        std::vector<value_type> s(order + 1);
+        std::vector<value_type> g(order + 1);
+        std::vector<value_type> c;
+        value_type band_error = 0;
+        for (std::size_t m = 0; m <= max_doublings; ++m)
+        {
+            b.pieces = std::size_t(1) << m;
+            b.width = ldexp(b.lower, -static_cast<int>(m));
+            c.assign(b.pieces*order, value_type(0));
+            band_error = 0;
+            for (std::size_t j = 0; j < b.pieces; ++j)
+            {
+                value_type a = b.lower + j*b.width;
+                value_type half_width = b.width/2;
+                value_type mid = a + half_width;
+                value_type lowest = (std::numeric_limits<value_type>::max)();
+                value_type highest = -lowest;
+                for (std::size_t i = 0; i < order; ++i)
+                {
+                    f[i] = exact(value_type(mid + half_width*cos(pi<value_type>()*(i + value_type(0.5))/order)), upper);
+                    lowest = (std::min)(lowest, f[i]);
+                    highest = (std::max)(highest, f[i]);
+                }
+                value_type* cj = &c[j*order];
+                for (std::size_t n = 0; n < order; ++n)
+                {
+                    value_type sum = 0;
+                    for (std::size_t i = 0; i < order; ++i)
+                    {
+                        sum += f[i]*cos(pi<value_type>()*n*(i + value_type(0.5))/order);
+                    }
+                    cj[n] = 2*sum/order;
+                }
+                // Check half way between the nodes, including both ends of the piece:
+                for (std::size_t i = 0; i <= order; ++i)
+                {
+                    s[i] = (i == 0) ? value_type(a + b.width) : (i == order) ? a : value_type(mid + half_width*cos(pi<value_type>()*i/order));
+                    g[i] = exact(s[i], upper);
+                    lowest = (std::min)(lowest, g[i]);
+                    highest = (std::max)(highest, g[i]);
+                }
+                // Where the quantile changes sign only an error relative to the size of the
+                // quantile on the piece is meaningful:
+                bool sign_change = !(lowest > 0) && !(highest < 0);
+                value_type scale = (std::max)(value_type(abs(lowest)), value_type(abs(highest)));
+                value_type piece_error = 0;
+                for (std::size_t i = 0; i <= order; ++i)
+                {
+                    value_type approx = detail::unchecked_chebyshev_clenshaw_recurrence(cj, order, a, value_type(a + b.width), s[i]);
+                    value_type err = abs(approx - g[i]);
+                    if (sign_change)
+                    {
+                        err = scale > 0 ? value_type(err/scale) : err;
+                    }
+                    else
+                    {
+                        err /= abs(g[i]);
+                    }
+                    piece_error = (std::max)(piece_error, err);
+                }
+                band_error = (std::max)(band_error, piece_error);
+                if (!(band_error <= tolerance) && (m < max_doublings))
+                {
+                    break;
+                }
+            }
+            if (band_error <= tolerance)
+            {
+                break;
+            }
+        }
+        if (!(band_error <= tolerance))
+        {
+            policies::raise_evaluation_error<value_type>(function, "Unable to tabulate the quantile to the requested tolerance, the error found was %1%.", band_error, policy_type());
+        }
+        m_max_error = (std::max)(m_max_error, band_error);
+        m_coefficients.insert(m_coefficients.end(), c.begin(), c.end());
+        return b;
+    }
+
+    Distribution m_dist;
+    value_type m_lower_limit;
+    value_type m_upper_limit;
+    value_type m_max_error;
+    std::vector<band> m_lower;
+    std::vector<band> m_upper;
+    std::vector<value_type> m_coefficients;
+};
+
+template<class Distribution>
+constexpr std::size_t tabulated_quantile<Distribution>::order;
+
+}}
+#endif
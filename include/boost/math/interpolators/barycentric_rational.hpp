@@ -46,6 +46,25 @@ public:
 
     Real prime(Real x) const;
 
+    // The value and derivative at x, computed in one pass over the data:
+    std::pair<Real, Real> value_and_prime(Real x) const
+    {
+        return m_imp->value_and_prime(x);
+    }
+
+    // Evaluate at every point in [first, last), several points at a time:
+    template<class InputIterator, class OutputIterator>
+    OutputIterator operator()(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        return m_imp->operator()(first, last, out);
+    }
+
+    template<class InputIterator, class OutputIterator>
+    OutputIterator prime(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        return m_imp->prime(first, last, out);
+    }
+
     std::vector<Real>&& return_x()
     {
         return m_imp->return_x();
@@ -32,13 +32,21 @@ class cardinal_cubic_b_spline
 public:
     // If you don't know the value of the derivative at the endpoints, leave them as nans and the routine will estimate them.
     // f[0] = f(a), f[length -1] = b, step_size = (b - a)/(length -1).
+    // For threads != 1, the coefficients are found by a partitioned solve on that many threads, or one per core if zero.
     template <class BidiIterator>
     cardinal_cubic_b_spline(const BidiIterator f, BidiIterator end_p, Real left_endpoint, Real step_size,
                    Real left_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
-                   Real right_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN());
+                   Real right_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
+                   unsigned threads = 1);
     cardinal_cubic_b_spline(const Real* const f, size_t length, Real left_endpoint, Real step_size,
        Real left_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
-       Real right_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN());
+       Real right_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
+       unsigned threads = 1);
+    // Builds the spline in the memory of f, which must be able to hold two more elements than the data to avoid a copy:
+    cardinal_cubic_b_spline(std::vector<Real>&& f, Real left_endpoint, Real step_size,
+       Real left_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
+       Real right_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
+       unsigned threads = 1);
 
     cardinal_cubic_b_spline() = default;
     Real operator()(Real x) const;
@@ -53,14 +61,20 @@ private:
 
 template<class Real>
 cardinal_cubic_b_spline<Real>::cardinal_cubic_b_spline(const Real* const f, size_t length, Real left_endpoint, Real step_size,
-                                     Real left_endpoint_derivative, Real right_endpoint_derivative) : m_imp(std::make_shared<detail::cardinal_cubic_b_spline_imp<Real>>(f, f + length, left_endpoint, step_size, left_endpoint_derivative, right_endpoint_derivative))
+                                     Real left_endpoint_derivative, Real right_endpoint_derivative, unsigned threads) : m_imp(std::make_shared<detail::cardinal_cubic_b_spline_imp<Real>>(f, f + length, left_endpoint, step_size, left_endpoint_derivative, right_endpoint_derivative, threads))
 {
 }
 
 template <class Real>
 template <class BidiIterator>
 cardinal_cubic_b_spline<Real>::cardinal_cubic_b_spline(BidiIterator f, BidiIterator end_p, Real left_endpoint, Real step_size,
-   Real left_endpoint_derivative, Real right_endpoint_derivative) : m_imp(std::make_shared<detail::cardinal_cubic_b_spline_imp<Real>>(f, end_p, left_endpoint, step_size, left_endpoint_derivative, right_endpoint_derivative))
+   Real left_endpoint_derivative, Real right_endpoint_derivative, unsigned threads) : m_imp(std::make_shared<detail::cardinal_cubic_b_spline_imp<Real>>(f, end_p, left_endpoint, step_size, left_endpoint_derivative, right_endpoint_derivative, threads))
+{
+}
+
+template<class Real>
+cardinal_cubic_b_spline<Real>::cardinal_cubic_b_spline(std::vector<Real>&& f, Real left_endpoint, Real step_size,
+                                     Real left_endpoint_derivative, Real right_endpoint_derivative, unsigned threads) : m_imp(std::make_shared<detail::cardinal_cubic_b_spline_imp<Real>>(std::move(f), left_endpoint, step_size, left_endpoint_derivative, right_endpoint_derivative, threads))
 {
 }
 
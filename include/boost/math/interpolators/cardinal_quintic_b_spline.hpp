@@ -8,6 +8,8 @@
 #define BOOST_MATH_INTERPOLATORS_CARDINAL_QUINTIC_B_SPLINE_HPP
 #include <memory>
 #include <limits>
+#include <utility>
+#include <vector>
 #include <boost/math/interpolators/detail/cardinal_quintic_b_spline_detail.hpp>
 
 
@@ -19,13 +21,15 @@ class cardinal_quintic_b_spline
 public:
     // If you don't know the value of the derivative at the endpoints, leave them as nans and the routine will estimate them.
     // y[0] = y(a), y[n - 1] = y(b), step_size = (b - a)/(n -1).
+    // For threads != 1, the coefficients are found by a partitioned solve on that many threads, or one per core if zero.
     cardinal_quintic_b_spline(const Real* const y,
                                 size_t n,
                                 Real t0 /* initial time, left endpoint */,
                                 Real h  /*spacing, stepsize*/,
                                 std::pair<Real, Real> left_endpoint_derivatives = {std::numeric_limits<Real>::quiet_NaN(), std::numeric_limits<Real>::quiet_NaN()},
-                                std::pair<Real, Real> right_endpoint_derivatives = {std::numeric_limits<Real>::quiet_NaN(), std::numeric_limits<Real>::quiet_NaN()})
-     : impl_(std::make_shared<detail::cardinal_quintic_b_spline_detail<Real>>(y, n, t0, h, left_endpoint_derivatives, right_endpoint_derivatives))
+                                std::pair<Real, Real> right_endpoint_derivatives = {std::numeric_limits<Real>::quiet_NaN(), std::numeric_limits<Real>::quiet_NaN()},
+                                unsigned threads = 1)
+     : impl_(std::make_shared<detail::cardinal_quintic_b_spline_detail<Real>>(y, n, t0, h, left_endpoint_derivatives, right_endpoint_derivatives, threads))
     {}
 
     // Oh the bizarre error messages if we template this on a RandomAccessContainer:
@@ -33,8 +37,19 @@ public:
                                 Real t0 /* initial time, left endpoint */,
                                 Real h  /*spacing, stepsize*/,
                                 std::pair<Real, Real> left_endpoint_derivatives = {std::numeric_limits<Real>::quiet_NaN(), std::numeric_limits<Real>::quiet_NaN()},
-                                std::pair<Real, Real> right_endpoint_derivatives = {std::numeric_limits<Real>::quiet_NaN(), std::numeric_limits<Real>::quiet_NaN()})
-     : impl_(std::make_shared<detail::cardinal_quintic_b_spline_detail<Real>>(y.data(), y.size(), t0, h, left_endpoint_derivatives, right_endpoint_derivatives))
+                                std::pair<Real, Real> right_endpoint_derivatives = {std::numeric_limits<Real>::quiet_NaN(), std::numeric_limits<Real>::quiet_NaN()},
+                                unsigned threads = 1)
+     : impl_(std::make_shared<detail::cardinal_quintic_b_spline_detail<Real>>(y.data(), y.size(), t0, h, left_endpoint_derivatives, right_endpoint_derivatives, threads))
+    {}
+
+    // Builds the spline in the memory of y, which must be able to hold four more elements than the data to avoid a copy:
+    cardinal_quintic_b_spline(std::vector<Real>&& y,
+                                Real t0 /* initial time, left endpoint */,
+                                Real h  /*spacing, stepsize*/,
+                                std::pair<Real, Real> left_endpoint_derivatives = {std::numeric_limits<Real>::quiet_NaN(), std::numeric_limits<Real>::quiet_NaN()},
+                                std::pair<Real, Real> right_endpoint_derivatives = {std::numeric_limits<Real>::quiet_NaN(), std::numeric_limits<Real>::quiet_NaN()},
+                                unsigned threads = 1)
+     : impl_(std::make_shared<detail::cardinal_quintic_b_spline_detail<Real>>(std::move(y), t0, h, left_endpoint_derivatives, right_endpoint_derivatives, threads))
     {}
 
 
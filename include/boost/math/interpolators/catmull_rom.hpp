@@ -15,6 +15,7 @@
 #include <iterator>
 #include <stdexcept>
 #include <boost/config.hpp>
+#include <boost/math/interpolators/detail/find_interval.hpp>
 
 namespace std_workaround {
 
@@ -75,14 +76,47 @@ public:
 
     Point operator()(const value_type s) const;
 
+    // As above, but starts the search for the segment containing s from hint, and leaves that segment in hint:
+    Point operator()(const value_type s, std::size_t& hint) const;
+
+    // Evaluates at each parameter in [first, last), fastest when they are sorted:
+    template<class InputIterator, class OutputIterator>
+    OutputIterator operator()(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        std::size_t hint = 0;
+        for (; first != last; ++first, ++out)
+        {
+            *out = this->operator()(*first, hint);
+        }
+        return out;
+    }
+
     Point prime(const value_type s) const;
 
+    Point prime(const value_type s, std::size_t& hint) const;
+
+    template<class InputIterator, class OutputIterator>
+    OutputIterator prime(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        std::size_t hint = 0;
+        for (; first != last; ++first, ++out)
+        {
+            *out = this->prime(*first, hint);
+        }
+        return out;
+    }
+
     RandomAccessContainer&& get_points()
     {
         return std::move(m_pnts);
     }
 
 private:
+    // Evaluation on the segment m_s[i] <= s < m_s[i+1]:
+    Point unchecked_evaluation(const value_type s, std::size_t i) const;
+
+    Point unchecked_prime(const value_type s, std::size_t i) const;
+
     RandomAccessContainer m_pnts;
     std::vector<value_type> m_s;
     value_type m_max_s;
@@ -146,15 +180,31 @@ catmull_rom<Point, RandomAccessContainer>::catmull_rom(RandomAccessContainer&& p
 template<class Point, class RandomAccessContainer >
 Point catmull_rom<Point, RandomAccessContainer>::operator()(const typename Point::value_type s) const
 {
-    using std_workaround::size;
     if (s < 0 || s > m_max_s)
     {
         throw std::domain_error("Parameter outside bounds.");
     }
     auto it = std::upper_bound(m_s.begin(), m_s.end(), s);
     //Now *it >= s. We want the index such that m_s[i] <= s < m_s[i+1]:
-    size_t i = std::distance(m_s.begin(), it - 1);
+    return unchecked_evaluation(s, std::distance(m_s.begin(), it - 1));
+}
 
+template<class Point, class RandomAccessContainer >
+Point catmull_rom<Point, RandomAccessContainer>::operator()(const typename Point::value_type s, std::size_t& hint) const
+{
+    if (s < 0 || s > m_max_s)
+    {
+        throw std::domain_error("Parameter outside bounds.");
+    }
+    // m_s extends beyond [0, m_max_s] at both ends, so s always lies strictly inside it:
+    hint = interpolators::detail::find_interval(m_s, s, hint);
+    return unchecked_evaluation(s, hint);
+}
+
+template<class Point, class RandomAccessContainer >
+Point catmull_rom<Point, RandomAccessContainer>::unchecked_evaluation(const typename Point::value_type s, std::size_t i) const
+{
+    using std_workaround::size;
     // Only denom21 is used twice:
     typename Point::value_type denom21 = 1/(m_s[i+1] - m_s[i]);
     typename Point::value_type s0s = m_s[i-1] - s;
@@ -206,16 +256,32 @@ Point catmull_rom<Point, RandomAccessContainer>::operator()(const typename Point
 template<class Point, class RandomAccessContainer >
 Point catmull_rom<Point, RandomAccessContainer>::prime(const typename Point::value_type s) const
 {
-    using std_workaround::size;
-    // https://math.stackexchange.com/questions/843595/how-can-i-calculate-the-derivative-of-a-catmull-rom-spline-with-nonuniform-param
-    // http://denkovacs.com/2016/02/catmull-rom-spline-derivatives/
     if (s < 0 || s > m_max_s)
     {
         throw std::domain_error("Parameter outside bounds.\n");
     }
     auto it = std::upper_bound(m_s.begin(), m_s.end(), s);
     //Now *it >= s. We want the index such that m_s[i] <= s < m_s[i+1]:
-    size_t i = std::distance(m_s.begin(), it - 1);
+    return unchecked_prime(s, std::distance(m_s.begin(), it - 1));
+}
+
+template<class Point, class RandomAccessContainer >
+Point catmull_rom<Point, RandomAccessContainer>::prime(const typename Point::value_type s, std::size_t& hint) const
+{
+    if (s < 0 || s > m_max_s)
+    {
+        throw std::domain_error("Parameter outside bounds.\n");
+    }
+    hint = interpolators::detail::find_interval(m_s, s, hint);
+    return unchecked_prime(s, hint);
+}
+
+template<class Point, class RandomAccessContainer >
+Point catmull_rom<Point, RandomAccessContainer>::unchecked_prime(const typename Point::value_type s, std::size_t i) const
+{
+    using std_workaround::size;
+    // https://math.stackexchange.com/questions/843595/how-can-i-calculate-the-derivative-of-a-catmull-rom-spline-with-nonuniform-param
+    // http://denkovacs.com/2016/02/catmull-rom-spline-derivatives/
     Point A1;
     typename Point::value_type denom = 1/(m_s[i] - m_s[i-1]);
     typename Point::value_type k1 = (m_s[i]-s)*denom;
@@ -26,10 +26,30 @@ public:
         return impl_->operator()(x);
     }
 
+    // Starts the search for x's interval from hint, and leaves x's interval in hint:
+    inline Real operator()(Real x, std::size_t& hint) const {
+        return impl_->operator()(x, hint);
+    }
+
+    // Evaluates at each abscissa in [first, last), fastest when they are sorted:
+    template<class InputIterator, class OutputIterator>
+    OutputIterator operator()(InputIterator first, InputIterator last, OutputIterator out) const {
+        return impl_->operator()(first, last, out);
+    }
+
     inline Real prime(Real x) const {
         return impl_->prime(x);
     }
 
+    inline Real prime(Real x, std::size_t& hint) const {
+        return impl_->prime(x, hint);
+    }
+
+    template<class InputIterator, class OutputIterator>
+    OutputIterator prime(InputIterator first, InputIterator last, OutputIterator out) const {
+        return impl_->prime(first, last, out);
+    }
+
     friend std::ostream& operator<<(std::ostream & os, const cubic_hermite & m)
     {
         os << *m.impl_;
@@ -80,6 +100,11 @@ public:
         return os;
     }
 
+    void push_back(Real y, Real dydx)
+    {
+        impl_->push_back(y, dydx);
+    }
+
     int64_t bytes() const
     {
         return impl_->bytes() + sizeof(impl_);
@@ -121,6 +146,11 @@ public:
         return os;
     }
 
+    void push_back(Real y, Real dydx)
+    {
+        impl_->push_back(y, dydx);
+    }
+
     int64_t bytes() const
     {
         return impl_->bytes() + sizeof(impl_);
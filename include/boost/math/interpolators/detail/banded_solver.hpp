@@ -0,0 +1,469 @@
+// Copyright Boost.Math contributors, 2020
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_INTERPOLATORS_DETAIL_BANDED_SOLVER_HPP
+#define BOOST_MATH_INTERPOLATORS_DETAIL_BANDED_SOLVER_HPP
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace boost {
+namespace math {
+namespace interpolators {
+namespace detail {
+
+// One block of rows [first, last) of the partitioned solve, and what the other blocks need to know about it.
+template<class Real, std::size_t k>
+struct banded_solver_block
+{
+    std::size_t first;
+    std::size_t last;
+    // L^-1 applied to the k columns coupling this block to the last k unknowns of the block above,
+    // stored only down to the row from which it underflows to zero:
+    std::vector<std::array<Real, k>> w;
+    // L^-1 applied to the k columns coupling this block to the first k unknowns of the block below,
+    // which is zero apart from the last k rows:
+    std::array<std::array<Real, k>, k> v;
+    // The first and last k rows of A_p^-1 r, A_p^-1 (coupling above) and A_p^-1 (coupling below):
+    std::array<Real, k> g_top;
+    std::array<Real, k> g_bottom;
+    std::array<std::array<Real, k>, k> w_top;
+    std::array<std::array<Real, k>, k> w_bottom;
+    std::array<std::array<Real, k>, k> v_top;
+    std::array<std::array<Real, k>, k> v_bottom;
+};
+
+// The number of blocks of at least min_block_rows rows to split n rows into for threads threads, or one per core if zero:
+inline std::size_t block_count(std::size_t n, unsigned threads, std::size_t min_block_rows)
+{
+    if (threads == 0)
+    {
+        threads = (std::max)(std::thread::hardware_concurrency(), 1u);
+    }
+    return (std::max)((std::min)(std::size_t(threads), n/min_block_rows), std::size_t(1));
+}
+
+// Calls f(p) for each p in [0, blocks), each on its own thread, and rethrows the first exception thrown:
+template<class F>
+void for_each_block(std::size_t blocks, const F& f)
+{
+    std::vector<std::future<void>> futures;
+    futures.reserve(blocks);
+    std::exception_ptr error;
+    try
+    {
+        for (std::size_t p = 1; p < blocks; ++p)
+        {
+            futures.push_back(std::async(std::launch::async, [&f, p]() { f(p); }));
+        }
+        f(0);
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+    // Every block must finish before returning, even if an earlier one threw:
+    for (auto& fut : futures)
+    {
+        try
+        {
+            fut.get();
+        }
+        catch (...)
+        {
+            if (!error)
+            {
+                error = std::current_exception();
+            }
+        }
+    }
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+// Solves the m x m system M X = B in place by Gaussian elimination with partial pivoting, leaving X in B:
+template<class Real, std::size_t m, std::size_t columns>
+void dense_solve(std::array<std::array<Real, m>, m>& M, std::array<std::array<Real, columns>, m>& B)
+{
+    using std::abs;
+    for (std::size_t j = 0; j < m; ++j)
+    {
+        std::size_t pivot = j;
+        for (std::size_t i = j + 1; i < m; ++i)
+        {
+            if (abs(M[i][j]) > abs(M[pivot][j]))
+            {
+                pivot = i;
+            }
+        }
+        std::swap(M[j], M[pivot]);
+        std::swap(B[j], B[pivot]);
+        for (std::size_t i = j + 1; i < m; ++i)
+        {
+            Real l = M[i][j]/M[j][j];
+            for (std::size_t c = j; c < m; ++c)
+            {
+                M[i][c] -= l*M[j][c];
+            }
+            for (std::size_t c = 0; c < columns; ++c)
+            {
+                B[i][c] -= l*B[j][c];
+            }
+        }
+    }
+    for (std::size_t j = m; j-- > 0;)
+    {
+        for (std::size_t c = 0; c < columns; ++c)
+        {
+            Real s = B[j][c];
+            for (std::size_t i = j + 1; i < m; ++i)
+            {
+                s -= M[j][i]*B[i][c];
+            }
+            B[j][c] = s/M[j][j];
+        }
+    }
+}
+
+// Back substitution through rows [first, last) of U X = R, for X and R with the given number of columns.
+// rhs(i) returns row i of R, and out(i, x) is called with each row of X, starting from the last,
+// until it returns false:
+template<std::size_t columns, class Real, std::size_t k, class Upper, class Rhs, class Out>
+void banded_back_substitute(std::vector<std::array<Real, k>> const & factors, const Upper& upper,
+                            std::size_t first, std::size_t last, const Rhs& rhs, const Out& out)
+{
+    // The window holds rows i + 1, ..., i + k of X:
+    std::array<std::array<Real, columns>, k> window = {};
+    for (std::size_t i = last; i-- > first;)
+    {
+        std::array<Real, columns> s = rhs(i);
+        for (std::size_t j = 1; j <= k && i + j < last; ++j)
+        {
+            Real u = upper(i, j);
+            for (std::size_t c = 0; c < columns; ++c)
+            {
+                s[c] -= u*window[j - 1][c];
+            }
+        }
+        for (std::size_t c = 0; c < columns; ++c)
+        {
+            s[c] *= factors[i][0];
+        }
+        for (std::size_t j = k - 1; j > 0; --j)
+        {
+            window[j] = window[j - 1];
+        }
+        window[0] = s;
+        if (!out(i, s))
+        {
+            return;
+        }
+    }
+}
+
+// Solves A x = r in place, where A is an n x n band matrix with k sub- and k superdiagonals, and x holds r on entry.
+// band(i) returns row i of A as a std::array<Real, 2k+1> of the entries in columns i-k, ..., i+k;
+// those which fall outside the matrix are ignored.
+//
+// The rows are split into as many as threads contiguous blocks of at least min_block_rows rows, each of which is
+// factored and solved on its own thread, as in the SPIKE algorithm of Polizzi and Sameh.  The solutions within the
+// blocks are coupled only through the k unknowns at either end of each block, which solve a small block tridiagonal
+// system, and are then used to correct the right hand side of each block before its back substitution.
+// Since the inverse of a diagonally dominant band matrix decays exponentially away from the diagonal, the columns
+// of A_p^-1 needed to set up that system underflow to zero within a few hundred rows, and are only computed that far;
+// so beyond the factorization the extra cost over the serial solve is one more back substitution through each block,
+// and the extra memory is k values per row.
+//
+// There is no pivoting, so A should be diagonally dominant, at least away from its first and last few rows.
+template<std::size_t k, class Real, class Band>
+void banded_solve(const Band& band, Real* x, std::size_t n, unsigned threads = 1, std::size_t min_block_rows = 16384)
+{
+    static_assert(k > 0, "The band matrix must have at least one sub- and superdiagonal.");
+    std::size_t blocks = block_count(n, threads, (std::max)(min_block_rows, 2*k));
+
+    // factors[i][0] is the reciprocal of the ith pivot, and factors[i][j] the entry of U in column i + j.
+    // The last superdiagonal is unchanged by the elimination, so is read from band(i):
+    std::vector<std::array<Real, k>> factors(n);
+    std::vector<banded_solver_block<Real, k>> parts(blocks);
+    for (std::size_t p = 0; p < blocks; ++p)
+    {
+        parts[p].first = n*p/blocks;
+        parts[p].last = n*(p + 1)/blocks;
+    }
+
+    auto upper = [&](std::size_t i, std::size_t j) -> Real {
+        return j < k ? factors[i][j] : band(i)[2*k];
+    };
+
+    auto is_zero = [](std::array<Real, k> const & a) -> bool {
+        for (Real t : a)
+        {
+            if (t != 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // Factors block p and does its forward substitution in place, along with that of its coupling columns:
+    auto factor = [&](std::size_t p) {
+        auto& part = parts[p];
+        std::size_t s = part.first;
+        std::size_t e = part.last;
+        bool above = p > 0;
+        bool below = p + 1 < blocks;
+        // The last k reduced rows, most recent first, with the pivot replaced by its reciprocal:
+        std::array<std::array<Real, 2*k + 1>, k> previous = {};
+        for (auto& v : part.v)
+        {
+            v.fill(Real(0));
+        }
+        bool tracking_w = above;
+        std::size_t zero_rows = 0;
+        for (std::size_t i = s; i < e; ++i)
+        {
+            std::array<Real, 2*k + 1> a = band(i);
+            std::size_t r = i - s;
+            if (tracking_w)
+            {
+                // Row r of the columns coupling to unknowns s - k, ..., s - 1:
+                std::array<Real, k> wr;
+                for (std::size_t c = 0; c < k; ++c)
+                {
+                    wr[c] = (r < k && c >= r) ? a[c - r] : Real(0);
+                }
+                part.w.push_back(wr);
+            }
+            std::size_t v_row = (below && i + k >= e) ? i + k - e : k;
+            if (v_row < k)
+            {
+                for (std::size_t c = 0; c < k; ++c)
+                {
+                    part.v[v_row][c] = c <= v_row ? a[2*k + c - v_row] : Real(0);
+                }
+            }
+            // Eliminate the subdiagonal, farthest entry first:
+            for (std::size_t j = (std::min)(k, r); j > 0; --j)
+            {
+                std::array<Real, 2*k + 1> const & u = previous[j - 1];
+                Real l = a[k - j]*u[k];
+                for (std::size_t m = 1; m <= k; ++m)
+                {
+                    a[k - j + m] -= l*u[k + m];
+                }
+                x[i] -= l*x[i - j];
+                if (tracking_w)
+                {
+                    for (std::size_t c = 0; c < k; ++c)
+                    {
+                        part.w[r][c] -= l*part.w[r - j][c];
+                    }
+                }
+                if (v_row < k && v_row >= j)
+                {
+                    for (std::size_t c = 0; c < k; ++c)
+                    {
+                        part.v[v_row][c] -= l*part.v[v_row - j][c];
+                    }
+                }
+            }
+            a[k] = 1/a[k];
+            factors[i][0] = a[k];
+            for (std::size_t j = 1; j < k; ++j)
+            {
+                factors[i][j] = a[k + j];
+            }
+            for (std::size_t j = k - 1; j > 0; --j)
+            {
+                previous[j] = previous[j - 1];
+            }
+            previous[0] = a;
+            if (tracking_w)
+            {
+                // Once k consecutive rows are zero, so are all the rest:
+                zero_rows = is_zero(part.w[r]) ? zero_rows + 1 : 0;
+                if (zero_rows == k && r >= k)
+                {
+                    tracking_w = false;
+                    part.w.resize(part.w.size() - k);
+                }
+            }
+        }
+        if (blocks == 1)
+        {
+            return;
+        }
+
+        // The ends of the block's solution, ignoring the coupling:
+        banded_back_substitute<1>(factors, upper, s, e, [&](std::size_t i) -> std::array<Real, 1> {
+            return {{x[i]}};
+        }, [&](std::size_t i, std::array<Real, 1> const & xi) -> bool {
+            if (i + k >= e)
+            {
+                part.g_bottom[i + k - e] = xi[0];
+            }
+            if (i < s + k)
+            {
+                part.g_top[i - s] = xi[0];
+            }
+            return true;
+        });
+
+        std::array<Real, k> zero;
+        zero.fill(Real(0));
+        for (std::size_t r = 0; r < k; ++r)
+        {
+            part.w_top[r] = zero;
+            part.w_bottom[r] = zero;
+            part.v_top[r] = zero;
+            part.v_bottom[r] = zero;
+        }
+        if (below)
+        {
+            std::size_t zero_run = 0;
+            banded_back_substitute<k>(factors, upper, s, e, [&](std::size_t i) -> std::array<Real, k> {
+                return i + k >= e ? part.v[i + k - e] : zero;
+            }, [&](std::size_t i, std::array<Real, k> const & vi) -> bool {
+                if (i + k >= e)
+                {
+                    part.v_bottom[i + k - e] = vi;
+                }
+                if (i < s + k)
+                {
+                    part.v_top[i - s] = vi;
+                }
+                zero_run = is_zero(vi) ? zero_run + 1 : 0;
+                return zero_run < k || i + k >= e;
+            });
+        }
+        if (above)
+        {
+            std::size_t rows = part.w.size();
+            banded_back_substitute<k>(factors, upper, s, s + rows, [&](std::size_t i) -> std::array<Real, k> {
+                return part.w[i - s];
+            }, [&](std::size_t i, std::array<Real, k> const & wi) -> bool {
+                if (i + k >= e)
+                {
+                    part.w_bottom[i + k - e] = wi;
+                }
+                if (i < s + k)
+                {
+                    part.w_top[i - s] = wi;
+                }
+                return true;
+            });
+        }
+    };
+
+    for_each_block(blocks, factor);
+
+    // The first and last k unknowns of each block, t_p and b_p, satisfy
+    //   t_p + V_p^top t_{p+1} + W_p^top b_{p-1} = g_p^top,
+    //   b_p + V_p^bottom t_{p+1} + W_p^bottom b_{p-1} = g_p^bottom.
+    // Solve for z_p = (t_p, b_p) by block tridiagonal elimination, keeping C_p = M_p^-1 V_p and d_p = M_p^-1 g'_p:
+    std::vector<std::array<Real, 2*k>> z(blocks);
+    if (blocks > 1)
+    {
+        // Each row of reduced[p] holds C_p followed by d_p:
+        std::vector<std::array<std::array<Real, k + 1>, 2*k>> reduced(blocks);
+        for (std::size_t p = 0; p < blocks; ++p)
+        {
+            auto const & part = parts[p];
+            std::array<std::array<Real, 2*k>, 2*k> M;
+            auto& B = reduced[p];
+            for (std::size_t r = 0; r < 2*k; ++r)
+            {
+                M[r].fill(Real(0));
+                M[r][r] = 1;
+                for (std::size_t c = 0; c < k; ++c)
+                {
+                    B[r][c] = r < k ? part.v_top[r][c] : part.v_bottom[r - k][c];
+                }
+                B[r][k] = r < k ? part.g_top[r] : part.g_bottom[r - k];
+            }
+            if (p > 0)
+            {
+                // Eliminate b_{p-1} = d_{p-1} - C_{p-1} t_p, written in the last k rows of block p - 1:
+                auto const & previous = reduced[p - 1];
+                for (std::size_t r = 0; r < 2*k; ++r)
+                {
+                    for (std::size_t c = 0; c < k; ++c)
+                    {
+                        Real wrc = r < k ? part.w_top[r][c] : part.w_bottom[r - k][c];
+                        for (std::size_t j = 0; j < k; ++j)
+                        {
+                            M[r][j] -= wrc*previous[k + c][j];
+                        }
+                        B[r][k] -= wrc*previous[k + c][k];
+                    }
+                }
+            }
+            dense_solve(M, B);
+        }
+        for (std::size_t p = blocks; p-- > 0;)
+        {
+            for (std::size_t r = 0; r < 2*k; ++r)
+            {
+                Real s = reduced[p][r][k];
+                if (p + 1 < blocks)
+                {
+                    for (std::size_t c = 0; c < k; ++c)
+                    {
+                        s -= reduced[p][r][c]*z[p + 1][c];
+                    }
+                }
+                z[p][r] = s;
+            }
+        }
+    }
+
+    // Correct the right hand side of each block for its neighbours, and finish the solve:
+    for_each_block(blocks, [&](std::size_t p) {
+        auto const & part = parts[p];
+        std::size_t s = part.first;
+        std::size_t e = part.last;
+        if (p > 0)
+        {
+            for (std::size_t r = 0; r < part.w.size(); ++r)
+            {
+                for (std::size_t c = 0; c < k; ++c)
+                {
+                    x[s + r] -= part.w[r][c]*z[p - 1][k + c];
+                }
+            }
+        }
+        if (p + 1 < blocks)
+        {
+            for (std::size_t r = 0; r < k; ++r)
+            {
+                for (std::size_t c = 0; c < k; ++c)
+                {
+                    x[e - k + r] -= part.v[r][c]*z[p + 1][c];
+                }
+            }
+        }
+        banded_back_substitute<1>(factors, upper, s, e, [&](std::size_t i) -> std::array<Real, 1> {
+            return {{x[i]}};
+        }, [&](std::size_t i, std::array<Real, 1> const & xi) -> bool {
+            x[i] = xi[0];
+            return true;
+        });
+    });
+}
+
+} // namespace detail
+} // namespace interpolators
+} // namespace math
+} // namespace boost
+#endif
@@ -31,6 +31,14 @@ public:
 
     Real prime(Real x) const;
 
+    std::pair<Real, Real> value_and_prime(Real x) const;
+
+    template<class InputIterator, class OutputIterator>
+    OutputIterator operator()(InputIterator first, InputIterator last, OutputIterator out) const;
+
+    template<class InputIterator, class OutputIterator>
+    OutputIterator prime(InputIterator first, InputIterator last, OutputIterator out) const;
+
     // The barycentric weights are not really that interesting; except to the unit tests!
     Real weight(size_t i) const { return m_w[i]; }
 
@@ -48,6 +56,13 @@ private:
 
     void calculate_weights(size_t approximation_order);
 
+    size_t nearest_node(Real x) const;
+
+    Real prime_at_node(size_t i) const;
+
+    // The number of points evaluated together in each pass over the nodes by the batch evaluations:
+    static constexpr size_t block_size = 8;
+
     std::vector<Real> m_x;
     std::vector<Real> m_y;
     std::vector<Real> m_w;
@@ -179,7 +194,7 @@ Real barycentric_rational_imp<Real>::operator()(Real x) const
  * Recent developments in barycentric rational interpolation
  * Jean-Paul Berrut, Richard Baltensperger and Hans D. Mittelmann
  *
- * Is it possible to complete this in one pass through the data?
+ * value_and_prime below completes it in one pass through the data.
  */
 
 template<class Real>
@@ -192,16 +207,7 @@ Real barycentric_rational_imp<Real>::prime(Real x) const
     {
         if (x == m_x[i])
         {
-            Real sum = 0;
-            for (size_t j = 0; j < m_x.size(); ++j)
-            {
-                if (j == i)
-                {
-                    continue;
-                }
-                sum += m_w[j]*(m_y[i] - m_y[j])/(m_x[i] - m_x[j]);
-            }
-            return -sum/m_w[i];
+            return prime_at_node(i);
         }
         Real t = m_w[i]/(x - m_x[i]);
         Real diff = (rx - m_y[i])/(x-m_x[i]);
@@ -211,5 +217,173 @@ Real barycentric_rational_imp<Real>::prime(Real x) const
 
     return numerator/denominator;
 }
+
+template<class Real>
+Real barycentric_rational_imp<Real>::prime_at_node(size_t i) const
+{
+    Real sum = 0;
+    for (size_t j = 0; j < m_x.size(); ++j)
+    {
+        if (j == i)
+        {
+            continue;
+        }
+        sum += m_w[j]*(m_y[i] - m_y[j])/(m_x[i] - m_x[j]);
+    }
+    return -sum/m_w[i];
+}
+
+template<class Real>
+size_t barycentric_rational_imp<Real>::nearest_node(Real x) const
+{
+    size_t i = std::lower_bound(m_x.begin(), m_x.end(), x) - m_x.begin();
+    if (i == m_x.size())
+    {
+        return i - 1;
+    }
+    if (i > 0 && x - m_x[i-1] < m_x[i] - x)
+    {
+        return i - 1;
+    }
+    return i;
+}
+
+/*
+ * Since the interpolant reproduces constants, r - c is the barycentric interpolant of the y_i - c,
+ * whose derivative is the sum of t_i((r-c) - (y_i-c))/(x-x_i) over the sum of the t_i.
+ * This needs only sums accumulated in one pass, unlike the form above which needs r before it starts.
+ * Taking c to be the ordinate of the node nearest x removes the cancellation between the largest terms
+ * which would otherwise make the derivative inaccurate near the nodes.
+ */
+template<class Real>
+std::pair<Real, Real> barycentric_rational_imp<Real>::value_and_prime(Real x) const
+{
+    Real c = m_y[nearest_node(x)];
+    Real numerator = 0;
+    Real denominator = 0;
+    Real numerator_prime = 0;
+    Real denominator_prime = 0;
+    for(size_t i = 0; i < m_x.size(); ++i)
+    {
+        if (x == m_x[i])
+        {
+            return std::make_pair(m_y[i], prime_at_node(i));
+        }
+        Real inv_diff = 1/(x - m_x[i]);
+        Real t = m_w[i]*inv_diff;
+        Real dy = m_y[i] - c;
+        numerator += t*dy;
+        denominator += t;
+        numerator_prime += t*dy*inv_diff;
+        denominator_prime += t*inv_diff;
+    }
+    Real s = numerator/denominator;
+    return std::make_pair(c + s, (s*denominator_prime - numerator_prime)/denominator);
+}
+
+// The batch evaluations take the points block_size at a time, so that each node is loaded once per block rather than once per point,
+// and the loop over the block has no branches and can be vectorized.
+// Points which coincide with a node give infinite sums, and are then evaluated individually.
+template<class Real>
+template<class InputIterator, class OutputIterator>
+OutputIterator barycentric_rational_imp<Real>::operator()(InputIterator first, InputIterator last, OutputIterator out) const
+{
+    using boost::math::isfinite;
+    Real x[block_size];
+    Real numerator[block_size];
+    Real denominator[block_size];
+    while (first != last)
+    {
+        size_t m = 0;
+        for (; m < block_size && first != last; ++m, ++first)
+        {
+            x[m] = *first;
+        }
+        // Pad a short final block, so that the inner loop always has the same length:
+        for (size_t j = 0; j < block_size; ++j)
+        {
+            x[j] = j < m ? x[j] : x[0];
+            numerator[j] = 0;
+            denominator[j] = 0;
+        }
+        for (size_t i = 0; i < m_x.size(); ++i)
+        {
+            const Real xi = m_x[i];
+            const Real wi = m_w[i];
+            const Real yi = m_y[i];
+            for (size_t j = 0; j < block_size; ++j)
+            {
+                Real t = wi/(x[j] - xi);
+                numerator[j] += t*yi;
+                denominator[j] += t;
+            }
+        }
+        for (size_t j = 0; j < m; ++j)
+        {
+            // A point at a node divides by zero:
+            *out++ = (isfinite)(denominator[j]) ? numerator[j]/denominator[j] : this->operator()(x[j]);
+        }
+    }
+    return out;
+}
+
+template<class Real>
+template<class InputIterator, class OutputIterator>
+OutputIterator barycentric_rational_imp<Real>::prime(InputIterator first, InputIterator last, OutputIterator out) const
+{
+    using boost::math::isfinite;
+    Real x[block_size];
+    Real c[block_size];
+    Real numerator[block_size];
+    Real denominator[block_size];
+    Real numerator_prime[block_size];
+    Real denominator_prime[block_size];
+    while (first != last)
+    {
+        size_t m = 0;
+        for (; m < block_size && first != last; ++m, ++first)
+        {
+            x[m] = *first;
+        }
+        for (size_t j = 0; j < block_size; ++j)
+        {
+            x[j] = j < m ? x[j] : x[0];
+            c[j] = m_y[nearest_node(x[j])];
+            numerator[j] = 0;
+            denominator[j] = 0;
+            numerator_prime[j] = 0;
+            denominator_prime[j] = 0;
+        }
+        for (size_t i = 0; i < m_x.size(); ++i)
+        {
+            const Real xi = m_x[i];
+            const Real wi = m_w[i];
+            const Real yi = m_y[i];
+            for (size_t j = 0; j < block_size; ++j)
+            {
+                Real inv_diff = 1/(x[j] - xi);
+                Real t = wi*inv_diff;
+                Real dy = yi - c[j];
+                numerator[j] += t*dy;
+                denominator[j] += t;
+                numerator_prime[j] += t*dy*inv_diff;
+                denominator_prime[j] += t*inv_diff;
+            }
+        }
+        for (size_t j = 0; j < m; ++j)
+        {
+            if (!(isfinite)(denominator_prime[j]))
+            {
+                *out++ = this->value_and_prime(x[j]).second;
+            }
+            else
+            {
+                Real s = numerator[j]/denominator[j];
+                *out++ = (s*denominator_prime[j] - numerator_prime[j])/denominator[j];
+            }
+        }
+    }
+    return out;
+}
 }}}
 #endif
@@ -7,11 +7,14 @@
 #ifndef BOOST_MATH_INTERPOLATORS_CARDINAL_CUBIC_B_SPLINE_DETAIL_HPP
 #define BOOST_MATH_INTERPOLATORS_CARDINAL_CUBIC_B_SPLINE_DETAIL_HPP
 
+#include <array>
 #include <limits>
 #include <cmath>
 #include <vector>
 #include <memory>
+#include <utility>
 #include <boost/math/constants/constants.hpp>
+#include <boost/math/interpolators/detail/banded_solver.hpp>
 #include <boost/math/special_functions/fpclassify.hpp>
 #include <boost/math/special_functions/trunc.hpp>
 
@@ -24,10 +27,17 @@ class cardinal_cubic_b_spline_imp
 public:
     // If you don't know the value of the derivative at the endpoints, leave them as nans and the routine will estimate them.
     // f[0] = f(a), f[length -1] = b, step_size = (b - a)/(length -1).
+    // With threads != 1 the coefficients are found by a partitioned solve on that many threads, or one per core if zero.
     template <class BidiIterator>
     cardinal_cubic_b_spline_imp(BidiIterator f, BidiIterator end_p, Real left_endpoint, Real step_size,
                        Real left_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
-                       Real right_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN());
+                       Real right_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
+                       unsigned threads = 1);
+
+    // As above, but the coefficients overwrite f, which needs two more elements than the data.
+    // If f has the capacity for them then no memory is allocated beyond that used by the solve.
+    cardinal_cubic_b_spline_imp(std::vector<Real>&& f, Real left_endpoint, Real step_size,
+                       Real left_endpoint_derivative, Real right_endpoint_derivative, unsigned threads);
 
     Real operator()(Real x) const;
 
@@ -36,6 +46,13 @@ public:
     Real double_prime(Real x) const;
 
 private:
+    // Checks the data, and fills in the average and any missing endpoint derivatives:
+    template <class RandomAccessIterator>
+    void prepare(RandomAccessIterator f, std::size_t length, Real left_endpoint, Real step_size, Real& a1, Real& b1, unsigned threads);
+
+    // Solves for the coefficients with m_beta holding the right hand side of Kress's system:
+    void solve(unsigned threads);
+
     std::vector<Real> m_beta;
     Real m_h_inv;
     Real m_a;
@@ -103,17 +120,14 @@ Real b3_spline_double_prime(Real x)
 
 
 template <class Real>
-template <class BidiIterator>
-cardinal_cubic_b_spline_imp<Real>::cardinal_cubic_b_spline_imp(BidiIterator f, BidiIterator end_p, Real left_endpoint, Real step_size,
-                                             Real left_endpoint_derivative, Real right_endpoint_derivative) : m_a(left_endpoint), m_avg(0)
+template <class RandomAccessIterator>
+void cardinal_cubic_b_spline_imp<Real>::prepare(RandomAccessIterator f, std::size_t length, Real left_endpoint, Real step_size, Real& a1, Real& b1, unsigned threads)
 {
     using boost::math::constants::third;
 
-    std::size_t length = end_p - f;
-
     if (length < 5)
     {
-        if (boost::math::isnan(left_endpoint_derivative) || boost::math::isnan(right_endpoint_derivative))
+        if (boost::math::isnan(a1) || boost::math::isnan(b1))
         {
             throw std::logic_error("Interpolation using a cubic b spline with derivatives estimated at the endpoints requires at least 5 points.\n");
         }
@@ -140,7 +154,6 @@ cardinal_cubic_b_spline_imp<Real>::cardinal_cubic_b_spline_imp(BidiIterator f, B
     m_h_inv = 1/step_size;
 
     // Following Kress's notation, s'(a) = a1, s'(b) = b1
-    Real a1 = left_endpoint_derivative;
     // See the finite-difference table on Wikipedia for reference on how
     // to construct high-order estimates for one-sided derivatives:
     // https://en.wikipedia.org/wiki/Finite_difference_coefficient#Forward_and_backward_finite_difference
@@ -155,7 +168,6 @@ cardinal_cubic_b_spline_imp<Real>::cardinal_cubic_b_spline_imp(BidiIterator f, B
         a1 = m_h_inv*(t0 + t1);
     }
 
-    Real b1 = right_endpoint_derivative;
     if (boost::math::isnan(b1))
     {
         size_t n = length - 1;
@@ -165,28 +177,61 @@ cardinal_cubic_b_spline_imp<Real>::cardinal_cubic_b_spline_imp(BidiIterator f, B
         b1 = m_h_inv*(t0 + t1);
     }
 
-    // s(x) = \sum \alpha_i B_{3}( (x- x_i - a)/h )
-    // Of course we must reindex from Kress's notation, since he uses negative indices which make C++ unhappy.
-    m_beta.resize(length + 2, std::numeric_limits<Real>::quiet_NaN());
-
     // Since the splines have compact support, they decay to zero very fast outside the endpoints.
     // This is often very annoying; we'd like to evaluate the interpolant a little bit outside the
     // boundary [a,b] without massive error.
     // A simple way to deal with this is just to subtract the DC component off the signal, so we need the average.
     // This algorithm for computing the average is recommended in
     // http://www.heikohoffmann.de/htmlthesis/node134.html
-    Real t = 1;
-    for (size_t i = 0; i < length; ++i)
+    // With several threads, each finds the average of one block of the data, and these are combined:
+    std::size_t blocks = threads == 1 ? 1 : block_count(length, threads, 16384);
+    std::vector<Real> averages(blocks, Real(0));
+    for_each_block(blocks, [&](std::size_t p) {
+        Real t = 1;
+        for (size_t i = length*p/blocks; i < length*(p + 1)/blocks; ++i)
+        {
+            if (boost::math::isnan(f[i]))
+            {
+                std::string err = "This function you are trying to interpolate is a nan at index " + std::to_string(i) + "\n";
+                throw std::logic_error(err);
+            }
+            averages[p] += (f[i] - averages[p]) / t;
+            t += 1;
+        }
+    });
+    m_avg = averages[0];
+    for (std::size_t p = 1; p < blocks; ++p)
     {
-        if (boost::math::isnan(f[i]))
+        m_avg += (averages[p] - m_avg)*(length*(p + 1)/blocks - length*p/blocks)/(length*(p + 1)/blocks);
+    }
+}
+
+template <class Real>
+template <class BidiIterator>
+cardinal_cubic_b_spline_imp<Real>::cardinal_cubic_b_spline_imp(BidiIterator f, BidiIterator end_p, Real left_endpoint, Real step_size,
+                                             Real left_endpoint_derivative, Real right_endpoint_derivative, unsigned threads) : m_a(left_endpoint), m_avg(0)
+{
+    std::size_t length = end_p - f;
+    Real a1 = left_endpoint_derivative;
+    Real b1 = right_endpoint_derivative;
+    prepare(f, length, left_endpoint, step_size, a1, b1, threads);
+
+    if (threads != 1)
+    {
+        m_beta.resize(length + 2);
+        m_beta[0] = -2*step_size*a1;
+        for (size_t i = 0; i < length; ++i)
         {
-            std::string err = "This function you are trying to interpolate is a nan at index " + std::to_string(i) + "\n";
-            throw std::logic_error(err);
+            m_beta[i + 1] = 6*(f[i] - m_avg);
         }
-        m_avg += (f[i] - m_avg) / t;
-        t += 1;
+        m_beta[length + 1] = -2*step_size*b1;
+        solve(threads);
+        return;
     }
 
+    // s(x) = \sum \alpha_i B_{3}( (x- x_i - a)/h )
+    // Of course we must reindex from Kress's notation, since he uses negative indices which make C++ unhappy.
+    m_beta.resize(length + 2, std::numeric_limits<Real>::quiet_NaN());
 
     // Now we must solve an almost-tridiagonal system, which requires O(N) operations.
     // There are, in fact 5 diagonals, but they only differ from zero on the first and last row,
@@ -261,6 +306,50 @@ cardinal_cubic_b_spline_imp<Real>::cardinal_cubic_b_spline_imp(BidiIterator f, B
     m_beta[0] = m_beta[2] + rhs[0];
 }
 
+template <class Real>
+cardinal_cubic_b_spline_imp<Real>::cardinal_cubic_b_spline_imp(std::vector<Real>&& f, Real left_endpoint, Real step_size,
+                                             Real left_endpoint_derivative, Real right_endpoint_derivative, unsigned threads) : m_a(left_endpoint), m_avg(0)
+{
+    std::size_t length = f.size();
+    Real a1 = left_endpoint_derivative;
+    Real b1 = right_endpoint_derivative;
+    prepare(f.begin(), length, left_endpoint, step_size, a1, b1, threads);
+
+    m_beta = std::move(f);
+    m_beta.resize(length + 2);
+    for (size_t i = length; i > 0; --i)
+    {
+        m_beta[i] = 6*(m_beta[i - 1] - m_avg);
+    }
+    m_beta[0] = -2*step_size*a1;
+    m_beta[length + 1] = -2*step_size*b1;
+    solve(threads);
+}
+
+template <class Real>
+void cardinal_cubic_b_spline_imp<Real>::solve(unsigned threads)
+{
+    // Substituting the first and last rows of Kress's system,
+    // beta_0 = beta_2 + r_0 and beta_{n+1} = beta_{n-1} - r_{n+1},
+    // into the second and second to last leaves a diagonally dominant tridiagonal system for beta_1, ..., beta_n:
+    // 4  2
+    // 1  4  1
+    //    ....
+    //       1  4  1
+    //          2  4
+    std::size_t length = m_beta.size() - 2;
+    Real r0 = m_beta[0];
+    Real rn = m_beta[length + 1];
+    m_beta[1] -= r0;
+    m_beta[length] += rn;
+    auto band = [length](std::size_t i) -> std::array<Real, 3> {
+        return {{Real(i + 1 == length ? 2 : 1), Real(4), Real(i == 0 ? 2 : 1)}};
+    };
+    banded_solve<1>(band, m_beta.data() + 1, length, threads);
+    m_beta[0] = m_beta[2] + r0;
+    m_beta[length + 1] = m_beta[length - 1] - rn;
+}
+
 template<class Real>
 Real cardinal_cubic_b_spline_imp<Real>::operator()(Real x) const
 {
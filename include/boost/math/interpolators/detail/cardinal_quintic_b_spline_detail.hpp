@@ -6,10 +6,13 @@
 
 #ifndef BOOST_MATH_INTERPOLATORS_CARDINAL_QUINTIC_B_SPLINE_DETAIL_HPP
 #define BOOST_MATH_INTERPOLATORS_CARDINAL_QUINTIC_B_SPLINE_DETAIL_HPP
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <vector>
 #include <utility>
 #include <boost/math/special_functions/cardinal_b_spline.hpp>
+#include <boost/math/interpolators/detail/banded_solver.hpp>
 
 namespace boost{ namespace math{ namespace interpolators{ namespace detail{
 
@@ -20,43 +23,22 @@ class cardinal_quintic_b_spline_detail
 public:
     // If you don't know the value of the derivative at the endpoints, leave them as nans and the routine will estimate them.
     // y[0] = y(a), y[n -1] = y(b), step_size = (b - a)/(n -1).
+    // With threads != 1 the coefficients are found by a partitioned solve on that many threads, or one per core if zero.
 
     cardinal_quintic_b_spline_detail(const Real* const y,
                                      size_t n,
                                      Real t0 /* initial time, left endpoint */,
                                      Real h  /*spacing, stepsize*/,
                                      std::pair<Real, Real> left_endpoint_derivatives,
-                                     std::pair<Real, Real> right_endpoint_derivatives)
+                                     std::pair<Real, Real> right_endpoint_derivatives,
+                                     unsigned threads = 1)
     {
-        static_assert(!std::is_integral<Real>::value, "The quintic B-spline interpolator only works with floating point types.");
-        if (h <= 0) {
-            throw std::logic_error("Spacing must be > 0.");
-        }
-        m_inv_h = 1/h;
-        m_t0 = t0;
-
-        if (n < 8) {
-            throw std::logic_error("The quintic B-spline interpolator requires at least 8 points.");
-        }
-
-        using std::isnan;
-        // This interpolator has error of order h^6, so the derivatives should be estimated with the same error.
-        // See: https://en.wikipedia.org/wiki/Finite_difference_coefficient
-        if (isnan(left_endpoint_derivatives.first)) {
-            Real tmp = -49*y[0]/20 + 6*y[1] - 15*y[2]/2 + 20*y[3]/3 - 15*y[4]/4 + 6*y[5]/5 - y[6]/6;
-            left_endpoint_derivatives.first = tmp/h;
-        }
-        if (isnan(right_endpoint_derivatives.first)) {
-            Real tmp = 49*y[n-1]/20 - 6*y[n-2] + 15*y[n-3]/2 - 20*y[n-4]/3 + 15*y[n-5]/4 - 6*y[n-6]/5 + y[n-7]/6;
-            right_endpoint_derivatives.first = tmp/h;
-        }
-        if(isnan(left_endpoint_derivatives.second)) {
-            Real tmp = 469*y[0]/90 - 223*y[1]/10 + 879*y[2]/20 - 949*y[3]/18 + 41*y[4] - 201*y[5]/10 + 1019*y[6]/180 - 7*y[7]/10;
-            left_endpoint_derivatives.second = tmp/(h*h);
-        }
-        if (isnan(right_endpoint_derivatives.second)) {
-            Real tmp = 469*y[n-1]/90 - 223*y[n-2]/10 + 879*y[n-3]/20 - 949*y[n-4]/18 + 41*y[n-5] - 201*y[n-6]/10 + 1019*y[n-7]/180 - 7*y[n-8]/10;
-            right_endpoint_derivatives.second = tmp/(h*h);
+        prepare(y, n, t0, h, left_endpoint_derivatives, right_endpoint_derivatives);
+        if (threads != 1) {
+            m_alpha.resize(n + 4);
+            std::copy(y, y + n, m_alpha.begin() + 2);
+            solve(h, left_endpoint_derivatives, right_endpoint_derivatives, threads);
+            return;
         }
 
         // This is really challenging my mental limits on by-hand row reduction.
@@ -163,6 +145,23 @@ public:
 
     }
 
+    // As above, but the coefficients overwrite y, which needs four more elements than the data.
+    // If y has the capacity for them then no memory is allocated beyond that used by the solve.
+    cardinal_quintic_b_spline_detail(std::vector<Real>&& y,
+                                     Real t0,
+                                     Real h,
+                                     std::pair<Real, Real> left_endpoint_derivatives,
+                                     std::pair<Real, Real> right_endpoint_derivatives,
+                                     unsigned threads)
+    {
+        size_t n = y.size();
+        prepare(y.data(), n, t0, h, left_endpoint_derivatives, right_endpoint_derivatives);
+        m_alpha = std::move(y);
+        m_alpha.resize(n + 4);
+        std::copy_backward(m_alpha.begin(), m_alpha.begin() + n, m_alpha.begin() + n + 2);
+        solve(h, left_endpoint_derivatives, right_endpoint_derivatives, threads);
+    }
+
     Real operator()(Real t) const {
         using std::ceil;
         using std::floor;
@@ -231,6 +230,76 @@ public:
     }
 
 private:
+    // Checks the data, and fills in any missing endpoint derivatives:
+    void prepare(const Real* const y, size_t n, Real t0, Real h,
+                 std::pair<Real, Real>& left_endpoint_derivatives,
+                 std::pair<Real, Real>& right_endpoint_derivatives)
+    {
+        static_assert(!std::is_integral<Real>::value, "The quintic B-spline interpolator only works with floating point types.");
+        if (h <= 0) {
+            throw std::logic_error("Spacing must be > 0.");
+        }
+        m_inv_h = 1/h;
+        m_t0 = t0;
+
+        if (n < 8) {
+            throw std::logic_error("The quintic B-spline interpolator requires at least 8 points.");
+        }
+
+        using std::isnan;
+        // This interpolator has error of order h^6, so the derivatives should be estimated with the same error.
+        // See: https://en.wikipedia.org/wiki/Finite_difference_coefficient
+        if (isnan(left_endpoint_derivatives.first)) {
+            Real tmp = -49*y[0]/20 + 6*y[1] - 15*y[2]/2 + 20*y[3]/3 - 15*y[4]/4 + 6*y[5]/5 - y[6]/6;
+            left_endpoint_derivatives.first = tmp/h;
+        }
+        if (isnan(right_endpoint_derivatives.first)) {
+            Real tmp = 49*y[n-1]/20 - 6*y[n-2] + 15*y[n-3]/2 - 20*y[n-4]/3 + 15*y[n-5]/4 - 6*y[n-6]/5 + y[n-7]/6;
+            right_endpoint_derivatives.first = tmp/h;
+        }
+        if(isnan(left_endpoint_derivatives.second)) {
+            Real tmp = 469*y[0]/90 - 223*y[1]/10 + 879*y[2]/20 - 949*y[3]/18 + 41*y[4] - 201*y[5]/10 + 1019*y[6]/180 - 7*y[7]/10;
+            left_endpoint_derivatives.second = tmp/(h*h);
+        }
+        if (isnan(right_endpoint_derivatives.second)) {
+            Real tmp = 469*y[n-1]/90 - 223*y[n-2]/10 + 879*y[n-3]/20 - 949*y[n-4]/18 + 41*y[n-5] - 201*y[n-6]/10 + 1019*y[n-7]/180 - 7*y[n-8]/10;
+            right_endpoint_derivatives.second = tmp/(h*h);
+        }
+    }
+
+    // Solves for the coefficients with the data in m_alpha[2], ..., m_alpha[n+1]:
+    void solve(Real h, std::pair<Real, Real> const & left_endpoint_derivatives, std::pair<Real, Real> const & right_endpoint_derivatives, unsigned threads)
+    {
+        size_t n = m_alpha.size() - 4;
+        Real y0 = m_alpha[2];
+        Real yn = m_alpha[n+1];
+        m_alpha[0] = 20*y0 - 12*h*left_endpoint_derivatives.first +  2*h*h*left_endpoint_derivatives.second;
+        m_alpha[1] = 60*y0 - 12*h*left_endpoint_derivatives.first;
+        for (size_t i = 2; i < n + 2; ++i) {
+            m_alpha[i] *= 120;
+        }
+        m_alpha[n+2] = 60*yn + 12*h*right_endpoint_derivatives.first;
+        m_alpha[n+3] = 20*yn + 12*h*right_endpoint_derivatives.first +  2*h*h*right_endpoint_derivatives.second;
+
+        // The same pentadiagonal system as the serial row reduction above, which is diagonally dominant away from its first and last two rows:
+        auto band = [n](size_t i) -> std::array<Real, 5> {
+            if (i == 0) {
+                return {{0, 0, 1, 10, 9}};
+            }
+            if (i == 1) {
+                return {{0, 1, 18, 33, 8}};
+            }
+            if (i == n + 2) {
+                return {{8, 33, 18, 1, 0}};
+            }
+            if (i == n + 3) {
+                return {{9, 10, 1, 0, 0}};
+            }
+            return {{1, 26, 66, 26, 1}};
+        };
+        banded_solve<2>(band, m_alpha.data(), n + 4, threads);
+    }
+
     std::vector<Real> m_alpha;
     Real m_inv_h;
     Real m_t0;
@@ -12,12 +12,41 @@
 #include <iostream>
 #include <sstream>
 #include <limits>
+#include <utility>
+#include <boost/math/interpolators/detail/find_interval.hpp>
 
 namespace boost {
 namespace math {
 namespace interpolators {
 namespace detail {
 
+// Containers with a fixed capacity, such as boost::circular_buffer, drop their first element when pushed back while full.
+// An interpolator built on them then keeps a sliding window of the most recent knots, in constant memory;
+// for this, the containers holding the abscissas, ordinates and derivatives must drop their elements together.
+template<class RandomAccessContainer>
+auto same_capacity(const RandomAccessContainer& a, const RandomAccessContainer& b, int) -> decltype(std::declval<RandomAccessContainer&>().set_capacity(a.capacity()), bool())
+{
+    return a.capacity() == b.capacity();
+}
+
+template<class RandomAccessContainer>
+bool same_capacity(const RandomAccessContainer&, const RandomAccessContainer&, long)
+{
+    return true;
+}
+
+// Gives dst the capacity of src, when the capacity is fixed:
+template<class RandomAccessContainer>
+auto match_capacity(RandomAccessContainer& dst, const RandomAccessContainer& src, int) -> decltype(dst.set_capacity(src.capacity()), void())
+{
+    dst.set_capacity(src.capacity());
+}
+
+template<class RandomAccessContainer>
+void match_capacity(RandomAccessContainer&, const RandomAccessContainer&, long)
+{
+}
+
 template<class RandomAccessContainer>
 class cubic_hermite_detail {
 public:
@@ -40,6 +69,10 @@ public:
         {
             throw std::domain_error("Must be at least two data points.");
         }
+        if (!same_capacity(x_, y_, 0) || !same_capacity(x_, dydx_, 0))
+        {
+            throw std::domain_error("The abscissas, ordinates and derivatives must be held in containers of the same capacity, so that push_back drops the same knot from each.");
+        }
         Real x0 = x_[0];
         for (size_t i = 1; i < x_.size(); ++i)
         {
@@ -70,6 +103,77 @@ public:
     }
 
     Real operator()(Real x) const
+    {
+        check_domain(x);
+        // We need t := (x-x_k)/(x_{k+1}-x_k) \in [0,1) for this to work.
+        // Sadly this neccessitates this loathesome check, otherwise we get t = 1 at x = xf.
+        if (x == x_.back())
+        {
+            return y_.back();
+        }
+        auto it = std::upper_bound(x_.begin(), x_.end(), x);
+        return unchecked_evaluation(x, std::distance(x_.begin(), it) - 1);
+    }
+
+    // As above, but starts the search for x's interval from hint, and leaves x's interval in hint.
+    // When successive queries are near each other, this replaces the binary search by an O(1) step.
+    Real operator()(Real x, std::size_t& hint) const
+    {
+        check_domain(x);
+        if (x == x_.back())
+        {
+            return y_.back();
+        }
+        hint = find_interval(x_, x, hint);
+        return unchecked_evaluation(x, hint);
+    }
+
+    // Evaluates at each abscissa in [first, last), fastest when they are sorted:
+    template<class InputIterator, class OutputIterator>
+    OutputIterator operator()(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        std::size_t hint = 0;
+        for (; first != last; ++first, ++out)
+        {
+            *out = this->operator()(*first, hint);
+        }
+        return out;
+    }
+
+    Real prime(Real x) const
+    {
+        check_domain(x);
+        if (x == x_.back())
+        {
+            return dydx_.back();
+        }
+        auto it = std::upper_bound(x_.begin(), x_.end(), x);
+        return unchecked_prime(x, std::distance(x_.begin(), it) - 1);
+    }
+
+    Real prime(Real x, std::size_t& hint) const
+    {
+        check_domain(x);
+        if (x == x_.back())
+        {
+            return dydx_.back();
+        }
+        hint = find_interval(x_, x, hint);
+        return unchecked_prime(x, hint);
+    }
+
+    template<class InputIterator, class OutputIterator>
+    OutputIterator prime(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        std::size_t hint = 0;
+        for (; first != last; ++first, ++out)
+        {
+            *out = this->prime(*first, hint);
+        }
+        return out;
+    }
+
+    void check_domain(Real x) const
     {
         if  (x < x_[0] || x > x_.back())
         {
@@ -79,17 +183,13 @@ public:
                 << x_[0] << ", " << x_.back() << "]";
             throw std::domain_error(oss.str());
         }
-        // We need t := (x-x_k)/(x_{k+1}-x_k) \in [0,1) for this to work.
-        // Sadly this neccessitates this loathesome check, otherwise we get t = 1 at x = xf.
-        if (x == x_.back())
-        {
-            return y_.back();
-        }
+    }
 
-        auto it = std::upper_bound(x_.begin(), x_.end(), x);
-        auto i = std::distance(x_.begin(), it) -1;
-        Real x0 = *(it-1);
-        Real x1 = *it;
+    // Evaluation on the interval [x_i, x_{i+1}] which contains x:
+    Real unchecked_evaluation(Real x, std::size_t i) const
+    {
+        Real x0 = x_[i];
+        Real x1 = x_[i+1];
         Real y0 = y_[i];
         Real y1 = y_[i+1];
         Real s0 = dydx_[i];
@@ -104,24 +204,10 @@ public:
         return y;
     }
 
-    Real prime(Real x) const
+    Real unchecked_prime(Real x, std::size_t i) const
     {
-        if  (x < x_[0] || x > x_.back())
-        {
-            std::ostringstream oss;
-            oss.precision(std::numeric_limits<Real>::digits10+3);
-            oss << "Requested abscissa x = " << x << ", which is outside of allowed range ["
-                << x_[0] << ", " << x_.back() << "]";
-            throw std::domain_error(oss.str());
-        }
-        if (x == x_.back())
-        {
-            return dydx_.back();
-        }
-        auto it = std::upper_bound(x_.begin(), x_.end(), x);
-        auto i = std::distance(x_.begin(), it) -1;
-        Real x0 = *(it-1);
-        Real x1 = *it;
+        Real x0 = x_[i];
+        Real x1 = x_[i+1];
         Real y0 = y_[i];
         Real y1 = y_[i+1];
         Real s0 = dydx_[i];
@@ -174,7 +260,7 @@ public:
     using Real = typename RandomAccessContainer::value_type;
 
     cardinal_cubic_hermite_detail(RandomAccessContainer && y, RandomAccessContainer dydx, Real x0, Real dx)
-    : y_{std::move(y)}, dy_{std::move(dydx)}, x0_{x0}, inv_dx_{1/dx}
+    : y_{std::move(y)}, dy_{std::move(dydx)}, x0_{x0}, inv_dx_{1/dx}, first_x0_{x0}, dx_{dx}, dropped_{0}
     {
         using std::abs;
         using std::isnan;
@@ -190,6 +276,10 @@ public:
         {
             throw std::domain_error("dx > 0 is required.");
         }
+        if (!same_capacity(y_, dy_, 0))
+        {
+            throw std::domain_error("The ordinates and derivatives must be held in containers of the same capacity, so that push_back drops the same knot from each.");
+        }
 
         for (auto & dy : dy_)
         {
@@ -197,9 +287,20 @@ public:
         }
     }
 
-    // Why not implement push_back? It's awkward: If the buffer is circular, x0_ += dx_.
-    // If the buffer is not circular, x0_ is unchanged.
-    // We need a concept for circular_buffer!
+    // Appends a knot at the right end of the domain.
+    // If the container is full and so drops its first element, as boost::circular_buffer does, the domain moves right by dx.
+    // The left endpoint is recomputed from the number of knots dropped, rather than incremented, so that it does not drift.
+    void push_back(Real y, Real dydx)
+    {
+        auto n = y_.size();
+        y_.push_back(y);
+        dy_.push_back(dydx*dx_);
+        if (y_.size() == n)
+        {
+            ++dropped_;
+            x0_ = first_x0_ + dropped_*dx_;
+        }
+    }
 
     inline Real operator()(Real x) const
     {
@@ -278,7 +379,7 @@ public:
 
     int64_t bytes() const
     {
-        return 2*y_.size()*sizeof(Real) + 2*sizeof(y_) + 2*sizeof(Real);
+        return 2*y_.size()*sizeof(Real) + 2*sizeof(y_) + 4*sizeof(Real) + sizeof(dropped_);
     }
 
     std::pair<Real, Real> domain() const
@@ -293,6 +394,9 @@ private:
     RandomAccessContainer dy_;
     Real x0_;
     Real inv_dx_;
+    Real first_x0_;
+    Real dx_;
+    std::size_t dropped_;
 };
 
 
@@ -303,7 +407,7 @@ public:
     using Real = typename Point::value_type;
 
     cardinal_cubic_hermite_detail_aos(RandomAccessContainer && dat, Real x0, Real dx)
-    : dat_{std::move(dat)}, x0_{x0}, inv_dx_{1/dx}
+    : dat_{std::move(dat)}, x0_{x0}, inv_dx_{1/dx}, first_x0_{x0}, dx_{dx}, dropped_{0}
     {
         if (dat_.size() < 2)
         {
@@ -324,6 +428,21 @@ public:
         }
     }
 
+    // As for cardinal_cubic_hermite_detail::push_back:
+    void push_back(Real y, Real dydx)
+    {
+        auto n = dat_.size();
+        Point d = dat_.back();
+        d[0] = y;
+        d[1] = dydx*dx_;
+        dat_.push_back(d);
+        if (dat_.size() == n)
+        {
+            ++dropped_;
+            x0_ = first_x0_ + dropped_*dx_;
+        }
+    }
+
     inline Real operator()(Real x) const
     {
         const Real xf = x0_ + (dat_.size()-1)/inv_dx_;
@@ -412,7 +531,7 @@ public:
 
     int64_t bytes() const
     {
-        return dat_.size()*dat_[0].size()*sizeof(Real) + sizeof(dat_) + 2*sizeof(Real);
+        return dat_.size()*dat_[0].size()*sizeof(Real) + sizeof(dat_) + 4*sizeof(Real) + sizeof(dropped_);
     }
 
     std::pair<Real, Real> domain() const
@@ -426,6 +545,9 @@ private:
     RandomAccessContainer dat_;
     Real x0_;
     Real inv_dx_;
+    Real first_x0_;
+    Real dx_;
+    std::size_t dropped_;
 };
 
 }
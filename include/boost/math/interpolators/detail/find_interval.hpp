@@ -0,0 +1,75 @@
+// Copyright Boost.Math contributors, 2020
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_INTERPOLATORS_DETAIL_FIND_INTERVAL_HPP
+#define BOOST_MATH_INTERPOLATORS_DETAIL_FIND_INTERVAL_HPP
+#include <algorithm>
+#include <cstddef>
+
+namespace boost {
+namespace math {
+namespace interpolators {
+namespace detail {
+
+// Returns the index i with x[i] <= t < x[i+1], given x[0] <= t < x.back().
+// The search starts from the interval hint, and moves away from it in steps which double in length before
+// bisecting, so a query in the same or a neighbouring interval costs O(1), and one k intervals away O(log k).
+// Hence walking a sorted sequence of queries costs amortized O(1) per query, rather than the O(log n) of std::upper_bound.
+template<class RandomAccessContainer, class Real>
+std::size_t find_interval(const RandomAccessContainer& x, const Real& t, std::size_t hint)
+{
+    const std::size_t n = x.size();
+    if (hint > n - 2)
+    {
+        hint = n - 2;
+    }
+    if (t < x[hint])
+    {
+        // Search downwards for lo with x[lo] <= t, which x[0] satisfies:
+        std::size_t hi = hint;
+        std::size_t lo = 0;
+        std::size_t step = 1;
+        while (step < hi)
+        {
+            if (x[hi - step] <= t)
+            {
+                lo = hi - step;
+                break;
+            }
+            hi -= step;
+            step *= 2;
+        }
+        // Now x[lo] <= t < x[hi]:
+        auto it = std::upper_bound(x.begin() + lo + 1, x.begin() + hi, t);
+        return static_cast<std::size_t>(it - x.begin()) - 1;
+    }
+    if (t < x[hint + 1])
+    {
+        return hint;
+    }
+    // Search upwards for hi with t < x[hi], which x[n-1] satisfies:
+    std::size_t lo = hint + 1;
+    std::size_t hi = n - 1;
+    std::size_t step = 1;
+    while (lo + step < n - 1)
+    {
+        if (t < x[lo + step])
+        {
+            hi = lo + step;
+            break;
+        }
+        lo += step;
+        step *= 2;
+    }
+    auto it = std::upper_bound(x.begin() + lo + 1, x.begin() + hi, t);
+    return static_cast<std::size_t>(it - x.begin()) - 1;
+}
+
+} // namespace detail
+} // namespace interpolators
+} // namespace math
+} // namespace boost
+#endif
@@ -10,6 +10,7 @@
 #include <stdexcept>
 #include <sstream>
 #include <cmath>
+#include <boost/math/interpolators/detail/find_interval.hpp>
 
 namespace boost {
 namespace math {
@@ -65,6 +66,130 @@ public:
     }
 
     inline Real operator()(Real x) const
+    {
+        check_domain(x);
+        // We need t := (x-x_k)/(x_{k+1}-x_k) \in [0,1) for this to work.
+        // Sadly this neccessitates this loathesome check, otherwise we get t = 1 at x = xf.
+        if (x == x_.back())
+        {
+            return y_.back();
+        }
+        auto it = std::upper_bound(x_.begin(), x_.end(), x);
+        return unchecked_evaluation(x, std::distance(x_.begin(), it) - 1);
+    }
+
+    // As above, but starts the search for x's interval from hint, and leaves x's interval in hint:
+    inline Real operator()(Real x, std::size_t& hint) const
+    {
+        check_domain(x);
+        if (x == x_.back())
+        {
+            return y_.back();
+        }
+        hint = find_interval(x_, x, hint);
+        return unchecked_evaluation(x, hint);
+    }
+
+    template<class InputIterator, class OutputIterator>
+    OutputIterator operator()(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        std::size_t hint = 0;
+        for (; first != last; ++first, ++out)
+        {
+            *out = this->operator()(*first, hint);
+        }
+        return out;
+    }
+
+    inline Real prime(Real x) const
+    {
+        check_domain(x);
+        if (x == x_.back())
+        {
+            return dydx_.back();
+        }
+        auto it = std::upper_bound(x_.begin(), x_.end(), x);
+        return unchecked_prime(x, std::distance(x_.begin(), it) - 1);
+    }
+
+    inline Real prime(Real x, std::size_t& hint) const
+    {
+        check_domain(x);
+        if (x == x_.back())
+        {
+            return dydx_.back();
+        }
+        hint = find_interval(x_, x, hint);
+        return unchecked_prime(x, hint);
+    }
+
+    template<class InputIterator, class OutputIterator>
+    OutputIterator prime(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        std::size_t hint = 0;
+        for (; first != last; ++first, ++out)
+        {
+            *out = this->prime(*first, hint);
+        }
+        return out;
+    }
+
+    inline Real double_prime(Real x) const
+    {
+        check_domain(x);
+        if (x == x_.back())
+        {
+            return d2ydx2_.back();
+        }
+        auto it = std::upper_bound(x_.begin(), x_.end(), x);
+        return unchecked_double_prime(x, std::distance(x_.begin(), it) - 1);
+    }
+
+    inline Real double_prime(Real x, std::size_t& hint) const
+    {
+        check_domain(x);
+        if (x == x_.back())
+        {
+            return d2ydx2_.back();
+        }
+        hint = find_interval(x_, x, hint);
+        return unchecked_double_prime(x, hint);
+    }
+
+    template<class InputIterator, class OutputIterator>
+    OutputIterator double_prime(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        std::size_t hint = 0;
+        for (; first != last; ++first, ++out)
+        {
+            *out = this->double_prime(*first, hint);
+        }
+        return out;
+    }
+
+    friend std::ostream& operator<<(std::ostream & os, const quintic_hermite_detail & m)
+    {
+        os << "(x,y,y') = {";
+        for (size_t i = 0; i < m.x_.size() - 1; ++i) {
+            os << "(" << m.x_[i] << ", " << m.y_[i] << ", " << m.dydx_[i] << ", " << m.d2ydx2_[i] << "),  ";
+        }
+        auto n = m.x_.size()-1;
+        os << "(" << m.x_[n] << ", " << m.y_[n] << ", " << m.dydx_[n] << ", " << m.d2ydx2_[n] << ")}";
+        return os;
+    }
+
+    int64_t bytes() const
+    {
+        return 4*x_.size()*sizeof(x_);
+    }
+
+    std::pair<Real, Real> domain() const
+    {
+        return {x_.front(), x_.back()};
+    }
+
+private:
+    void check_domain(Real x) const
     {
         if  (x < x_[0] || x > x_.back())
         {
@@ -74,17 +199,13 @@ public:
                 << x_[0] << ", " << x_.back() << "]";
             throw std::domain_error(oss.str());
         }
-        // We need t := (x-x_k)/(x_{k+1}-x_k) \in [0,1) for this to work.
-        // Sadly this neccessitates this loathesome check, otherwise we get t = 1 at x = xf.
-        if (x == x_.back())
-        {
-            return y_.back();
-        }
+    }
 
-        auto it = std::upper_bound(x_.begin(), x_.end(), x);
-        auto i = std::distance(x_.begin(), it) -1;
-        Real x0 = *(it-1);
-        Real x1 = *it;
+    // Evaluation on the interval [x_i, x_{i+1}] which contains x:
+    inline Real unchecked_evaluation(Real x, std::size_t i) const
+    {
+        Real x0 = x_[i];
+        Real x1 = x_[i+1];
         Real y0 = y_[i];
         Real y1 = y_[i+1];
         Real v0 = dydx_[i];
@@ -107,25 +228,10 @@ public:
         return y;
     }
 
-    inline Real prime(Real x) const
+    inline Real unchecked_prime(Real x, std::size_t i) const
     {
-        if  (x < x_[0] || x > x_.back())
-        {
-            std::ostringstream oss;
-            oss.precision(std::numeric_limits<Real>::digits10+3);
-            oss << "Requested abscissa x = " << x << ", which is outside of allowed range ["
-                << x_[0] << ", " << x_.back() << "]";
-            throw std::domain_error(oss.str());
-        }
-        if (x == x_.back())
-        {
-            return dydx_.back();
-        }
-
-        auto it = std::upper_bound(x_.begin(), x_.end(), x);
-        auto i = std::distance(x_.begin(), it) -1;
-        Real x0 = *(it-1);
-        Real x1 = *it;
+        Real x0 = x_[i];
+        Real x1 = x_[i+1];
         Real dx = x1 - x0;
 
         Real y0 = y_[i];
@@ -143,25 +249,10 @@ public:
         return dydx;
     }
 
-    inline Real double_prime(Real x) const
+    inline Real unchecked_double_prime(Real x, std::size_t i) const
     {
-        if  (x < x_[0] || x > x_.back())
-        {
-            std::ostringstream oss;
-            oss.precision(std::numeric_limits<Real>::digits10+3);
-            oss << "Requested abscissa x = " << x << ", which is outside of allowed range ["
-                << x_[0] << ", " << x_.back() << "]";
-            throw std::domain_error(oss.str());
-        }
-        if (x == x_.back())
-        {
-            return d2ydx2_.back();
-        }
-
-        auto it = std::upper_bound(x_.begin(), x_.end(), x);
-        auto i = std::distance(x_.begin(), it) -1;
-        Real x0 = *(it-1);
-        Real x1 = *it;
+        Real x0 = x_[i];
+        Real x1 = x_[i+1];
         Real dx = x1 - x0;
 
         Real y0 = y_[i];
@@ -181,28 +272,6 @@ public:
         return d2ydx2;
     }
 
-    friend std::ostream& operator<<(std::ostream & os, const quintic_hermite_detail & m)
-    {
-        os << "(x,y,y') = {";
-        for (size_t i = 0; i < m.x_.size() - 1; ++i) {
-            os << "(" << m.x_[i] << ", " << m.y_[i] << ", " << m.dydx_[i] << ", " << m.d2ydx2_[i] << "),  ";
-        }
-        auto n = m.x_.size()-1;
-        os << "(" << m.x_[n] << ", " << m.y_[n] << ", " << m.dydx_[n] << ", " << m.d2ydx2_[n] << ")}";
-        return os;
-    }
-
-    int64_t bytes() const
-    {
-        return 4*x_.size()*sizeof(x_);
-    }
-
-    std::pair<Real, Real> domain() const
-    {
-        return {x_.front(), x_.back()};
-    }
-
-private:
     RandomAccessContainer x_;
     RandomAccessContainer y_;
     RandomAccessContainer dydx_;
@@ -5,6 +5,12 @@
 // or copy at http://www.boost.org/LICENSE_1_0.txt)
 #ifndef BOOST_MATH_INTERPOLATORS_WHITAKKER_SHANNON_DETAIL_HPP
 #define BOOST_MATH_INTERPOLATORS_WHITAKKER_SHANNON_DETAIL_HPP
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <vector>
 #include <boost/assert.hpp>
 #include <boost/math/constants/constants.hpp>
 #include <boost/math/special_functions/sin_pi.hpp>
@@ -12,6 +18,48 @@
 
 namespace boost { namespace math { namespace interpolators { namespace detail {
 
+// In place radix 2 discrete Fourier transform of (re, im), whose length N is a power of 2.
+// cos_table[k] and sin_table[k] hold cos(2pi k/N) and sin(2pi k/N) for k < N/2.
+template<class Real>
+void radix2_fft(std::vector<Real>& re, std::vector<Real>& im, std::vector<Real> const & cos_table, std::vector<Real> const & sin_table, bool inverse)
+{
+    using std::swap;
+    std::size_t N = re.size();
+    for (std::size_t i = 1, j = 0; i < N; ++i)
+    {
+        std::size_t bit = N >> 1;
+        for (; j & bit; bit >>= 1)
+        {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j)
+        {
+            swap(re[i], re[j]);
+            swap(im[i], im[j]);
+        }
+    }
+    for (std::size_t len = 2; len <= N; len <<= 1)
+    {
+        std::size_t half = len >> 1;
+        std::size_t stride = N/len;
+        for (std::size_t i = 0; i < N; i += len)
+        {
+            for (std::size_t k = 0; k < half; ++k)
+            {
+                Real wr = cos_table[k*stride];
+                Real wi = inverse ? sin_table[k*stride] : -sin_table[k*stride];
+                Real xr = re[i + k + half]*wr - im[i + k + half]*wi;
+                Real xi = re[i + k + half]*wi + im[i + k + half]*wr;
+                re[i + k + half] = re[i + k] - xr;
+                im[i + k + half] = im[i + k] - xi;
+                re[i + k] += xr;
+                im[i + k] += xi;
+            }
+        }
+    }
+}
+
 template<class RandomAccessContainer>
 class whittaker_shannon_detail {
 public:
@@ -100,6 +148,162 @@ public:
 
 
 
+    // Evaluates the interpolant at each t in [first, last).
+    // The sum over the samples is split into those within near_field_width of t, which are added directly,
+    // and the rest, whose sum is a smooth function of t between consecutive samples, and is replaced there by its
+    // interpolant at the Chebyshev points. These are found at every point at once as convolutions with the samples, by FFT.
+    // Each term of the far sum is then in error by at most tol relative to its size.
+    template<class ForwardIterator, class OutputIterator>
+    OutputIterator operator()(ForwardIterator first, ForwardIterator last, OutputIterator out, Real tol) const {
+        using boost::math::constants::pi;
+        using std::log;
+        using std::sqrt;
+        using std::ceil;
+        using std::floor;
+        if (!(tol > 0))
+        {
+            throw std::domain_error("The tolerance must be positive.");
+        }
+        const std::size_t n = m_y.size();
+        const std::size_t m = static_cast<std::size_t>(std::distance(first, last));
+        if (n < 2*near_field_width + 4)
+        {
+            for (; first != last; ++first)
+            {
+                *out++ = this->operator()(*first);
+            }
+            return out;
+        }
+
+        // The poles of 1/(x-k) for the far samples lie at least near_field_width + 1 outside the interval [j, j+1],
+        // which is half an interval width times a = 2*near_field_width + 3 in the variable of the Chebyshev polynomials.
+        // Each term is analytic and bounded by 2 within the Bernstein ellipse of semi-major axis a - 1,
+        // so the interpolant of degree p has relative error below 8(near_field_width + 2)/((r - 1)r^p) with r the sum of its semi-axes.
+        const Real a = 2*near_field_width + 3;
+        const Real r = a - 1 + sqrt((a - 1)*(a - 1) - 1);
+        Real p_estimate = ceil(log(8*(near_field_width + 2)/((r - 1)*tol))/log(r));
+        std::size_t p = p_estimate < 1 ? 1 : static_cast<std::size_t>(p_estimate);
+        std::size_t N = 1;
+        std::size_t log2N = 0;
+        while (N < 2*n)
+        {
+            N <<= 1;
+            ++log2N;
+        }
+        // When there are too few points to pay for the transforms, sum directly:
+        if (m*n <= 5*(2*p + 3)*N*log2N + m*(2*near_field_width + 2*p + 8))
+        {
+            for (; first != last; ++first)
+            {
+                *out++ = this->operator()(*first);
+            }
+            return out;
+        }
+
+        std::vector<Real> cos_table(N/2);
+        std::vector<Real> sin_table(N/2);
+        for (std::size_t k = 0; k < N/2; ++k)
+        {
+            cos_table[k] = boost::math::cos_pi(Real(2*k)/Real(N));
+            sin_table[k] = boost::math::sin_pi(Real(2*k)/Real(N));
+        }
+        std::vector<Real> yr(N, Real(0));
+        std::vector<Real> yi(N, Real(0));
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            yr[k] = m_y[k];
+        }
+        radix2_fft(yr, yi, cos_table, sin_table, false);
+
+        // far[j*(p+1) + q] is the sum over the far samples at x = j + u_q:
+        std::vector<Real> nodes(p + 1);
+        std::vector<Real> far((n - 1)*(p + 1));
+        std::vector<Real> gr(N);
+        std::vector<Real> gi(N);
+        for (std::size_t q = 0; q <= p; ++q)
+        {
+            Real u = (1 - boost::math::cos_pi(Real(q)/Real(p)))/2;
+            nodes[q] = u;
+            std::fill(gr.begin(), gr.end(), Real(0));
+            std::fill(gi.begin(), gi.end(), Real(0));
+            // The kernel at offset d = j - k, stored cyclically:
+            for (std::size_t d = near_field_width + 1; d < n; ++d)
+            {
+                gr[d] = 1/(d + u);
+            }
+            for (std::size_t d = near_field_width + 2; d < n; ++d)
+            {
+                gr[N - d] = 1/(u - d);
+            }
+            radix2_fft(gr, gi, cos_table, sin_table, false);
+            for (std::size_t k = 0; k < N; ++k)
+            {
+                Real re = gr[k]*yr[k] - gi[k]*yi[k];
+                gi[k] = gr[k]*yi[k] + gi[k]*yr[k];
+                gr[k] = re;
+            }
+            radix2_fft(gr, gi, cos_table, sin_table, true);
+            for (std::size_t j = 0; j + 1 < n; ++j)
+            {
+                far[j*(p + 1) + q] = gr[j]/N;
+            }
+        }
+
+        for (; first != last; ++first)
+        {
+            Real x = (*first - m_t0)/m_h;
+            if (!(x >= 0 && x <= n - 1))
+            {
+                *out++ = this->operator()(*first);
+                continue;
+            }
+            Real fx = floor(x);
+            std::size_t j = static_cast<std::size_t>(fx);
+            if (fx == x)
+            {
+                *out++ = this->operator[](j);
+                continue;
+            }
+            Real u = x - fx;
+            std::size_t k0 = j > near_field_width ? j - near_field_width : 0;
+            std::size_t k1 = j + near_field_width + 1 < n - 1 ? j + near_field_width + 1 : n - 1;
+            Real s = 0;
+            for (std::size_t k = k0; k <= k1; ++k)
+            {
+                s += m_y[k]/(x - k);
+            }
+            // Barycentric interpolation at the Chebyshev points of the second kind:
+            Real const * f = far.data() + j*(p + 1);
+            Real numerator = 0;
+            Real denominator = 0;
+            Real far_sum = 0;
+            bool at_node = false;
+            for (std::size_t q = 0; q <= p; ++q)
+            {
+                if (u == nodes[q])
+                {
+                    far_sum = f[q];
+                    at_node = true;
+                    break;
+                }
+                Real w = (q & 1) ? -1 : 1;
+                if (q == 0 || q == p)
+                {
+                    w /= 2;
+                }
+                w /= (u - nodes[q]);
+                numerator += w*f[q];
+                denominator += w;
+            }
+            if (!at_node)
+            {
+                far_sum = numerator/denominator;
+            }
+            *out++ = (s + far_sum)*boost::math::sin_pi(x)/pi<Real>();
+        }
+        return out;
+    }
+
     Real operator[](size_t i) const {
         if (i & 1)
         {
@@ -118,6 +322,9 @@ public:
 
 
 private:
+    // The number of samples on each side of an interval whose terms are always summed directly:
+    static constexpr std::size_t near_field_width = 8;
+
     RandomAccessContainer m_y;
     Real m_t0;
     Real m_h;
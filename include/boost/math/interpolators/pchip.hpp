@@ -28,6 +28,8 @@ public:
             throw std::domain_error("Must be at least four data points.");
         }
         RandomAccessContainer s(x.size(), std::numeric_limits<Real>::quiet_NaN());
+        // A sliding window must drop the derivatives along with the abscissas:
+        detail::match_capacity(s, x, 0);
         if (isnan(left_endpoint_derivative))
         {
             // O(h) finite difference derivative:
@@ -74,16 +76,46 @@ public:
         return impl_->operator()(x);
     }
 
+    // Starts the search for x's interval from hint, and leaves x's interval in hint:
+    Real operator()(Real x, std::size_t& hint) const {
+        return impl_->operator()(x, hint);
+    }
+
+    // Evaluates at each abscissa in [first, last), fastest when they are sorted:
+    template<class InputIterator, class OutputIterator>
+    OutputIterator operator()(InputIterator first, InputIterator last, OutputIterator out) const {
+        return impl_->operator()(first, last, out);
+    }
+
     Real prime(Real x) const {
         return impl_->prime(x);
     }
 
+    Real prime(Real x, std::size_t& hint) const {
+        return impl_->prime(x, hint);
+    }
+
+    template<class InputIterator, class OutputIterator>
+    OutputIterator prime(InputIterator first, InputIterator last, OutputIterator out) const {
+        return impl_->prime(first, last, out);
+    }
+
     friend std::ostream& operator<<(std::ostream & os, const pchip & m)
     {
         os << *m.impl_;
         return os;
     }
 
+    int64_t bytes() const
+    {
+        return impl_->bytes() + sizeof(impl_);
+    }
+
+    std::pair<Real, Real> domain() const
+    {
+        return impl_->domain();
+    }
+
     void push_back(Real x, Real y) {
         using std::abs;
         using std::isnan;
@@ -29,16 +29,51 @@ public:
         return impl_->operator()(x);
     }
 
+    // Starts the search for x's interval from hint, and leaves x's interval in hint:
+    Real operator()(Real x, std::size_t& hint) const
+    {
+        return impl_->operator()(x, hint);
+    }
+
+    // Evaluates at each abscissa in [first, last), fastest when they are sorted:
+    template<class InputIterator, class OutputIterator>
+    OutputIterator operator()(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        return impl_->operator()(first, last, out);
+    }
+
     Real prime(Real x) const
     {
         return impl_->prime(x);
     }
 
+    Real prime(Real x, std::size_t& hint) const
+    {
+        return impl_->prime(x, hint);
+    }
+
+    template<class InputIterator, class OutputIterator>
+    OutputIterator prime(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        return impl_->prime(first, last, out);
+    }
+
     Real double_prime(Real x) const
     {
         return impl_->double_prime(x);
     }
 
+    Real double_prime(Real x, std::size_t& hint) const
+    {
+        return impl_->double_prime(x, hint);
+    }
+
+    template<class InputIterator, class OutputIterator>
+    OutputIterator double_prime(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        return impl_->double_prime(first, last, out);
+    }
+
     friend std::ostream& operator<<(std::ostream & os, const quintic_hermite & m)
     {
         os << *m.impl_;
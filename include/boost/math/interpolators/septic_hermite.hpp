@@ -31,11 +31,35 @@ public:
         return impl_->operator()(x);
     }
 
+    // Starts the search for x's interval from hint, and leaves x's interval in hint:
+    inline Real operator()(Real x, std::size_t& hint) const
+    {
+        return impl_->operator()(x, hint);
+    }
+
+    // Evaluates at each abscissa in [first, last), fastest when they are sorted:
+    template<class InputIterator, class OutputIterator>
+    OutputIterator operator()(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        return impl_->operator()(first, last, out);
+    }
+
     inline Real prime(Real x) const
     {
         return impl_->prime(x);
     }
 
+    inline Real prime(Real x, std::size_t& hint) const
+    {
+        return impl_->prime(x, hint);
+    }
+
+    template<class InputIterator, class OutputIterator>
+    OutputIterator prime(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        return impl_->prime(first, last, out);
+    }
+
     inline Real double_prime(Real x) const
     {
         return impl_->double_prime(x);
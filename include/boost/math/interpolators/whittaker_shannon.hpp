@@ -5,6 +5,7 @@
 // or copy at http://www.boost.org/LICENSE_1_0.txt)
 #ifndef BOOST_MATH_INTERPOLATORS_WHITAKKER_SHANNON_HPP
 #define BOOST_MATH_INTERPOLATORS_WHITAKKER_SHANNON_HPP
+#include <limits>
 #include <memory>
 #include <boost/math/interpolators/detail/whittaker_shannon_detail.hpp>
 
@@ -29,6 +30,13 @@ public:
         return m_impl->prime(t);
     }
 
+    // Evaluates the interpolant at every point of [first, last), in O(n log n) operations plus a constant number for each point:
+    template<class ForwardIterator, class OutputIterator>
+    inline OutputIterator operator()(ForwardIterator first, ForwardIterator last, OutputIterator out, Real tol = std::numeric_limits<Real>::epsilon()) const
+    {
+        return m_impl->operator()(first, last, out, tol);
+    }
+
     inline Real operator[](size_t i) const
     {
         return m_impl->operator[](i);
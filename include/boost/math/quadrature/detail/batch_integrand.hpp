@@ -0,0 +1,177 @@
+//  Copyright 2020 Boost.Math contributors
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_QUADRATURE_DETAIL_BATCH_INTEGRAND_HPP
+#define BOOST_MATH_QUADRATURE_DETAIL_BATCH_INTEGRAND_HPP
+
+#include <cstddef>
+#include <vector>
+#include <boost/math/special_functions/sign.hpp>
+
+namespace boost{ namespace math{ namespace quadrature { namespace detail{
+
+//
+// exp_sinh_detail and sinh_sinh_detail obtain the values of the integrand through one
+// of these.  Before summing a row the integrator passes all of its abscissas to evaluate
+// (or to evaluate_symmetric, when it needs f(x) and f(-x)), and then asks for the value at
+// each abscissa in turn, by position and value.
+//
+// point_integrand ignores the call to evaluate and calls f(x) once per value requested,
+// so abscissas the integrator never asks for are never evaluated.
+//
+template<class F, class K>
+class point_integrand
+{
+public:
+   explicit point_integrand(const F& f) : m_f(f) {}
+
+   template<class Real>
+   void evaluate(const Real*, std::size_t) {}
+   template<class Real>
+   void evaluate_symmetric(const Real*, std::size_t) {}
+
+   template<class Real>
+   K operator()(std::size_t, const Real& x)const { return m_f(x); }
+   template<class Real>
+   K reflected(std::size_t, const Real& x)const { return m_f(-x); }
+
+private:
+   const F& m_f;
+};
+
+//
+// batch_integrand calls f(x, y, n) once for each row, which must set y[i] = f(x[i]) for
+// all i < n.  The whole row is evaluated, including any abscissas beyond the point at
+// which the integrator stops summing.
+//
+template<class Real, class F>
+class batch_integrand
+{
+public:
+   explicit batch_integrand(const F& f) : m_f(f), m_reflected(0) {}
+
+   void evaluate(const Real* x, std::size_t n)
+   {
+      m_y.resize(n);
+      if (n)
+         m_f(x, &m_y[0], n);
+   }
+   // Evaluates f at each x[i] and each -x[i] in a single call:
+   void evaluate_symmetric(const Real* x, std::size_t n)
+   {
+      m_x.resize(2 * n);
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         m_x[i] = x[i];
+         m_x[n + i] = -x[i];
+      }
+      evaluate(m_x.data(), 2 * n);
+      m_reflected = n;
+   }
+
+   Real operator()(std::size_t j, const Real&)const { return m_y[j]; }
+   Real reflected(std::size_t j, const Real&)const { return m_y[m_reflected + j]; }
+
+private:
+   const F& m_f;
+   std::vector<Real> m_x, m_y;
+   std::size_t m_reflected;
+};
+
+//
+// The equivalents for tanh_sinh_detail, whose integrand is f(x, xc) with xc the distance
+// from x to the nearest endpoint (negative when that is -1).  Abscissas close to 1 are
+// stored as x - 1, which is recognisable by being negative.  Each row is evaluated on the
+// right at row[j] for first <= j < right_end and on the left, at the reflected abscissa,
+// for first <= j < left_end: those bounds are the ones the integrator will actually use, so
+// in this case the batch version performs exactly the same evaluations as the point version.
+//
+template<class F, class K>
+class tanh_sinh_point_integrand
+{
+public:
+   explicit tanh_sinh_point_integrand(const F& f) : m_f(f) {}
+
+   template<class Real>
+   void evaluate_row(const std::vector<Real>&, std::size_t, std::size_t, std::size_t) {}
+
+   template<class Real>
+   K center(const Real& x) { return m_f(x, Real(1)); }
+   template<class Real>
+   K right(std::size_t, const Real& x, const Real& xc)const { return m_f(x, -xc); }
+   template<class Real>
+   K left(std::size_t, const Real& x, const Real& xc)const { return m_f(-x, xc); }
+
+private:
+   const F& m_f;
+};
+
+//
+// Calls f(x, xc, y, n) once per row, which must set y[i] = f(x[i], xc[i]) for all i < n:
+//
+template<class Real, class F>
+class tanh_sinh_batch_integrand
+{
+public:
+   explicit tanh_sinh_batch_integrand(const F& f) : m_f(f), m_first(0), m_left(0) {}
+
+   void evaluate_row(const std::vector<Real>& row, std::size_t first, std::size_t right_end, std::size_t left_end)
+   {
+      m_x.clear();
+      m_xc.clear();
+      for (std::size_t j = first; j < right_end; ++j)
+      {
+         Real x, xc;
+         split(row[j], x, xc);
+         m_x.push_back(x);
+         m_xc.push_back(-xc);
+      }
+      for (std::size_t j = first; j < left_end; ++j)
+      {
+         Real x, xc;
+         split(row[j], x, xc);
+         m_x.push_back(-x);
+         m_xc.push_back(xc);
+      }
+      m_first = first;
+      m_left = right_end > first ? right_end - first : 0;
+      m_y.resize(m_x.size());
+      if (m_x.size())
+         m_f(m_x.data(), m_xc.data(), m_y.data(), m_x.size());
+   }
+
+   Real center(const Real& x)
+   {
+      Real xc = 1;
+      Real y;
+      m_f(&x, &xc, &y, 1);
+      return y;
+   }
+   Real right(std::size_t j, const Real&, const Real&)const { return m_y[j - m_first]; }
+   Real left(std::size_t j, const Real&, const Real&)const { return m_y[m_left + j - m_first]; }
+
+private:
+   static void split(const Real& stored, Real& x, Real& xc)
+   {
+      if ((boost::math::signbit)(stored))
+      {
+         // We have stored x - 1:
+         xc = stored;
+         x = 1 + xc;
+      }
+      else
+      {
+         x = stored;
+         xc = x - 1;
+      }
+   }
+
+   const F& m_f;
+   std::vector<Real> m_x, m_xc, m_y;
+   std::size_t m_first, m_left;
+};
+
+}}}}
+#endif
@@ -0,0 +1,151 @@
+/*
+ * Copyright Nick Thompson, 2018
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef BOOST_MATH_QUADRATURE_DETAIL_MONTE_CARLO_DOMAIN_HPP
+#define BOOST_MATH_QUADRATURE_DETAIL_MONTE_CARLO_DOMAIN_HPP
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+#include <boost/math/policies/error_handling.hpp>
+
+namespace boost { namespace math { namespace quadrature { namespace detail {
+
+  enum class limit_classification {FINITE,
+                                   LOWER_BOUND_INFINITE,
+                                   UPPER_BOUND_INFINITE,
+                                   DOUBLE_INFINITE};
+
+// The map from the unit hypercube onto a box with finite or infinite bounds, shared by the Monte Carlo integrators.
+template<class Real, class Policy>
+class monte_carlo_domain
+{
+public:
+    monte_carlo_domain(std::vector<std::pair<Real, Real>> const & bounds, bool singular, const char* function)
+    {
+        using std::numeric_limits;
+        uint64_t n = bounds.size();
+        m_lbs.resize(n);
+        m_dxs.resize(n);
+        m_limit_types.resize(n);
+        m_volume = 1;
+        for (uint64_t i = 0; i < n; ++i)
+        {
+            if (bounds[i].second <= bounds[i].first)
+            {
+                boost::math::policies::raise_domain_error(function, "The upper bound is <= the lower bound.\n", bounds[i].second, Policy());
+                return;
+            }
+            if (bounds[i].first == -numeric_limits<Real>::infinity())
+            {
+                if (bounds[i].second == numeric_limits<Real>::infinity())
+                {
+                    m_limit_types[i] = detail::limit_classification::DOUBLE_INFINITE;
+                }
+                else
+                {
+                    m_limit_types[i] = detail::limit_classification::LOWER_BOUND_INFINITE;
+                    // Ok ok this is bad to use the second bound as the lower limit and then reflect.
+                    m_lbs[i] = bounds[i].second;
+                    m_dxs[i] = numeric_limits<Real>::quiet_NaN();
+                }
+            }
+            else if (bounds[i].second == numeric_limits<Real>::infinity())
+            {
+                m_limit_types[i] = detail::limit_classification::UPPER_BOUND_INFINITE;
+                if (singular)
+                {
+                    // I've found that it's easier to sample on a closed set and perturb the boundary
+                    // than to try to sample very close to the boundary.
+                    m_lbs[i] = std::nextafter(bounds[i].first, (std::numeric_limits<Real>::max)());
+                }
+                else
+                {
+                    m_lbs[i] = bounds[i].first;
+                }
+                m_dxs[i] = numeric_limits<Real>::quiet_NaN();
+            }
+            else
+            {
+                m_limit_types[i] = detail::limit_classification::FINITE;
+                if (singular)
+                {
+                    if (bounds[i].first == 0)
+                    {
+                        m_lbs[i] = std::numeric_limits<Real>::epsilon();
+                    }
+                    else
+                    {
+                        m_lbs[i] = std::nextafter(bounds[i].first, (std::numeric_limits<Real>::max)());
+                    }
+
+                    m_dxs[i] = std::nextafter(bounds[i].second, std::numeric_limits<Real>::lowest()) - m_lbs[i];
+                }
+                else
+                {
+                    m_lbs[i] = bounds[i].first;
+                    m_dxs[i] = bounds[i].second - bounds[i].first;
+                }
+                m_volume *= m_dxs[i];
+            }
+        }
+    }
+
+    uint64_t dimension() const
+    {
+        return m_lbs.size();
+    }
+
+    // Maps x from the unit hypercube into the domain, in place, and returns the volume element of the map:
+    Real transform(std::vector<Real> & x) const
+    {
+        using std::numeric_limits;
+        using std::sqrt;
+        Real coeff = m_volume;
+        for (uint64_t i = 0; i < x.size(); ++i)
+        {
+            // Variable transformation are listed at:
+            // https://en.wikipedia.org/wiki/Numerical_integration
+            // However, we've made some changes to these so that we can evaluate on a compact domain.
+            if (m_limit_types[i] == detail::limit_classification::FINITE)
+            {
+                x[i] = m_lbs[i] + x[i]*m_dxs[i];
+            }
+            else if (m_limit_types[i] == detail::limit_classification::UPPER_BOUND_INFINITE)
+            {
+                Real t = x[i];
+                Real z = 1/(1 + numeric_limits<Real>::epsilon() - t);
+                coeff *= (z*z)*(1 + numeric_limits<Real>::epsilon());
+                x[i] = m_lbs[i] + t*z;
+            }
+            else if (m_limit_types[i] == detail::limit_classification::LOWER_BOUND_INFINITE)
+            {
+                Real t = x[i];
+                Real z = 1/(t+sqrt((numeric_limits<Real>::min)()));
+                coeff *= (z*z);
+                x[i] = m_lbs[i] + (t-1)*z;
+            }
+            else
+            {
+                Real t1 = 1/(1+numeric_limits<Real>::epsilon() - x[i]);
+                Real t2 = 1/(x[i]+numeric_limits<Real>::epsilon());
+                x[i] = (2*x[i]-1)*t1*t2/4;
+                coeff *= (t1*t1+t2*t2)/4;
+            }
+        }
+        return coeff;
+    }
+
+private:
+    std::vector<Real> m_lbs;
+    std::vector<Real> m_dxs;
+    std::vector<detail::limit_classification> m_limit_types;
+    Real m_volume;
+};
+
+}}}}
+#endif
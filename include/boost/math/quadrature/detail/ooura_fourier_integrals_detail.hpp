@@ -5,9 +5,11 @@
 // or copy at http://www.boost.org/LICENSE_1_0.txt)
 #ifndef BOOST_MATH_QUADRATURE_DETAIL_OOURA_FOURIER_INTEGRALS_DETAIL_HPP
 #define BOOST_MATH_QUADRATURE_DETAIL_OOURA_FOURIER_INTEGRALS_DETAIL_HPP
+#include <algorithm>
 #include <utility> // for std::pair.
 #include <mutex>
 #include <atomic>
+#include <boost/math/quadrature/detail/table_io.hpp>
 #include <vector>
 #include <iostream>
 #include <boost/math/special_functions/expm1.hpp>
@@ -219,12 +221,54 @@ public:
         return lweights_;
     }
 
+    // Reads tables written by save:
+    ooura_fourier_sin_detail(std::istream& is, const Real relative_error_goal) {
+        if (relative_error_goal < std::numeric_limits<Real>::epsilon() * 2) {
+            throw std::domain_error("The relative error goal cannot be smaller than the unit roundoff.");
+        }
+        typedef quadrature_table_io<Real> io;
+        io::read_header(is, quadrature_table_kind::ooura_fourier_sin);
+        requested_levels_ = io::template read_integer<size_t>(is);
+        size_t levels = io::template read_integer<size_t>(is);
+        // Level i holds ~2^i values, so anything beyond a few dozen levels is nonsense, and integrate needs level 0:
+        if (levels == 0 || requested_levels_ > 64 || levels > requested_levels_ + 4) {
+            io::fail("The quadrature table is corrupt.");
+        }
+        starting_level_ = 0;
+        rel_err_goal_ = relative_error_goal;
+        big_nodes_.resize(levels);
+        bweights_.resize(levels);
+        little_nodes_.resize(levels);
+        lweights_.resize(levels);
+        for (size_t i = 0; i < levels; ++i) {
+            io::read_row(is, big_nodes_[i]);
+            io::read_row(is, bweights_[i]);
+            io::read_row(is, little_nodes_[i]);
+            io::read_row(is, lweights_[i]);
+            if (big_nodes_[i].size() != bweights_[i].size() || little_nodes_[i].size() != lweights_[i].size()) {
+                io::fail("The quadrature table is corrupt.");
+            }
+        }
+    }
+
+    // Writes all the levels computed so far:
+    void save(std::ostream& os) {
+        typedef quadrature_table_io<Real> io;
+        // Levels are only ever appended, under the lock:
+        std::lock_guard<std::mutex> lock(node_weight_mutex_);
+        io::write_header(os, quadrature_table_kind::ooura_fourier_sin);
+        io::write_integer(os, requested_levels_);
+        io::write_integer(os, big_nodes_.size());
+        for (size_t i = 0; i < big_nodes_.size(); ++i) {
+            io::write_row(os, big_nodes_[i]);
+            io::write_row(os, bweights_[i]);
+            io::write_row(os, little_nodes_[i]);
+            io::write_row(os, lweights_[i]);
+        }
+    }
+
     template<class F>
     std::pair<Real,Real> integrate(F const & f, Real omega) {
-        using std::abs;
-        using std::max;
-        using boost::math::constants::pi;
-
         if (omega == 0) {
             return {Real(0), Real(0)};
         }
@@ -232,13 +276,60 @@ public:
             auto p = this->integrate(f, -omega);
             return {-p.first, p.second};
         }
-
-        Real I1 = std::numeric_limits<Real>::quiet_NaN();
-        Real relative_error_estimate = std::numeric_limits<Real>::quiet_NaN();
         // As we compute integrals, we learn about their structure.
         // Assuming we compute f(t)sin(wt) for many different omega, this gives some
         // a posteriori ability to choose a refinement level that is roughly appropriate.
-        size_t i = starting_level_;
+        long level = starting_level_;
+        auto p = integrate_positive(f, omega, level);
+        starting_level_ = level;
+        return p;
+    }
+
+    // Integrates at each frequency in omegas, to the same tolerance as integrating at each in turn, but faster:
+    // the frequencies are taken in increasing order of magnitude, each starting at the level where its neighbour converged,
+    // and repeated magnitudes are only integrated once.
+    template<class F, class RandomAccessContainer>
+    auto integrate(F const & f, RandomAccessContainer const & omegas) -> decltype((void)omegas.size(), std::vector<std::pair<Real,Real>>()) {
+        using std::abs;
+        std::vector<size_t> order;
+        std::vector<std::pair<Real,Real>> results(omegas.size(), std::pair<Real,Real>(Real(0), Real(0)));
+        order.reserve(omegas.size());
+        for (size_t k = 0; k < omegas.size(); ++k) {
+            if (omegas[k] != 0) {
+                order.push_back(k);
+            }
+        }
+        std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return abs(omegas[a]) < abs(omegas[b]); });
+        long level = starting_level_;
+        for (size_t j = 0; j < order.size(); ++j) {
+            Real omega = abs(omegas[order[j]]);
+            std::pair<Real,Real> p;
+            if (j > 0 && omega == abs(omegas[order[j-1]])) {
+                p = results[order[j-1]];
+                p.first = omegas[order[j-1]] < 0 ? -p.first : p.first;
+            }
+            else {
+                p = integrate_positive(f, omega, level);
+            }
+            // sin is odd in omega:
+            results[order[j]] = {omegas[order[j]] < 0 ? -p.first : p.first, p.second};
+        }
+        starting_level_ = level;
+        return results;
+    }
+
+private:
+
+    // Integrates at omega > 0 starting at the refinement level given, which is then updated to where the next integral should start:
+    template<class F>
+    std::pair<Real,Real> integrate_positive(F const & f, Real omega, long & level) {
+        using std::abs;
+        using std::max;
+        using boost::math::constants::pi;
+
+        Real I1 = std::numeric_limits<Real>::quiet_NaN();
+        Real relative_error_estimate = std::numeric_limits<Real>::quiet_NaN();
+        size_t i = level;
         do {
             Real I0 = estimate_integral(f, omega, i);
 #ifdef BOOST_MATH_INSTRUMENT_OOURA
@@ -247,7 +338,7 @@ public:
             Real absolute_error_estimate = abs(I0-I1);
             Real scale = (max)(abs(I0), abs(I1));
             if (!isnan(I1) && absolute_error_estimate <= rel_err_goal_*scale) {
-                starting_level_ = (max)(long(i) - 1, long(0));
+                level = (max)(long(i) - 1, long(0));
                 return {I0/omega, absolute_error_estimate/scale};
             }
             I1 = I0;
@@ -278,18 +369,17 @@ public:
             print_ooura_estimate(ii, I0, I1, omega);
 #endif
             if (absolute_error_estimate <= rel_err_goal_*scale) {
-                starting_level_ = (max)(long(ii) - 1, long(0));
+                level = (max)(long(ii) - 1, long(0));
                 return {I0/omega, absolute_error_estimate/scale};
             }
             I1 = I0;
             ++ii;
         }
 
-        starting_level_ = static_cast<long>(big_nodes_.size() - 2);
+        level = static_cast<long>(big_nodes_.size() - 2);
         return {I1/omega, relative_error_estimate};
     }
 
-private:
 
     template<class PreciseReal>
     void add_level(size_t i) {
@@ -464,12 +554,54 @@ public:
 
     }
 
+    // Reads tables written by save:
+    ooura_fourier_cos_detail(std::istream& is, const Real relative_error_goal) {
+        if (relative_error_goal < std::numeric_limits<Real>::epsilon() * 2) {
+            throw std::domain_error("The relative error goal cannot be smaller than the unit roundoff.");
+        }
+        typedef quadrature_table_io<Real> io;
+        io::read_header(is, quadrature_table_kind::ooura_fourier_cos);
+        requested_levels_ = io::template read_integer<size_t>(is);
+        size_t levels = io::template read_integer<size_t>(is);
+        // Level i holds ~2^i values, so anything beyond a few dozen levels is nonsense, and integrate needs level 0:
+        if (levels == 0 || requested_levels_ > 64 || levels > requested_levels_ + 4) {
+            io::fail("The quadrature table is corrupt.");
+        }
+        starting_level_ = 0;
+        rel_err_goal_ = relative_error_goal;
+        big_nodes_.resize(levels);
+        bweights_.resize(levels);
+        little_nodes_.resize(levels);
+        lweights_.resize(levels);
+        for (size_t i = 0; i < levels; ++i) {
+            io::read_row(is, big_nodes_[i]);
+            io::read_row(is, bweights_[i]);
+            io::read_row(is, little_nodes_[i]);
+            io::read_row(is, lweights_[i]);
+            if (big_nodes_[i].size() != bweights_[i].size() || little_nodes_[i].size() != lweights_[i].size()) {
+                io::fail("The quadrature table is corrupt.");
+            }
+        }
+    }
+
+    // Writes all the levels computed so far:
+    void save(std::ostream& os) {
+        typedef quadrature_table_io<Real> io;
+        // Levels are only ever appended, under the lock:
+        std::lock_guard<std::mutex> lock(node_weight_mutex_);
+        io::write_header(os, quadrature_table_kind::ooura_fourier_cos);
+        io::write_integer(os, requested_levels_);
+        io::write_integer(os, big_nodes_.size());
+        for (size_t i = 0; i < big_nodes_.size(); ++i) {
+            io::write_row(os, big_nodes_[i]);
+            io::write_row(os, bweights_[i]);
+            io::write_row(os, little_nodes_[i]);
+            io::write_row(os, lweights_[i]);
+        }
+    }
+
     template<class F>
     std::pair<Real,Real> integrate(F const & f, Real omega) {
-        using std::abs;
-        using std::max;
-        using boost::math::constants::pi;
-
         if (omega == 0) {
             throw std::domain_error("At omega = 0, the integral is not oscillatory. The user must choose an appropriate method for this case.\n");
         }
@@ -477,11 +609,52 @@ public:
         if (omega < 0) {
             return this->integrate(f, -omega);
         }
+        long level = starting_level_;
+        auto p = integrate_positive(f, omega, level);
+        starting_level_ = level;
+        return p;
+    }
+
+    // Integrates at each frequency in omegas, as for ooura_fourier_sin_detail:
+    template<class F, class RandomAccessContainer>
+    auto integrate(F const & f, RandomAccessContainer const & omegas) -> decltype((void)omegas.size(), std::vector<std::pair<Real,Real>>()) {
+        using std::abs;
+        std::vector<size_t> order(omegas.size());
+        std::vector<std::pair<Real,Real>> results(omegas.size());
+        for (size_t k = 0; k < omegas.size(); ++k) {
+            if (omegas[k] == 0) {
+                throw std::domain_error("At omega = 0, the integral is not oscillatory. The user must choose an appropriate method for this case.\n");
+            }
+            order[k] = k;
+        }
+        std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return abs(omegas[a]) < abs(omegas[b]); });
+        long level = starting_level_;
+        for (size_t j = 0; j < order.size(); ++j) {
+            Real omega = abs(omegas[order[j]]);
+            // cos is even in omega:
+            if (j > 0 && omega == abs(omegas[order[j-1]])) {
+                results[order[j]] = results[order[j-1]];
+            }
+            else {
+                results[order[j]] = integrate_positive(f, omega, level);
+            }
+        }
+        starting_level_ = level;
+        return results;
+    }
+
+private:
+
+    template<class F>
+    std::pair<Real,Real> integrate_positive(F const & f, Real omega, long & level) {
+        using std::abs;
+        using std::max;
+        using boost::math::constants::pi;
 
         Real I1 = std::numeric_limits<Real>::quiet_NaN();
         Real absolute_error_estimate = std::numeric_limits<Real>::quiet_NaN();
         Real scale = std::numeric_limits<Real>::quiet_NaN();
-        size_t i = starting_level_;
+        size_t i = level;
         do {
             Real I0 = estimate_integral(f, omega, i);
 #ifdef BOOST_MATH_INSTRUMENT_OOURA
@@ -490,7 +663,7 @@ public:
             absolute_error_estimate = abs(I0-I1);
             scale = (max)(abs(I0), abs(I1));
             if (!isnan(I1) && absolute_error_estimate <= rel_err_goal_*scale) {
-                starting_level_ = (max)(long(i) - 1, long(0));
+                level = (max)(long(i) - 1, long(0));
                 return {I0/omega, absolute_error_estimate/scale};
             }
             I1 = I0;
@@ -515,18 +688,17 @@ public:
             absolute_error_estimate = abs(I0-I1);
             scale = (max)(abs(I0), abs(I1));
             if (absolute_error_estimate <= rel_err_goal_*scale) {
-                starting_level_ = (max)(long(ii) - 1, long(0));
+                level = (max)(long(ii) - 1, long(0));
                 return {I0/omega, absolute_error_estimate/scale};
             }
             I1 = I0;
             ++ii;
         }
 
-        starting_level_ = static_cast<long>(big_nodes_.size() - 2);
+        level = static_cast<long>(big_nodes_.size() - 2);
         return {I1/omega, absolute_error_estimate/scale};
     }
 
-private:
 
     template<class PreciseReal>
     void add_level(size_t i) {
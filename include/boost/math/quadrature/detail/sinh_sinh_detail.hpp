@@ -13,6 +13,9 @@
 #include <typeinfo>
 #include <boost/math/constants/constants.hpp>
 #include <boost/math/tools/atomic.hpp>
+#include <boost/math/tools/cache_statistics.hpp>
+#include <boost/math/quadrature/detail/batch_integrand.hpp>
+#include <boost/math/quadrature/detail/table_io.hpp>
 #include <boost/detail/lightweight_mutex.hpp>
 #include <boost/math/policies/error_handling.hpp>
 #include <boost/math/special_functions/trunc.hpp>
@@ -41,36 +44,62 @@ class sinh_sinh_detail
       0;
 public:
     sinh_sinh_detail(size_t max_refinements);
+    // Reads tables written by save:
+    explicit sinh_sinh_detail(std::istream& is);
 
     template<class F>
-    auto integrate(const F f, Real tolerance, Real* error, Real* L1, std::size_t* levels)->decltype(std::declval<F>()(std::declval<Real>())) const;
+    auto integrate(const F f, Real tolerance, Real* error, Real* L1, std::size_t* levels)->decltype(std::declval<F>()(std::declval<Real>())) const
+    {
+       point_integrand<F, decltype(std::declval<F>()(std::declval<Real>()))> integrand(f);
+       return integrate_imp(integrand, tolerance, error, L1, levels);
+    }
+    // As above, but f(x, y, n) evaluates a whole row of abscissas at once:
+    template<class F>
+    Real integrate_batch(const F& f, Real tolerance, Real* error, Real* L1, std::size_t* levels) const
+    {
+       batch_integrand<Real, F> integrand(f);
+       return integrate_imp(integrand, tolerance, error, L1, levels);
+    }
+
+    // Computes rows up to and including row n now rather than on first use, and
+    // returns the number of the last row available:
+    std::size_t reserve_refinements(std::size_t n)const
+    {
+       n = (std::min)(n, (std::min)(m_max_refinements, m_abscissas.size() - 1));
+       while (committed_refinements() < n)
+          extend_refinements();
+       return committed_refinements();
+    }
+
+    // Writes the parameters of the rule and all the rows computed so far:
+    void save(std::ostream& os)const;
+
+    tools::cache_statistics statistics()const
+    {
+#ifndef BOOST_MATH_NO_ATOMIC_INT
+       boost::detail::lightweight_mutex::scoped_lock guard(m_mutex);
+#endif
+       tools::cache_statistics result(m_statistics);
+       result.size = committed_refinements() + 1;
+       return result;
+    }
 
 private:
-private:
+   template<class Integrand>
+   auto integrate_imp(Integrand& f, Real tolerance, Real* error, Real* L1, std::size_t* levels) const ->decltype(f(0, std::declval<Real>()));
+
    const std::vector<Real>& get_abscissa_row(std::size_t n)const
    {
-#ifndef BOOST_MATH_NO_ATOMIC_INT
-      if (m_committed_refinements.load() < n)
+      if (committed_refinements() < n)
          extend_refinements();
-      BOOST_ASSERT(m_committed_refinements.load() >= n);
-#else
-      if (m_committed_refinements < n)
-         extend_refinements();
-      BOOST_ASSERT(m_committed_refinements >= n);
-#endif
+      BOOST_ASSERT(committed_refinements() >= n);
       return m_abscissas[n];
    }
    const std::vector<Real>& get_weight_row(std::size_t n)const
    {
-#ifndef BOOST_MATH_NO_ATOMIC_INT
-      if (m_committed_refinements.load() < n)
+      if (committed_refinements() < n)
          extend_refinements();
-      BOOST_ASSERT(m_committed_refinements.load() >= n);
-#else
-      if (m_committed_refinements < n)
-         extend_refinements();
-      BOOST_ASSERT(m_committed_refinements >= n);
-#endif
+      BOOST_ASSERT(committed_refinements() >= n);
       return m_weights[n];
    }
    void init(const boost::integral_constant<int, 0>&);
@@ -81,6 +110,24 @@ private:
    void init(const boost::integral_constant<int, 4>&);
 #endif
 
+   std::size_t committed_refinements()const
+   {
+      // Rows up to the value returned are complete, and may be read without the lock:
+#ifndef BOOST_MATH_NO_ATOMIC_INT
+      return m_committed_refinements.load(BOOST_MATH_ATOMIC_NS::memory_order_acquire);
+#else
+      return m_committed_refinements;
+#endif
+   }
+   // Publishes a newly completed row to the readers above:
+   void commit_refinements(std::size_t row)const
+   {
+#ifndef BOOST_MATH_NO_ATOMIC_INT
+      m_committed_refinements.store(static_cast<boost::math::detail::atomic_unsigned_integer_type>(row), BOOST_MATH_ATOMIC_NS::memory_order_release);
+#else
+      m_committed_refinements = static_cast<unsigned>(row);
+#endif
+   }
    void extend_refinements()const
    {
 #ifndef BOOST_MATH_NO_ATOMIC_INT
@@ -89,13 +136,11 @@ private:
       //
       // Check some other thread hasn't got here after we read the atomic variable, but before we got here:
       //
-#ifndef BOOST_MATH_NO_ATOMIC_INT
-      if (m_committed_refinements.load() >= m_max_refinements)
-         return;
-#else
-      if (m_committed_refinements >= m_max_refinements)
+      std::size_t row = committed_refinements();
+      if (row >= m_max_refinements)
          return;
-#endif
+      ++row;
+      tools::detail::cache_growth_timer timer(m_statistics);
 
       using std::ldexp;
       using std::ceil;
@@ -104,8 +149,6 @@ private:
       using std::exp;
       using constants::half_pi;
 
-      std::size_t row = ++m_committed_refinements;
-
       Real h = ldexp(Real(1), -static_cast<int>(row));
       size_t k = (size_t)boost::math::lltrunc(ceil(m_t_max / (2 * h)));
       m_abscissas[row].reserve(k);
@@ -120,6 +163,7 @@ private:
          m_weights[row].emplace_back(w);
          arg += 2 * h;
       }
+      commit_refinements(row);
    }
 
    Real m_t_max;
@@ -127,6 +171,7 @@ private:
    mutable std::vector<std::vector<Real>> m_abscissas;
    mutable std::vector<std::vector<Real>> m_weights;
    std::size_t                       m_max_refinements;
+   mutable tools::cache_statistics   m_statistics;
 #ifndef BOOST_MATH_NO_ATOMIC_INT
    mutable boost::math::detail::atomic_unsigned_type      m_committed_refinements;
    mutable boost::detail::lightweight_mutex m_mutex;
@@ -137,14 +182,62 @@ private:
 
 template<class Real, class Policy>
 sinh_sinh_detail<Real, Policy>::sinh_sinh_detail(size_t max_refinements)
-   : m_abscissas(max_refinements), m_weights(max_refinements), m_max_refinements(max_refinements)
+   : m_abscissas(max_refinements + 1), m_weights(max_refinements + 1), m_max_refinements(max_refinements)
 {
+   // The initial rows count as the first growth event:
+   tools::detail::cache_growth_timer timer(m_statistics);
    init(boost::integral_constant<int, initializer_selector>());
 }
 
 template<class Real, class Policy>
-template<class F>
-auto sinh_sinh_detail<Real, Policy>::integrate(const F f, Real tolerance, Real* error, Real* L1, std::size_t* levels)->decltype(std::declval<F>()(std::declval<Real>())) const
+sinh_sinh_detail<Real, Policy>::sinh_sinh_detail(std::istream& is)
+{
+   typedef quadrature_table_io<Real> io;
+   // Loading the rows counts as a growth event, so the statistics show how long it took:
+   tools::detail::cache_growth_timer timer(m_statistics);
+   io::read_header(is, quadrature_table_kind::sinh_sinh);
+   m_max_refinements = io::template read_integer<std::size_t>(is);
+   m_t_max = io::read_value(is);
+   std::size_t rows = io::template read_integer<std::size_t>(is);
+   // Row n holds ~2^n values, so anything beyond a few dozen rows is nonsense:
+   if ((m_max_refinements > 64) || (rows == 0) || (rows > m_max_refinements + 1))
+      io::fail("The quadrature table is corrupt.");
+   m_abscissas.assign(m_max_refinements + 1, std::vector<Real>());
+   m_weights.assign(m_max_refinements + 1, std::vector<Real>());
+   for (std::size_t row = 0; row < rows; ++row)
+   {
+      io::read_row(is, m_abscissas[row]);
+      io::read_row(is, m_weights[row]);
+      if ((m_weights[row].size() != m_abscissas[row].size()) || m_abscissas[row].empty())
+         io::fail("The quadrature table is corrupt.");
+   }
+#ifndef BOOST_MATH_NO_ATOMIC_INT
+   m_committed_refinements = static_cast<boost::math::detail::atomic_unsigned_integer_type>(rows - 1);
+#else
+   m_committed_refinements = static_cast<unsigned>(rows - 1);
+#endif
+}
+
+template<class Real, class Policy>
+void sinh_sinh_detail<Real, Policy>::save(std::ostream& os)const
+{
+   typedef quadrature_table_io<Real> io;
+   // Committed rows are never modified, so we can write them without the lock:
+   std::size_t rows = committed_refinements() + 1;
+   io::write_header(os, quadrature_table_kind::sinh_sinh);
+   io::write_integer(os, m_max_refinements);
+   io::write_value(os, m_t_max);
+   io::write_integer(os, rows);
+   for (std::size_t row = 0; row < rows; ++row)
+   {
+      io::write_row(os, m_abscissas[row]);
+      io::write_row(os, m_weights[row]);
+   }
+}
+
+template<class Real, class Policy>
+template<class Integrand>
+auto sinh_sinh_detail<Real, Policy>::integrate_imp(Integrand& f, Real tolerance, Real* error, Real* L1, std::size_t* levels) const ->decltype(f(0, std::declval<Real>()))
 {
     using std::abs;
     using std::sqrt;
@@ -153,15 +246,17 @@ auto sinh_sinh_detail<Real, Policy>::integrate(const F f, Real tolerance, Real*
 
     static const char* function = "boost::math::quadrature::sinh_sinh<%1%>::integrate";
 
-    typedef decltype(f(Real(0))) K;
-    K y_max = f(boost::math::tools::max_value<Real>());
+    typedef decltype(f(0, Real(0))) K;
+    Real limits[2] = { boost::math::tools::max_value<Real>(), -boost::math::tools::max_value<Real>() };
+    f.evaluate(limits, 2);
+    K y_max = f(0, limits[0]);
     if(abs(y_max) > boost::math::tools::epsilon<Real>())
     {
         return static_cast<K>(policies::raise_domain_error(function,
            "The function you are trying to integrate does not go to zero at infinity, and instead evaluates to %1%", y_max, Policy()));
     }
 
-    K y_min = f(-boost::math::tools::max_value<Real>());
+    K y_min = f(1, limits[1]);
     if(abs(y_min) > boost::math::tools::epsilon<Real>())
     {
         return static_cast<K>(policies::raise_domain_error(function,
@@ -169,13 +264,16 @@ auto sinh_sinh_detail<Real, Policy>::integrate(const F f, Real tolerance, Real*
     }
 
     // Get the party started with two estimates of the integral:
-    K I0 = f(0)*half_pi<Real>();
+    Real zero = 0;
+    f.evaluate(&zero, 1);
+    K I0 = f(0, zero)*half_pi<Real>();
     Real L1_I0 = abs(I0);
+    f.evaluate_symmetric(m_abscissas[0].data(), m_abscissas[0].size());
     for(size_t i = 0; i < m_abscissas[0].size(); ++i)
     {
         Real x = m_abscissas[0][i];
-        K yp = f(x);
-        K ym = f(-x);
+        K yp = f(i, x);
+        K ym = f.reflected(i, x);
         I0 += (yp + ym)*m_weights[0][i];
         L1_I0 += (abs(yp)+abs(ym))*m_weights[0][i];
     }
@@ -185,11 +283,12 @@ auto sinh_sinh_detail<Real, Policy>::integrate(const F f, Real tolerance, Real*
     // std::cout << "First estimate : " << I0 << std::endl;
     K I1 = I0;
     Real L1_I1 = L1_I0;
+    f.evaluate_symmetric(m_abscissas[1].data(), m_abscissas[1].size());
     for (size_t i = 0; i < m_abscissas[1].size(); ++i)
     {
         Real x= m_abscissas[1][i];
-        K yp = f(x);
-        K ym = f(-x);
+        K yp = f(i, x);
+        K ym = f.reflected(i, x);
         I1 += (yp + ym)*m_weights[1][i];
         L1_I1 += (abs(yp) + abs(ym))*m_weights[1][i];
     }
@@ -214,14 +313,15 @@ auto sinh_sinh_detail<Real, Policy>::integrate(const F f, Real tolerance, Real*
         Real abterm1 = 1;
         Real eps = boost::math::tools::epsilon<Real>()*L1_I1;
 
-        auto abscissa_row = get_abscissa_row(i);
-        auto weight_row = get_weight_row(i);
+        auto const& abscissa_row = get_abscissa_row(i);
+        auto const& weight_row = get_weight_row(i);
+        f.evaluate_symmetric(abscissa_row.data(), abscissa_row.size());
 
         for(size_t j = 0; j < abscissa_row.size(); ++j)
         {
             Real x = abscissa_row[j];
-            K yp = f(x);
-            K ym = f(-x);
+            K yp = f(j, x);
+            K ym = f.reflected(j, x);
             sum += (yp + ym)*weight_row[j];
             Real abterm0 = (abs(yp) + abs(ym))*weight_row[j];
             absum += abterm0;
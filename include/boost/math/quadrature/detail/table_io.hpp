@@ -0,0 +1,213 @@
+// Copyright Boost.Math contributors, 2020
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_QUADRATURE_DETAIL_TABLE_IO_HPP
+#define BOOST_MATH_QUADRATURE_DETAIL_TABLE_IO_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <boost/throw_exception.hpp>
+#include <boost/math/tools/precision.hpp>
+
+namespace boost{ namespace math{ namespace quadrature { namespace detail{
+
+//
+// Reading and writing the abscissa and weight tables of the quadrature classes, so that they can be
+// computed once and then loaded by later processes far faster than they could be recomputed.
+//
+// A file starts with a header which identifies the rule and the type, so that we never load
+// a table into the wrong class.  Then follow the parameters of the rule and its rows, each a length
+// followed by the values.  Builtin floating point types are stored as their bytes, which is
+// compact but only readable on machines of the same architecture; any other type is stored as
+// decimal strings with enough digits to round trip.
+//
+enum class quadrature_table_kind : std::uint32_t
+{
+   tanh_sinh = 1,
+   exp_sinh = 2,
+   sinh_sinh = 3,
+   ooura_fourier_sin = 4,
+   ooura_fourier_cos = 5
+};
+
+template<class Real>
+class quadrature_table_io
+{
+public:
+   static const bool raw = std::is_floating_point<Real>::value;
+
+   static void write_header(std::ostream& os, quadrature_table_kind kind)
+   {
+      os.write(magic(), 8);
+      write_integer(os, byte_order_mark());
+      write_integer(os, format_version());
+      write_integer(os, static_cast<std::uint32_t>(kind));
+      write_integer(os, static_cast<std::uint32_t>(raw ? sizeof(Real) : 0));
+      write_integer(os, static_cast<std::uint32_t>(boost::math::tools::digits<Real>()));
+      check(os);
+   }
+
+   static void read_header(std::istream& is, quadrature_table_kind kind)
+   {
+      char m[8];
+      is.read(m, 8);
+      check(is);
+      if (std::memcmp(m, magic(), 8) != 0)
+         fail("The stream does not contain a quadrature table.");
+      if (read_integer<std::uint32_t>(is) != byte_order_mark())
+         fail("The quadrature table was written on a machine with a different byte order.");
+      if (read_integer<std::uint32_t>(is) != format_version())
+         fail("The quadrature table was written in an unsupported format.");
+      if (read_integer<std::uint32_t>(is) != static_cast<std::uint32_t>(kind))
+         fail("The quadrature table is for a different quadrature rule.");
+      if (read_integer<std::uint32_t>(is) != static_cast<std::uint32_t>(raw ? sizeof(Real) : 0))
+         fail("The quadrature table is for a different type.");
+      if (read_integer<std::uint32_t>(is) != static_cast<std::uint32_t>(boost::math::tools::digits<Real>()))
+         fail("The quadrature table is for a type of different precision.");
+   }
+
+   template<class I>
+   static void write_integer(std::ostream& os, I i)
+   {
+      std::uint64_t u = static_cast<std::uint64_t>(i);
+      os.write(reinterpret_cast<const char*>(&u), sizeof(u));
+   }
+
+   template<class I>
+   static I read_integer(std::istream& is)
+   {
+      std::uint64_t u;
+      is.read(reinterpret_cast<char*>(&u), sizeof(u));
+      check(is);
+      return static_cast<I>(u);
+   }
+
+   static void write_value(std::ostream& os, const Real& x)
+   {
+      write_values(os, &x, 1);
+   }
+
+   static Real read_value(std::istream& is)
+   {
+      Real x;
+      read_values(is, &x, 1);
+      return x;
+   }
+
+   static void write_row(std::ostream& os, const std::vector<Real>& row)
+   {
+      write_integer(os, row.size());
+      write_values(os, row.data(), row.size());
+   }
+
+   static void read_row(std::istream& is, std::vector<Real>& row)
+   {
+      std::size_t n = read_integer<std::size_t>(is);
+      // Check the stream holds as many values as claimed before allocating room for them,
+      // a decimal string takes at least its length and one character:
+      std::streampos here = is.tellg();
+      if (here != std::streampos(-1))
+      {
+         is.seekg(0, std::ios_base::end);
+         std::streamoff remaining = is.tellg() - here;
+         is.seekg(here);
+         std::size_t value_size = raw ? sizeof(Real) : sizeof(std::uint64_t) + 1;
+         if (remaining < 0 || static_cast<std::size_t>(remaining) / value_size < n)
+            fail("The quadrature table is truncated.");
+      }
+      row.resize(n);
+      read_values(is, row.data(), n);
+   }
+
+   static void check(const std::ios& s)
+   {
+      if (!s)
+         fail("Reading or writing the quadrature table failed.");
+   }
+
+   static void fail(const char* message)
+   {
+      BOOST_THROW_EXCEPTION(std::runtime_error(message));
+   }
+
+private:
+   static const char* magic()
+   {
+      return "BMQTABLE";
+   }
+   static std::uint32_t byte_order_mark()
+   {
+      return 0x01020304u;
+   }
+   static std::uint32_t format_version()
+   {
+      return 1u;
+   }
+   static void write_values(std::ostream& os, const Real* x, std::size_t n)
+   {
+      if (raw)
+      {
+         os.write(reinterpret_cast<const char*>(x), static_cast<std::streamsize>(n * sizeof(Real)));
+      }
+      else
+      {
+         std::ostringstream ss;
+         ss.precision(std::numeric_limits<Real>::max_digits10 ? std::numeric_limits<Real>::max_digits10 : 2 + boost::math::tools::digits<Real>() * 30103UL / 100000UL);
+         ss.setf(std::ios_base::scientific, std::ios_base::floatfield);
+         for (std::size_t i = 0; i < n; ++i)
+         {
+            ss.str(std::string());
+            ss << x[i];
+            std::string s = ss.str();
+            write_integer(os, s.size());
+            os.write(s.data(), static_cast<std::streamsize>(s.size()));
+         }
+      }
+      check(os);
+   }
+
+   static void read_values(std::istream& is, Real* x, std::size_t n)
+   {
+      if (raw)
+      {
+         is.read(reinterpret_cast<char*>(x), static_cast<std::streamsize>(n * sizeof(Real)));
+         check(is);
+      }
+      else
+      {
+         std::string s;
+         for (std::size_t i = 0; i < n; ++i)
+         {
+            std::size_t length = read_integer<std::size_t>(is);
+            // No value needs more than a few hundred characters:
+            if (length > 100000)
+               fail("The quadrature table is corrupt.");
+            s.resize(length);
+            is.read(&s[0], static_cast<std::streamsize>(length));
+            check(is);
+            std::istringstream ss(s);
+            ss >> x[i];
+            if (!ss)
+               fail("The quadrature table is corrupt.");
+            // The tables use the sign of zero, which not every type preserves when reading a string:
+            if ((x[i] == 0) && (s[0] == '-'))
+               x[i] = -x[i];
+         }
+      }
+   }
+};
+
+}}}} // namespaces
+
+#endif
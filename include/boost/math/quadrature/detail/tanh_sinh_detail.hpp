@@ -10,6 +10,9 @@
 #include <cmath>
 #include <vector>
 #include <boost/math/tools/atomic.hpp>
+#include <boost/math/tools/cache_statistics.hpp>
+#include <boost/math/quadrature/detail/batch_integrand.hpp>
+#include <boost/math/quadrature/detail/table_io.hpp>
 #include <boost/detail/lightweight_mutex.hpp>
 #include <typeinfo>
 #include <boost/math/constants/constants.hpp>
@@ -41,50 +44,73 @@ public:
     tanh_sinh_detail(size_t max_refinements, const Real& min_complement) : m_max_refinements(max_refinements)
     {
        typedef boost::integral_constant<int, initializer_selector> tag_type;
+       // The initial rows count as the first growth event:
+       tools::detail::cache_growth_timer timer(m_statistics);
        init(min_complement, tag_type());
     }
+    // Reads tables written by save:
+    explicit tanh_sinh_detail(std::istream& is);
 
     template<class F>
-    decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) integrate(const F f, Real* error, Real* L1, const char* function, Real left_min_complement, Real right_min_complement, Real tolerance, std::size_t* levels) const;
+    decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) integrate(const F f, Real* error, Real* L1, const char* function, Real left_min_complement, Real right_min_complement, Real tolerance, std::size_t* levels) const
+    {
+       tanh_sinh_point_integrand<F, decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>()))> integrand(f);
+       return integrate_imp(integrand, error, L1, function, left_min_complement, right_min_complement, tolerance, levels);
+    }
+    // As above, but f(x, xc, y, n) evaluates a whole row of abscissas at once:
+    template<class F>
+    Real integrate_batch(const F& f, Real* error, Real* L1, const char* function, Real left_min_complement, Real right_min_complement, Real tolerance, std::size_t* levels) const
+    {
+       tanh_sinh_batch_integrand<Real, F> integrand(f);
+       return integrate_imp(integrand, error, L1, function, left_min_complement, right_min_complement, tolerance, levels);
+    }
+
+    // Computes rows up to and including row n now rather than on first use, and
+    // returns the number of the last row available:
+    std::size_t reserve_refinements(std::size_t n)const
+    {
+       n = (std::min)(n, (std::min)(m_max_refinements, m_abscissas.size() - 1));
+       while (committed_refinements() < n)
+          extend_refinements();
+       return committed_refinements();
+    }
+
+    // Writes the parameters of the rule and all the rows computed so far:
+    void save(std::ostream& os)const;
+
+    tools::cache_statistics statistics()const
+    {
+#ifndef BOOST_MATH_NO_ATOMIC_INT
+       boost::detail::lightweight_mutex::scoped_lock guard(m_mutex);
+#endif
+       tools::cache_statistics result(m_statistics);
+       result.size = committed_refinements() + 1;
+       return result;
+    }
 
 private:
+   template<class Integrand>
+   auto integrate_imp(Integrand& f, Real* error, Real* L1, const char* function, Real left_min_complement, Real right_min_complement, Real tolerance, std::size_t* levels) const ->decltype(f.center(std::declval<Real>()));
+
    const std::vector<Real>& get_abscissa_row(std::size_t n)const
    {
-#ifndef BOOST_MATH_NO_ATOMIC_INT
-      if (m_committed_refinements.load() < n)
+      if (committed_refinements() < n)
          extend_refinements();
-      BOOST_ASSERT(m_committed_refinements.load() >= n);
-#else
-      if (m_committed_refinements < n)
-         extend_refinements();
-      BOOST_ASSERT(m_committed_refinements >= n);
-#endif
+      BOOST_ASSERT(committed_refinements() >= n);
       return m_abscissas[n];
    }
    const std::vector<Real>& get_weight_row(std::size_t n)const
    {
-#ifndef BOOST_MATH_NO_ATOMIC_INT
-      if (m_committed_refinements.load() < n)
+      if (committed_refinements() < n)
          extend_refinements();
-      BOOST_ASSERT(m_committed_refinements.load() >= n);
-#else
-      if (m_committed_refinements < n)
-         extend_refinements();
-      BOOST_ASSERT(m_committed_refinements >= n);
-#endif
+      BOOST_ASSERT(committed_refinements() >= n);
       return m_weights[n];
    }
    std::size_t get_first_complement_index(std::size_t n)const
    {
-#ifndef BOOST_MATH_NO_ATOMIC_INT
-      if (m_committed_refinements.load() < n)
+      if (committed_refinements() < n)
          extend_refinements();
-      BOOST_ASSERT(m_committed_refinements.load() >= n);
-#else
-      if (m_committed_refinements < n)
-         extend_refinements();
-      BOOST_ASSERT(m_committed_refinements >= n);
-#endif
+      BOOST_ASSERT(committed_refinements() >= n);
       return m_first_complements[n];
    }
 
@@ -96,6 +122,24 @@ private:
    void init(const Real& min_complement, const boost::integral_constant<int, 4>&);
 #endif
    void prune_to_min_complement(const Real& m);
+   std::size_t committed_refinements()const
+   {
+      // Rows up to the value returned are complete, and may be read without the lock:
+#ifndef BOOST_MATH_NO_ATOMIC_INT
+      return m_committed_refinements.load(BOOST_MATH_ATOMIC_NS::memory_order_acquire);
+#else
+      return m_committed_refinements;
+#endif
+   }
+   // Publishes a newly completed row to the readers above:
+   void commit_refinements(std::size_t row)const
+   {
+#ifndef BOOST_MATH_NO_ATOMIC_INT
+      m_committed_refinements.store(static_cast<boost::math::detail::atomic_unsigned_integer_type>(row), BOOST_MATH_ATOMIC_NS::memory_order_release);
+#else
+      m_committed_refinements = static_cast<unsigned>(row);
+#endif
+   }
    void extend_refinements()const
    {
 #ifndef BOOST_MATH_NO_ATOMIC_INT
@@ -104,22 +148,14 @@ private:
       //
       // Check some other thread hasn't got here after we read the atomic variable, but before we got here:
       //
-#ifndef BOOST_MATH_NO_ATOMIC_INT
-      if (m_committed_refinements.load() >= m_max_refinements)
-         return;
-#else
-      if (m_committed_refinements >= m_max_refinements)
+      std::size_t row = committed_refinements();
+      if (row >= m_max_refinements)
          return;
-#endif
+      ++row;
+      tools::detail::cache_growth_timer timer(m_statistics);
 
       using std::ldexp;
       using std::ceil;
-      ++m_committed_refinements;
-#ifndef BOOST_MATH_NO_ATOMIC_INT
-      std::size_t row = m_committed_refinements.load();
-#else
-      std::size_t row = m_committed_refinements;
-#endif
       Real h = ldexp(Real(1), -static_cast<int>(row));
       std::size_t first_complement = 0;
       std::size_t n = boost::math::itrunc(ceil((m_t_max - h) / (2 * h)));
@@ -134,6 +170,7 @@ private:
       m_first_complements[row] = first_complement;
       for (Real pos = h; pos < m_t_max; pos += 2 * h)
          m_weights[row].push_back(weight_at_t(pos));
+      commit_refinements(row);
    }
 
    static inline Real abscissa_at_t(const Real& t)
@@ -170,6 +207,7 @@ private:
    mutable std::vector<std::vector<Real>> m_weights;
    mutable std::vector<std::size_t>       m_first_complements;
    std::size_t                       m_max_refinements, m_inital_row_length;
+   mutable tools::cache_statistics   m_statistics;
 #ifndef BOOST_MATH_NO_ATOMIC_INT
    mutable boost::math::detail::atomic_unsigned_type      m_committed_refinements;
    mutable boost::detail::lightweight_mutex m_mutex;
@@ -180,8 +218,63 @@ private:
 };
 
 template<class Real, class Policy>
-template<class F>
-decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) tanh_sinh_detail<Real, Policy>::integrate(const F f, Real* error, Real* L1, const char* function, Real left_min_complement, Real right_min_complement, Real tolerance, std::size_t* levels) const
+tanh_sinh_detail<Real, Policy>::tanh_sinh_detail(std::istream& is)
+{
+   typedef quadrature_table_io<Real> io;
+   // Loading the rows counts as a growth event, so the statistics show how long it took:
+   tools::detail::cache_growth_timer timer(m_statistics);
+   io::read_header(is, quadrature_table_kind::tanh_sinh);
+   m_max_refinements = io::template read_integer<std::size_t>(is);
+   m_inital_row_length = io::template read_integer<std::size_t>(is);
+   m_t_max = io::read_value(is);
+   m_t_crossover = io::read_value(is);
+   std::size_t rows = io::template read_integer<std::size_t>(is);
+   // Row n holds ~2^n values, so anything beyond a few dozen rows is nonsense:
+   if ((m_max_refinements > 64) || (rows == 0) || (rows > m_max_refinements + 1))
+      io::fail("The quadrature table is corrupt.");
+   m_abscissas.assign(m_max_refinements + 1, std::vector<Real>());
+   m_weights.assign(m_max_refinements + 1, std::vector<Real>());
+   m_first_complements.assign(m_max_refinements + 1, 0);
+   for (std::size_t row = 0; row < rows; ++row)
+   {
+      m_first_complements[row] = io::template read_integer<std::size_t>(is);
+      io::read_row(is, m_abscissas[row]);
+      io::read_row(is, m_weights[row]);
+      // The abscissas from the first complement index on are stored as complements, so it must lie within the row:
+      if ((m_weights[row].size() != m_abscissas[row].size()) || m_abscissas[row].empty()
+         || (m_first_complements[row] > m_abscissas[row].size()))
+         io::fail("The quadrature table is corrupt.");
+   }
+#ifndef BOOST_MATH_NO_ATOMIC_INT
+   m_committed_refinements = static_cast<boost::math::detail::atomic_unsigned_integer_type>(rows - 1);
+#else
+   m_committed_refinements = static_cast<unsigned>(rows - 1);
+#endif
+}
+
+template<class Real, class Policy>
+void tanh_sinh_detail<Real, Policy>::save(std::ostream& os)const
+{
+   typedef quadrature_table_io<Real> io;
+   // Committed rows are never modified, so we can write them without the lock:
+   std::size_t rows = committed_refinements() + 1;
+   io::write_header(os, quadrature_table_kind::tanh_sinh);
+   io::write_integer(os, m_max_refinements);
+   io::write_integer(os, m_inital_row_length);
+   io::write_value(os, m_t_max);
+   io::write_value(os, m_t_crossover);
+   io::write_integer(os, rows);
+   for (std::size_t row = 0; row < rows; ++row)
+   {
+      io::write_integer(os, m_first_complements[row]);
+      io::write_row(os, m_abscissas[row]);
+      io::write_row(os, m_weights[row]);
+   }
+}
+
+template<class Real, class Policy>
+template<class Integrand>
+auto tanh_sinh_detail<Real, Policy>::integrate_imp(Integrand& f, Real* error, Real* L1, const char* function, Real left_min_complement, Real right_min_complement, Real tolerance, std::size_t* levels) const ->decltype(f.center(std::declval<Real>()))
 {
     using std::abs;
     using std::fabs;
@@ -226,11 +319,12 @@ decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) tanh_sin
     BOOST_ASSERT(m_abscissas[0][max_right_position] < 0);
     //
     // The type of the result:
-    typedef decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) result_type;
+    typedef decltype(f.center(std::declval<Real>())) result_type;
 
     Real h = m_t_max / m_inital_row_length;
-    result_type I0 = half_pi<Real>()*f(0, 1);
+    result_type I0 = half_pi<Real>()*f.center(Real(0));
     Real L1_I0 = abs(I0);
+    f.evaluate_row(m_abscissas[0], 1, (std::min)(m_abscissas[0].size(), max_right_position + 1), (std::min)(m_abscissas[0].size(), max_left_position + 1));
     for(size_t i = 1; i < m_abscissas[0].size(); ++i)
     {
         if ((i > max_right_position) && (i > max_left_position))
@@ -246,8 +340,8 @@ decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) tanh_sin
         else
            xc = x - 1;
         result_type yp, ym;
-        yp = i <= max_right_position ? f(x, -xc) : 0;
-        ym = i <= max_left_position ? f(-x, xc) : 0;
+        yp = i <= max_right_position ? f.right(i, x, xc) : 0;
+        ym = i <= max_left_position ? f.left(i, x, xc) : 0;
         I0 += (yp + ym)*w;
         L1_I0 += (abs(yp) + abs(ym))*w;
     }
@@ -307,6 +401,7 @@ decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) tanh_sin
            ++max_right_position;
            ++max_right_index;
         }
+        f.evaluate_row(abscissa_row, 0, max_right_index < abscissa_row.size() ? max_right_index + 1 : abscissa_row.size(), max_left_index < abscissa_row.size() ? max_left_index + 1 : abscissa_row.size());
 
         for(size_t j = 0; j < weight_row.size(); ++j)
         {
@@ -329,8 +424,8 @@ decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) tanh_sin
                xc = x - 1;
             }
 
-            result_type yp = j > max_right_index ? 0 : f(x, -xc);
-            result_type ym = j > max_left_index ? 0 : f(-x, xc);
+            result_type yp = j > max_right_index ? 0 : f.right(j, x, xc);
+            result_type ym = j > max_left_index ? 0 : f.left(j, x, xc);
             result_type term = (yp + ym)*w;
             sum += term;
 
@@ -0,0 +1,145 @@
+//  Copyright 2020 Boost.Math contributors
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_QUADRATURE_DETAIL_THREAD_TEAM_HPP
+#define BOOST_MATH_QUADRATURE_DETAIL_THREAD_TEAM_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace boost { namespace math { namespace quadrature { namespace detail {
+
+//
+// A fixed set of worker threads which, together with the calling thread, run f(i) for each
+// i in [0, n) on each call to for_each_index.  The workers sleep between calls, so one team
+// can be reused for many small batches of work without the cost of starting new threads.
+// If any f(i) throws, the remaining indexes are still run and the first exception is
+// rethrown from for_each_index.
+//
+class thread_team
+{
+public:
+   // A team of threads threads in total, including the caller:
+   explicit thread_team(unsigned threads) : m_size(0), m_next(0), m_busy(0), m_generation(0), m_stop(false)
+   {
+      try
+      {
+         for (unsigned i = 1; i < threads; ++i)
+            m_threads.emplace_back(&thread_team::work, this);
+      }
+      catch (...)
+      {
+         stop();
+         throw;
+      }
+   }
+   ~thread_team()
+   {
+      stop();
+   }
+
+   template <class F>
+   void for_each_index(std::size_t n, const F& f)
+   {
+      if (m_threads.empty())
+      {
+         for (std::size_t i = 0; i < n; ++i)
+            f(i);
+         return;
+      }
+      {
+         std::lock_guard<std::mutex> lock(m_mutex);
+         m_task = std::cref(f);
+         m_size = n;
+         m_next = 0;
+         m_busy = static_cast<unsigned>(m_threads.size());
+         ++m_generation;
+      }
+      m_start.notify_all();
+      run_tasks();
+      std::exception_ptr error;
+      {
+         std::unique_lock<std::mutex> lock(m_mutex);
+         m_done.wait(lock, [this]() { return m_busy == 0; });
+         m_task = nullptr;
+         std::swap(error, m_error);
+      }
+      if (error)
+         std::rethrow_exception(error);
+   }
+
+private:
+   thread_team(const thread_team&);
+   thread_team& operator=(const thread_team&);
+
+   void run_tasks()
+   {
+      for (std::size_t i = m_next++; i < m_size; i = m_next++)
+      {
+         try
+         {
+            m_task(i);
+         }
+         catch (...)
+         {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_error)
+               m_error = std::current_exception();
+         }
+      }
+   }
+   void work()
+   {
+      unsigned long seen = 0;
+      for (;;)
+      {
+         {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_start.wait(lock, [this, seen]() { return m_stop || (m_generation != seen); });
+            if (m_stop)
+               return;
+            seen = m_generation;
+         }
+         run_tasks();
+         std::lock_guard<std::mutex> lock(m_mutex);
+         if (--m_busy == 0)
+            m_done.notify_one();
+      }
+   }
+   void stop()
+   {
+      {
+         std::lock_guard<std::mutex> lock(m_mutex);
+         m_stop = true;
+      }
+      m_start.notify_all();
+      for (std::size_t i = 0; i < m_threads.size(); ++i)
+         m_threads[i].join();
+      m_threads.clear();
+   }
+
+   std::vector<std::thread> m_threads;
+   std::mutex m_mutex;
+   std::condition_variable m_start, m_done;
+   // The current batch: written under the lock before the generation is incremented,
+   // so visible to every worker that has seen the new generation:
+   std::function<void(std::size_t)> m_task;
+   std::size_t m_size;
+   std::atomic<std::size_t> m_next;
+   unsigned m_busy;
+   unsigned long m_generation;
+   bool m_stop;
+   std::exception_ptr m_error;
+};
+
+}}}} // namespaces
+
+#endif // BOOST_MATH_QUADRATURE_DETAIL_THREAD_TEAM_HPP
@@ -0,0 +1,204 @@
+//  Copyright 2020 Boost.Math contributors
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_QUADRATURE_DETAIL_VECTOR_VALUED_HPP
+#define BOOST_MATH_QUADRATURE_DETAIL_VECTOR_VALUED_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+#include <boost/math/special_functions/fpclassify.hpp>
+
+namespace boost{ namespace math{ namespace quadrature { namespace detail{
+
+//
+// An integrand is vector valued when its result has size() and operator[], as for
+// std::array, std::vector, or a vector from a linear algebra library:
+//
+template <class K, class = void>
+struct is_vector_valued : public std::false_type {};
+
+template <class K>
+struct is_vector_valued<K, decltype((void)std::declval<K&>()[0], (void)std::declval<K&>().size())> : public std::true_type {};
+
+//
+// Gives a vector valued result the arithmetic that the integrators expect of their
+// result type, componentwise, with abs() returning the largest absolute value of any
+// component.  Error estimates and L1 norms are therefore computed in the maximum norm,
+// and one adaptive pass serves every component.
+//
+// A value constructed from a scalar has no components yet, and is broadcast to the
+// shape of whatever it is combined with: this is how the integrators' "K sum = 0"
+// acquires the shape of the integrand's results.
+//
+template <class Real, class K>
+class vector_value
+{
+public:
+   vector_value() : m_value(), m_scalar(0), m_is_scalar(true) {}
+   vector_value(const Real& x) : m_value(), m_scalar(x), m_is_scalar(true) {}
+   // So that "K sum = 0" works when Real is a class type:
+   template <class I>
+   vector_value(I x, typename std::enable_if<std::is_arithmetic<I>::value>::type* = nullptr) : m_value(), m_scalar(x), m_is_scalar(true) {}
+   explicit vector_value(const K& v) : m_value(v), m_scalar(0), m_is_scalar(false) {}
+
+   //
+   // Returns the components, with a scalar broadcast to a value-initialized K.  A
+   // dynamically sized K then has no components, but that only happens when nothing
+   // was ever integrated, for example over an empty range:
+   //
+   K value()const
+   {
+      if (!m_is_scalar)
+         return m_value;
+      K result = K();
+      for (std::size_t i = 0; i < static_cast<std::size_t>(result.size()); ++i)
+         result[i] = m_scalar;
+      return result;
+   }
+
+   vector_value& operator+=(const vector_value& v)
+   {
+      return combine(v, Real(1));
+   }
+   vector_value& operator-=(const vector_value& v)
+   {
+      return combine(v, Real(-1));
+   }
+   vector_value& operator*=(const Real& x)
+   {
+      if (m_is_scalar)
+         m_scalar *= x;
+      else
+      {
+         for (std::size_t i = 0; i < size(); ++i)
+            m_value[i] *= x;
+      }
+      return *this;
+   }
+   vector_value& operator/=(const Real& x)
+   {
+      if (m_is_scalar)
+         m_scalar /= x;
+      else
+      {
+         for (std::size_t i = 0; i < size(); ++i)
+            m_value[i] /= x;
+      }
+      return *this;
+   }
+
+   // The largest absolute value of any component, or NaN if any component is a NaN:
+   Real norm()const
+   {
+      using std::abs;
+      if (m_is_scalar)
+         return abs(m_scalar);
+      Real result = 0;
+      for (std::size_t i = 0; i < size(); ++i)
+      {
+         Real x = abs(m_value[i]);
+         if ((boost::math::isnan)(x))
+            return x;
+         if (x > result)
+            result = x;
+      }
+      return result;
+   }
+
+   friend vector_value operator+(vector_value u, const vector_value& v) { return u += v; }
+   friend vector_value operator-(vector_value u, const vector_value& v) { return u -= v; }
+   friend vector_value operator-(vector_value u) { return u *= Real(-1); }
+   friend vector_value operator*(vector_value u, const Real& x) { return u *= x; }
+   friend vector_value operator*(const Real& x, vector_value u) { return u *= x; }
+   friend vector_value operator/(vector_value u, const Real& x) { return u /= x; }
+   friend Real abs(const vector_value& u) { return u.norm(); }
+
+   template <class charT, class traits>
+   friend std::basic_ostream<charT, traits>& operator<<(std::basic_ostream<charT, traits>& os, const vector_value& u)
+   {
+      if (u.m_is_scalar)
+         return os << u.m_scalar;
+      os << "{";
+      for (std::size_t i = 0; i < u.size(); ++i)
+         os << (i ? ", " : "") << u.m_value[i];
+      return os << "}";
+   }
+
+private:
+   std::size_t size()const { return static_cast<std::size_t>(m_value.size()); }
+
+   // *this += sign * v:
+   vector_value& combine(const vector_value& v, const Real& sign)
+   {
+      if (v.m_is_scalar)
+      {
+         if (m_is_scalar)
+            m_scalar += sign * v.m_scalar;
+         else
+         {
+            for (std::size_t i = 0; i < size(); ++i)
+               m_value[i] += sign * v.m_scalar;
+         }
+      }
+      else
+      {
+         if (m_is_scalar)
+         {
+            Real s = m_scalar;
+            m_value = v.m_value;
+            m_is_scalar = false;
+            for (std::size_t i = 0; i < size(); ++i)
+               m_value[i] = s + sign * m_value[i];
+         }
+         else
+         {
+            for (std::size_t i = 0; i < size(); ++i)
+               m_value[i] += sign * v.m_value[i];
+         }
+      }
+      return *this;
+   }
+
+   K m_value;
+   Real m_scalar;
+   bool m_is_scalar;
+};
+
+//
+// Wraps a vector valued integrand, taking either one argument or two (for tanh_sinh's
+// f(x, xc) form), so that it returns vector_value's:
+//
+template <class Real, class F>
+class vector_valued_integrand
+{
+public:
+   explicit vector_valued_integrand(const F& f) : m_f(f) {}
+
+   template <class T>
+   auto operator()(const T& x)const->vector_value<Real, typename std::decay<decltype(std::declval<const F&>()(x))>::type>
+   {
+      return vector_value<Real, typename std::decay<decltype(m_f(x))>::type>(m_f(x));
+   }
+   template <class T>
+   auto operator()(const T& x, const T& xc)const->vector_value<Real, typename std::decay<decltype(std::declval<const F&>()(x, xc))>::type>
+   {
+      return vector_value<Real, typename std::decay<decltype(m_f(x, xc))>::type>(m_f(x, xc));
+   }
+
+private:
+   const F& m_f;
+};
+
+template <class Real, class F>
+inline vector_valued_integrand<Real, F> make_vector_valued_integrand(const F& f)
+{
+   return vector_valued_integrand<Real, F>(f);
+}
+
+}}}}
+#endif
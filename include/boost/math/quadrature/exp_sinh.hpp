@@ -18,6 +18,7 @@
 #include <cmath>
 #include <limits>
 #include <memory>
+#include <vector>
 #include <boost/math/quadrature/detail/exp_sinh_detail.hpp>
 
 namespace boost{ namespace math{ namespace quadrature {
@@ -29,11 +30,41 @@ public:
    exp_sinh(size_t max_refinements = 9)
       : m_imp(std::make_shared<detail::exp_sinh_detail<Real, Policy>>(max_refinements)) {}
 
+   // Constructs from tables written by save_tables, which is far quicker than computing
+   // them, especially for multiprecision types:
+   explicit exp_sinh(std::istream& is)
+      : m_imp(std::make_shared<detail::exp_sinh_detail<Real, Policy>>(is)) {}
+
     template<class F>
     auto integrate(const F& f, Real a, Real b, Real tol = boost::math::tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))  const;
     template<class F>
     auto integrate(const F& f, Real tol = boost::math::tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))  const;
 
+    // Batched integrands: f(x, y, n) sets y[i] = f(x[i]) for i < n, and is called once per refinement level:
+    template<class F>
+    auto integrate(const F& f, Real a, Real b, Real tol = boost::math::tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr)->decltype((void)std::declval<F>()(std::declval<const Real*>(), std::declval<Real*>(), std::size_t(0)), Real())  const;
+    template<class F>
+    auto integrate(const F& f, Real tol = boost::math::tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr)->decltype((void)std::declval<F>()(std::declval<const Real*>(), std::declval<Real*>(), std::size_t(0)), Real())  const;
+
+    // Computes the abscissas and weights for refinement levels up to and including
+    // levels now, rather than during the first calls to integrate, and returns the
+    // highest level available.  Copies of this object share the same tables.
+    std::size_t reserve_refinements(std::size_t levels) const
+    {
+        return m_imp->reserve_refinements(levels);
+    }
+
+    tools::cache_statistics table_statistics() const
+    {
+        return m_imp->statistics();
+    }
+
+    // Writes the abscissas and weights computed so far, for the constructor above to read back:
+    void save_tables(std::ostream& os) const
+    {
+        m_imp->save(os);
+    }
+
 private:
     std::shared_ptr<detail::exp_sinh_detail<Real, Policy>> m_imp;
 };
@@ -89,6 +120,65 @@ auto exp_sinh<Real, Policy>::integrate(const F& f, Real tolerance, Real* error,
     return m_imp->integrate(f, error, L1, function, tolerance, levels);
 }
 
+template<class Real, class Policy>
+template<class F>
+auto exp_sinh<Real, Policy>::integrate(const F& f, Real a, Real b, Real tolerance, Real* error, Real* L1, std::size_t* levels)->decltype((void)std::declval<F>()(std::declval<const Real*>(), std::declval<Real*>(), std::size_t(0)), Real())  const
+{
+    static const char* function = "boost::math::quadrature::exp_sinh<%1%>::integrate";
+
+    // Neither limit may be a NaN:
+    if((boost::math::isnan)(a) || (boost::math::isnan)(b))
+    {
+       return policies::raise_domain_error(function, "NaN supplied as one limit of integration - sorry I don't know what to do", a, Policy());
+    }
+    std::vector<Real> x;
+    // Right limit is infinite:
+    if ((boost::math::isfinite)(a) && (b >= boost::math::tools::max_value<Real>()))
+    {
+        // If a = 0, don't use an additional level of indirection:
+        if (a == (Real) 0)
+        {
+            return m_imp->integrate_batch(f, error, L1, function, tolerance, levels);
+        }
+        const auto u = [&](const Real* t, Real* y, std::size_t n)
+        {
+            x.resize(n);
+            for (std::size_t i = 0; i < n; ++i)
+                x[i] = t[i] + a;
+            f(x.data(), y, n);
+        };
+        return m_imp->integrate_batch(u, error, L1, function, tolerance, levels);
+    }
+
+    if ((boost::math::isfinite)(b) && a <= -boost::math::tools::max_value<Real>())
+    {
+        const auto u = [&](const Real* t, Real* y, std::size_t n)
+        {
+            x.resize(n);
+            for (std::size_t i = 0; i < n; ++i)
+                x[i] = b - t[i];
+            f(x.data(), y, n);
+        };
+        return m_imp->integrate_batch(u, error, L1, function, tolerance, levels);
+    }
+
+    // Infinite limits:
+    if ((a <= -boost::math::tools::max_value<Real>()) && (b >= boost::math::tools::max_value<Real>()))
+    {
+        return policies::raise_domain_error(function, "Use sinh_sinh quadrature for integration over the whole real line; exp_sinh is for half infinite integrals.", a, Policy());
+    }
+    // If we get to here then both ends must necessarily be finite:
+    return policies::raise_domain_error(function, "Use tanh_sinh quadrature for integration over finite domains; exp_sinh is for half infinite integrals.", a, Policy());
+}
+
+template<class Real, class Policy>
+template<class F>
+auto exp_sinh<Real, Policy>::integrate(const F& f, Real tolerance, Real* error, Real* L1, std::size_t* levels)->decltype((void)std::declval<F>()(std::declval<const Real*>(), std::declval<Real*>(), std::size_t(0)), Real()) const
+{
+    static const char* function = "boost::math::quadrature::exp_sinh<%1%>::integrate";
+    return m_imp->integrate_batch(f, error, L1, function, tolerance, levels);
+}
+
 
 }}}
 #endif
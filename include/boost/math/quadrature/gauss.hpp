@@ -13,6 +13,7 @@
 #include <vector>
 #include <boost/math/special_functions/legendre.hpp>
 #include <boost/math/constants/constants.hpp>
+#include <boost/math/quadrature/detail/vector_valued.hpp>
 
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -1164,125 +1165,182 @@ public:
    }
 };
 
+//
+// The Gauss sum over [-1, 1] for a rule with the given non-negative abscissas, in
+// increasing order, and their weights.  When the number of points is odd the first
+// abscissa is zero, and f is only evaluated there once:
+//
+template <class Real, class F, class Abscissa, class Weights>
+auto gauss_sum(F f, const Abscissa& abscissa, const Weights& weights, bool odd, Real* pL1)->decltype(std::declval<F>()(std::declval<Real>()))
+{
+  // In many math texts, K represents the field of real or complex numbers.
+  // Too bad we can't put blackboard bold into C++ source!
+   typedef decltype(f(Real(0))) K;
+   using std::abs;
+   unsigned non_zero_start = 1;
+   K result = Real(0);
+   if (odd) {
+      result = f(Real(0)) * weights[0];
+   }
+   else {
+      result = 0;
+      non_zero_start = 0;
+   }
+   Real L1 = abs(result);
+   for (unsigned i = non_zero_start; i < abscissa.size(); ++i)
+   {
+      K fp = f(abscissa[i]);
+      K fm = f(-abscissa[i]);
+      result += (fp + fm) * weights[i];
+      L1 += (abs(fp) + abs(fm)) *  weights[i];
+   }
+   if (pL1)
+      *pL1 = L1;
+   return result;
 }
 
-template <class Real, unsigned N, class Policy = boost::math::policies::policy<> >
-class gauss : public detail::gauss_detail<Real, N, detail::gauss_constant_category<Real>::value>
+//
+// Maps infinite and semi-infinite ranges, reversed ranges, and finite ranges onto [-1, 1]
+// and then integrates with rule(u, pL1), which applies a Gauss rule to u over [-1, 1]:
+//
+template <class Real, class Policy, class F, class Rule>
+auto gauss_integrate_mapped(F f, Real a, Real b, Real* pL1, const Rule& rule, const char* function)->decltype(std::declval<F>()(std::declval<Real>()))
 {
-   typedef detail::gauss_detail<Real, N, detail::gauss_constant_category<Real>::value> base;
-public:
-
-   template <class F>
-   static auto integrate(F f, Real* pL1 = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))
+   typedef decltype(f(a)) K;
+   if (!(boost::math::isnan)(a) && !(boost::math::isnan)(b))
    {
-     // In many math texts, K represents the field of real or complex numbers.
-     // Too bad we can't put blackboard bold into C++ source!
-      typedef decltype(f(Real(0))) K;
-      using std::abs;
-      unsigned non_zero_start = 1;
-      K result = Real(0);
-      if (N & 1) {
-         result = f(Real(0)) * base::weights()[0];
-      }
-      else {
-         result = 0;
-         non_zero_start = 0;
-      }
-      Real L1 = abs(result);
-      for (unsigned i = non_zero_start; i < base::abscissa().size(); ++i)
+      // Infinite limits:
+      Real min_inf = -tools::max_value<Real>();
+      if ((a <= min_inf) && (b >= tools::max_value<Real>()))
       {
-         K fp = f(base::abscissa()[i]);
-         K fm = f(-base::abscissa()[i]);
-         result += (fp + fm) * base::weights()[i];
-         L1 += (abs(fp) + abs(fm)) *  base::weights()[i];
+         auto u = [&](const Real& t)->K
+         {
+            Real t_sq = t*t;
+            Real inv = 1 / (1 - t_sq);
+            K res = f(t*inv)*(1 + t_sq)*inv*inv;
+            return res;
+         };
+         return rule(u, pL1);
       }
-      if (pL1)
-         *pL1 = L1;
-      return result;
-   }
-   template <class F>
-   static auto integrate(F f, Real a, Real b, Real* pL1 = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))
-   {
-      typedef decltype(f(a)) K;
-      static const char* function = "boost::math::quadrature::gauss<%1%>::integrate(f, %1%, %1%)";
-      if (!(boost::math::isnan)(a) && !(boost::math::isnan)(b))
+
+      // Right limit is infinite:
+      if ((boost::math::isfinite)(a) && (b >= tools::max_value<Real>()))
       {
-         // Infinite limits:
-         Real min_inf = -tools::max_value<Real>();
-         if ((a <= min_inf) && (b >= tools::max_value<Real>()))
+         auto u = [&](const Real& t)->K
          {
-            auto u = [&](const Real& t)->K
-            {
-               Real t_sq = t*t;
-               Real inv = 1 / (1 - t_sq);
-               K res = f(t*inv)*(1 + t_sq)*inv*inv;
-               return res;
-            };
-            return integrate(u, pL1);
+            Real z = 1 / (t + 1);
+            Real arg = 2 * z + a - 1;
+            K res = f(arg)*z*z;
+            return res;
+         };
+         K Q = Real(2) * rule(u, pL1);
+         if (pL1)
+         {
+            *pL1 *= 2;
          }
+         return Q;
+      }
 
-         // Right limit is infinite:
-         if ((boost::math::isfinite)(a) && (b >= tools::max_value<Real>()))
+      if ((boost::math::isfinite)(b) && (a <= -tools::max_value<Real>()))
+      {
+         auto v = [&](const Real& t)->K
+         {
+            Real z = 1 / (t + 1);
+            Real arg = 2 * z - 1;
+            K res = f(b - arg) * z * z;
+            return res;
+         };
+         K Q = Real(2) * rule(v, pL1);
+         if (pL1)
          {
-            auto u = [&](const Real& t)->K
-            {
-               Real z = 1 / (t + 1);
-               Real arg = 2 * z + a - 1;
-               K res = f(arg)*z*z;
-               return res;
-            };
-            K Q = Real(2) * integrate(u, pL1);
-            if (pL1)
-            {
-               *pL1 *= 2;
-            }
-            return Q;
+            *pL1 *= 2;
          }
+         return Q;
+      }
 
-         if ((boost::math::isfinite)(b) && (a <= -tools::max_value<Real>()))
+      if ((boost::math::isfinite)(a) && (boost::math::isfinite)(b))
+      {
+         if (a == b)
          {
-            auto v = [&](const Real& t)->K
-            {
-               Real z = 1 / (t + 1);
-               Real arg = 2 * z - 1;
-               K res = f(b - arg) * z * z;
-               return res;
-            };
-            K Q = Real(2) * integrate(v, pL1);
-            if (pL1)
-            {
-               *pL1 *= 2;
-            }
-            return Q;
+            return K(0);
          }
-
-         if ((boost::math::isfinite)(a) && (boost::math::isfinite)(b))
+         if (b < a)
          {
-            if (a == b)
-            {
-               return K(0);
-            }
-            if (b < a)
-            {
-               return -integrate(f, b, a, pL1);
-            }
-            Real avg = (a + b)*constants::half<Real>();
-            Real scale = (b - a)*constants::half<Real>();
+            return -gauss_integrate_mapped<Real, Policy>(f, b, a, pL1, rule, function);
+         }
+         Real avg = (a + b)*constants::half<Real>();
+         Real scale = (b - a)*constants::half<Real>();
 
-            auto u = [&](Real z)->K
-            {
-               return f(avg + scale*z);
-            };
-            K Q = scale*integrate(u, pL1);
+         auto u = [&](Real z)->K
+         {
+            return f(avg + scale*z);
+         };
+         K Q = scale*rule(u, pL1);
 
-            if (pL1)
-            {
-               *pL1 *= scale;
-            }
-            return Q;
+         if (pL1)
+         {
+            *pL1 *= scale;
          }
+         return Q;
+      }
+   }
+   return static_cast<K>(policies::raise_domain_error(function, "The domain of integration is not sensible; please check the bounds.", a, Policy()));
+}
+
+}
+
+template <class Real, unsigned N, class Policy = boost::math::policies::policy<> >
+class gauss : public detail::gauss_detail<Real, N, detail::gauss_constant_category<Real>::value>
+{
+   typedef detail::gauss_detail<Real, N, detail::gauss_constant_category<Real>::value> base;
+
+   // Applies this rule over [-1, 1]:
+   struct rule
+   {
+      template <class F>
+      auto operator()(F f, Real* pL1)const->decltype(std::declval<F>()(std::declval<Real>()))
+      {
+         return detail::gauss_sum<Real>(f, base::abscissa(), base::weights(), (N & 1) != 0, pL1);
       }
-      return static_cast<K>(policies::raise_domain_error(function, "The domain of integration is not sensible; please check the bounds.", a, Policy()));
+   };
+
+   template <class F>
+   static auto integrate_imp(F f, Real* pL1, const std::false_type&)->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      return rule()(f, pL1);
+   }
+   template <class F>
+   static auto integrate_imp(F f, Real* pL1, const std::true_type&)->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      return integrate(detail::make_vector_valued_integrand<Real>(f), pL1).value();
+   }
+   template <class F>
+   static auto integrate_imp(F f, Real a, Real b, Real* pL1, const std::false_type&)->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      static const char* function = "boost::math::quadrature::gauss<%1%>::integrate(f, %1%, %1%)";
+      return detail::gauss_integrate_mapped<Real, Policy>(f, a, b, pL1, rule(), function);
+   }
+   template <class F>
+   static auto integrate_imp(F f, Real a, Real b, Real* pL1, const std::true_type&)->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      return integrate(detail::make_vector_valued_integrand<Real>(f), a, b, pL1).value();
+   }
+
+public:
+   //
+   // Integrands may return a real or complex value, or a vector of them (anything with size()
+   // and operator[], such as std::array) in which case every component is integrated from the
+   // same evaluations, and *pL1 is the integral of the largest absolute value of any component.
+   //
+   template <class F>
+   static auto integrate(F f, Real* pL1 = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      return integrate_imp(f, pL1, detail::is_vector_valued<typename std::decay<decltype(f(Real(0)))>::type>());
+   }
+   template <class F>
+   static auto integrate(F f, Real a, Real b, Real* pL1 = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      return integrate_imp(f, a, b, pL1, detail::is_vector_valued<typename std::decay<decltype(f(a))>::type>());
    }
 };
 
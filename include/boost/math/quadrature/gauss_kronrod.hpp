@@ -13,10 +13,14 @@
 #pragma warning(disable: 4127)
 #endif
 
+#include <algorithm>
+#include <thread>
 #include <vector>
 #include <boost/math/special_functions/legendre.hpp>
 #include <boost/math/special_functions/legendre_stieltjes.hpp>
 #include <boost/math/quadrature/gauss.hpp>
+#include <boost/math/quadrature/detail/thread_team.hpp>
+#include <boost/math/quadrature/detail/vector_valued.hpp>
 
 namespace boost { namespace math{ namespace quadrature{ namespace detail{
 
@@ -1762,8 +1766,32 @@ public:
    }
 };
 
+//
+// One subinterval of the partition built by gauss_kronrod::integrate_global:
+//
+template <class Real, class K>
+struct gauss_kronrod_interval
+{
+   Real a, b;
+   K result;
+   Real error, L1;
+   unsigned depth;
+};
+
 }
 
+//
+// Reports the work done by gauss_kronrod::integrate and gauss_kronrod::integrate_global:
+//
+struct gauss_kronrod_statistics
+{
+   gauss_kronrod_statistics() : intervals(0), evaluations(0), depth(0) {}
+
+   std::size_t intervals;   // Number of subintervals in the final partition of the range.
+   std::size_t evaluations; // Number of calls to the integrand.
+   unsigned depth;          // Largest number of bisections leading to any one subinterval.
+};
+
 template <class Real, unsigned N, class Policy = boost::math::policies::policy<> >
 class gauss_kronrod : public detail::gauss_kronrod_detail<Real, N, detail::gauss_constant_category<Real>::value>
 {
@@ -1823,6 +1851,8 @@ private:
    {
       F f;
       Real tol;
+      unsigned max_depth;
+      gauss_kronrod_statistics* stats;
    };
 
    template <class F>
@@ -1839,6 +1869,8 @@ private:
       };
       K r1 = integrate_non_adaptive_m1_1(ff, &error_local, L1);
       K estimate = scale * r1;
+      if (info->stats)
+         info->stats->evaluations += N;
 
       K tmp = estimate * info->tol;
       Real abs_tol1 = abs(tmp);
@@ -1857,6 +1889,11 @@ private:
             *L1 += L1_local;
          return estimate;
       }
+      if (info->stats)
+      {
+         ++info->stats->intervals;
+         info->stats->depth = (std::max)(info->stats->depth, info->max_depth - max_levels);
+      }
       if(L1)
          *L1 *= scale;
       if (error)
@@ -1864,9 +1901,168 @@ private:
       return estimate;
    }
 
-public:
+   // Integrates over a finite interval with recursive_adaptive_integrate:
+   struct recursive_integrator
+   {
+      unsigned max_depth;
+      Real tol;
+      Real* error;
+      Real* pL1;
+      gauss_kronrod_statistics* stats;
+
+      template <class F>
+      auto operator()(const F& f, Real a, Real b)const->decltype(std::declval<F>()(std::declval<Real>()))
+      {
+         recursive_info<F> info = { f, tol, max_depth, stats };
+         return recursive_adaptive_integrate(&info, a, b, max_depth, Real(0), error, pL1);
+      }
+   };
+
+   //
+   // Global adaptive integration in the manner of QUADPACK's QAG: the current partition of [a, b]
+   // is kept in a heap ordered by error estimate, and the intervals with the largest errors are
+   // bisected until the total error meets the tolerance or max_intervals is reached.  Rather than
+   // the worst interval alone, each step bisects the worst intervals_per_step, and their children
+   // are evaluated concurrently by team.  The result depends upon intervals_per_step but not upon
+   // the timing of the threads.
+   //
    template <class F>
-   static auto integrate(F f, Real a, Real b, unsigned max_depth = 15, Real tol = tools::root_epsilon<Real>(), Real* error = nullptr, Real* pL1 = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))
+   static auto global_adaptive_integrate(const F& f, Real a, Real b, std::size_t max_intervals, Real tol, Real* error, Real* pL1, gauss_kronrod_statistics* stats, detail::thread_team& team, std::size_t intervals_per_step)->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      typedef decltype(f(a)) K;
+      typedef detail::gauss_kronrod_interval<Real, K> interval;
+      using std::abs;
+
+      auto evaluate = [&f](interval& i)
+      {
+         Real mean = (i.b + i.a) / 2;
+         Real scale = (i.b - i.a) / 2;
+         auto ff = [&](const Real& x)->K
+         {
+            return f(scale * x + mean);
+         };
+         i.result = scale * integrate_non_adaptive_m1_1(ff, &i.error, &i.L1);
+         i.error *= scale;
+         i.L1 *= scale;
+      };
+      auto by_error = [](const interval& x, const interval& y) { return x.error < y.error; };
+
+      std::vector<interval> heap(1);
+      heap[0].a = a;
+      heap[0].b = b;
+      heap[0].depth = 0;
+      evaluate(heap[0]);
+      std::size_t evaluations = 1;
+      // Running totals, which are recomputed exactly before we stop:
+      K result = heap[0].result;
+      Real err = heap[0].error;
+
+      std::vector<interval> parents, children;
+      while ((boost::math::isfinite)(err))
+      {
+         if (err <= abs(result * tol))
+         {
+            result = 0;
+            err = 0;
+            for (std::size_t i = 0; i < heap.size(); ++i)
+            {
+               result += heap[i].result;
+               err += heap[i].error;
+            }
+            if (err <= abs(result * tol))
+               break;
+         }
+         //
+         // Take the worst intervals, stopping at any which can no longer be bisected, since
+         // their error will not go down any further:
+         //
+         parents.clear();
+         while (!heap.empty() && (parents.size() < intervals_per_step) && (heap.size() + 2 * parents.size() < max_intervals))
+         {
+            const interval& worst = heap.front();
+            Real mid = (worst.a + worst.b) / 2;
+            if ((mid <= worst.a) || (mid >= worst.b))
+               break;
+            std::pop_heap(heap.begin(), heap.end(), by_error);
+            parents.push_back(heap.back());
+            heap.pop_back();
+         }
+         if (parents.empty())
+            break;
+         children.resize(2 * parents.size());
+         for (std::size_t i = 0; i < parents.size(); ++i)
+         {
+            Real mid = (parents[i].a + parents[i].b) / 2;
+            children[2 * i].a = parents[i].a;
+            children[2 * i].b = mid;
+            children[2 * i + 1].a = mid;
+            children[2 * i + 1].b = parents[i].b;
+            children[2 * i].depth = children[2 * i + 1].depth = parents[i].depth + 1;
+         }
+         team.for_each_index(children.size(), [&](std::size_t i) { evaluate(children[i]); });
+         evaluations += children.size();
+         for (std::size_t i = 0; i < parents.size(); ++i)
+         {
+            result -= parents[i].result;
+            err -= parents[i].error;
+         }
+         for (std::size_t i = 0; i < children.size(); ++i)
+         {
+            result += children[i].result;
+            err += children[i].error;
+            heap.push_back(children[i]);
+            std::push_heap(heap.begin(), heap.end(), by_error);
+         }
+      }
+
+      result = 0;
+      err = 0;
+      Real L1 = 0;
+      unsigned depth = 0;
+      for (std::size_t i = 0; i < heap.size(); ++i)
+      {
+         result += heap[i].result;
+         err += heap[i].error;
+         L1 += heap[i].L1;
+         depth = (std::max)(depth, heap[i].depth);
+      }
+      if (error)
+         *error = err;
+      if (pL1)
+         *pL1 = L1;
+      if (stats)
+      {
+         stats->intervals = heap.size();
+         stats->evaluations = evaluations * N;
+         stats->depth = depth;
+      }
+      return result;
+   }
+
+   // Integrates over a finite interval with global_adaptive_integrate:
+   struct global_integrator
+   {
+      std::size_t max_intervals;
+      Real tol;
+      Real* error;
+      Real* pL1;
+      gauss_kronrod_statistics* stats;
+      detail::thread_team* team;
+      std::size_t intervals_per_step;
+
+      template <class F>
+      auto operator()(const F& f, Real a, Real b)const->decltype(std::declval<F>()(std::declval<Real>()))
+      {
+         return global_adaptive_integrate(f, a, b, max_intervals, tol, error, pL1, stats, *team, intervals_per_step);
+      }
+   };
+
+   //
+   // Maps infinite and semi-infinite ranges onto [-1, 1], and reversed ranges onto [a, b] with
+   // a < b, then integrates over the finite interval with integrator(f, a, b):
+   //
+   template <class F, class Integrator>
+   static auto integrate_mapped(F f, Real a, Real b, const Integrator& integrator, Real* pL1, const std::false_type&)->decltype(std::declval<F>()(std::declval<Real>()))
    {
       typedef decltype(f(a)) K;
       static const char* function = "boost::math::quadrature::gauss_kronrod<%1%>::integrate(f, %1%, %1%)";
@@ -1884,8 +2080,7 @@ public:
                K res = f(arg)*w;
                return res;
             };
-            recursive_info<decltype(u)> info = { u, tol };
-            K res = recursive_adaptive_integrate(&info, Real(-1), Real(1), max_depth, Real(0), error, pL1);
+            K res = integrator(u, Real(-1), Real(1));
             return res;
          }
 
@@ -1899,8 +2094,7 @@ public:
                K res = f(arg)*z*z;
                return res;
             };
-            recursive_info<decltype(u)> info = { u, tol };
-            K Q = Real(2) * recursive_adaptive_integrate(&info, Real(-1), Real(1), max_depth, Real(0), error, pL1);
+            K Q = Real(2) * integrator(u, Real(-1), Real(1));
             if (pL1)
             {
                *pL1 *= 2;
@@ -1916,8 +2110,7 @@ public:
                Real arg = 2 * z - 1;
                return f(b - arg) * z * z;
             };
-            recursive_info<decltype(v)> info = { v, tol };
-            K Q = Real(2) * recursive_adaptive_integrate(&info, Real(-1), Real(1), max_depth, Real(0), error, pL1);
+            K Q = Real(2) * integrator(v, Real(-1), Real(1));
             if (pL1)
             {
                *pL1 *= 2;
@@ -1931,16 +2124,50 @@ public:
             {
                return K(0);
             }
-            recursive_info<F> info = { f, tol };
             if (b < a)
             {
-               return -recursive_adaptive_integrate(&info, b, a, max_depth, Real(0), error, pL1);
+               return -integrator(f, b, a);
             }
-            return recursive_adaptive_integrate(&info, a, b, max_depth, Real(0), error, pL1);
+            return integrator(f, a, b);
          }
       }
       return static_cast<K>(policies::raise_domain_error(function, "The domain of integration is not sensible; please check the bounds.", a, Policy()));
    }
+   // Vector valued integrands are integrated componentwise, with errors measured in the maximum norm:
+   template <class F, class Integrator>
+   static auto integrate_mapped(F f, Real a, Real b, const Integrator& integrator, Real* pL1, const std::true_type&)->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      return integrate_mapped(detail::make_vector_valued_integrand<Real>(f), a, b, integrator, pL1, std::false_type()).value();
+   }
+
+public:
+   template <class F>
+   static auto integrate(F f, Real a, Real b, unsigned max_depth = 15, Real tol = tools::root_epsilon<Real>(), Real* error = nullptr, Real* pL1 = nullptr, gauss_kronrod_statistics* stats = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      if (stats)
+         *stats = gauss_kronrod_statistics();
+      recursive_integrator integrator = { max_depth, tol, error, pL1, stats };
+      return integrate_mapped(f, a, b, integrator, pL1, detail::is_vector_valued<typename std::decay<decltype(f(a))>::type>());
+   }
+
+   //
+   // Global adaptive integration: repeatedly bisects whichever subintervals currently have the
+   // largest error estimates, until the estimated error of the whole is below tol relative to
+   // the result, or the partition has max_intervals subintervals.  With threads > 1, f is
+   // called concurrently from that many threads (0 means std::thread::hardware_concurrency()),
+   // with each step bisecting as many of the worst subintervals as there are threads.
+   //
+   template <class F>
+   static auto integrate_global(F f, Real a, Real b, std::size_t max_intervals = 1000, Real tol = tools::root_epsilon<Real>(), Real* error = nullptr, Real* pL1 = nullptr, gauss_kronrod_statistics* stats = nullptr, unsigned threads = 1)->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      if (threads == 0)
+         threads = (std::max)(std::thread::hardware_concurrency(), 1u);
+      if (stats)
+         *stats = gauss_kronrod_statistics();
+      detail::thread_team team(threads);
+      global_integrator integrator = { (std::max)(max_intervals, std::size_t(1)), tol, error, pL1, stats, &team, threads };
+      return integrate_mapped(f, a, b, integrator, pL1, detail::is_vector_valued<typename std::decay<decltype(f(a))>::type>());
+   }
 };
 
 } // namespace quadrature
@@ -0,0 +1,376 @@
+//  Copyright 2020 Boost.Math contributors
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_QUADRATURE_GAUSS_LEGENDRE_HPP
+#define BOOST_MATH_QUADRATURE_GAUSS_LEGENDRE_HPP
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include <boost/detail/lightweight_mutex.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/policies/error_handling.hpp>
+#include <boost/math/quadrature/gauss.hpp>
+#include <boost/math/tools/precision.hpp>
+
+namespace boost { namespace math{ namespace quadrature{ namespace detail{
+
+//
+// Sets p = P_n(x) and dp = P_n'(x), using the three term recurrence.  Near x = 1 both
+// solutions of the recurrence tend to 1, and rounding errors grow like k^2, so there it is
+// run on the differences d_k = P_k - P_{k-1} and t = 1 - x instead, which Sterbenz's lemma
+// makes exact:
+//
+// d_{k+1} = (k d_k - (2k + 1) t P_k) / (k + 1)
+//
+template <class Real>
+void legendre_p_and_prime(std::size_t n, const Real& x, Real& p, Real& dp)
+{
+   if (x > Real(0.5))
+   {
+      Real t = 1 - x;
+      Real p1 = x;
+      Real d = -t;
+      for (std::size_t k = 1; k < n; ++k)
+      {
+         d = (k * d - (2 * k + 1) * t * p1) / (k + 1);
+         p1 += d;
+      }
+      p = n ? p1 : Real(1);
+      // x P_n - P_{n-1} = d_n - t P_n:
+      dp = n ? n * (t * p1 - d) / (t * (1 + x)) : Real(0);
+      return;
+   }
+   Real p0 = 1;
+   Real p1 = x;
+   for (std::size_t k = 1; k < n; ++k)
+   {
+      Real p2 = ((2 * k + 1) * x * p1 - k * p0) / (k + 1);
+      p0 = p1;
+      p1 = p2;
+   }
+   p = n ? p1 : p0;
+   dp = n * (x * p1 - p0) / ((x - 1) * (x + 1));
+}
+
+//
+// The Taylor series of P_n about x0, given P_n(x0) and P_n'(x0).  Since P_n satisfies
+// (1 - x^2)u'' - 2xu' + n(n+1)u = 0, the coefficients c_m = u^(m)(x0) / m! satisfy
+//
+// (1 - x0^2)(m + 2)(m + 1)c[m+2] = 2(m + 1)^2 x0 c[m+1] - (n(n+1) - m(m+1)) c[m]
+//
+// and are generated as they are needed.  The series converges for |h| < 1 - |x0|.
+//
+template <class Real>
+class legendre_taylor_series
+{
+public:
+   legendre_taylor_series(std::size_t n, const Real& x0, const Real& p, const Real& dp) : m_n(n), m_x0(x0)
+   {
+      m_c.push_back(p);
+      m_c.push_back(dp);
+   }
+
+   // Sets p = P_n(x0 + h) and dp = P_n'(x0 + h), returning false if the series fails to converge:
+   bool evaluate(const Real& h, Real& p, Real& dp)
+   {
+      using std::abs;
+      const Real eps = tools::epsilon<Real>();
+      const std::size_t max_terms = 2 * tools::digits<Real>() + 20;
+      p = m_c[0] + m_c[1] * h;
+      dp = m_c[1];
+      Real hm = h;    // h^(m-1)
+      unsigned small_terms = 0;
+      for (std::size_t m = 2; m < max_terms; ++m)
+      {
+         if (m >= m_c.size())
+            extend();
+         Real term = m_c[m] * hm;
+         dp += m * term;
+         p += term * h;
+         // Stop after two consecutive negligible terms, since alternate coefficients vanish at x0 = 0:
+         if (abs(m * term) <= eps * abs(dp))
+         {
+            if (++small_terms >= 2)
+               return true;
+         }
+         else
+            small_terms = 0;
+         hm *= h;
+      }
+      return false;
+   }
+
+private:
+   void extend()
+   {
+      std::size_t m = m_c.size() - 2;
+      Real nn = static_cast<Real>(m_n) * static_cast<Real>(m_n + 1);
+      Real c = (2 * Real(m + 1) * Real(m + 1) * m_x0 * m_c[m + 1] - (nn - Real(m) * Real(m + 1)) * m_c[m])
+         / ((1 - m_x0) * (1 + m_x0) * Real(m + 2) * Real(m + 1));
+      m_c.push_back(c);
+   }
+
+   std::size_t m_n;
+   Real m_x0;
+   std::vector<Real> m_c;
+};
+
+template <class Real>
+struct gauss_legendre_data
+{
+   std::vector<Real> abscissa;
+   std::vector<Real> weights;
+};
+
+//
+// Computes the non-negative zeros of P_n in increasing order, along with the Gauss weights
+// 2 / ((1 - x^2) P_n'(x)^2), in O(n) operations using the method of Glaser, Liu and Rokhlin:
+// starting from x = 0, each zero is found by Newton iteration on the Taylor series of P_n
+// about the previous one, starting from Tricomi's asymptotic approximation.  The same series
+// gives P_n' at the new zero, for its weight and for the next step.  A step is only taken
+// when it is well within the radius of convergence of the series; the few zeros nearest to 1
+// for which it isn't are found by Newton iteration on the three term recurrence instead.
+//
+template <class Real>
+void compute_gauss_legendre_imp(std::size_t n, gauss_legendre_data<Real>& data)
+{
+   using std::abs;
+   using std::cos;
+   using boost::math::constants::pi;
+   const Real eps = tools::epsilon<Real>();
+   const unsigned max_iterations = tools::digits<Real>();
+   std::size_t count = (n + 1) / 2;
+   data.abscissa.resize(count);
+   data.weights.resize(count);
+
+   // P_n(0) and P_n'(0) = n P_{n-1}(0), from P_{2k}(0) = (-1)^k (2k-1)!! / (2k)!!:
+   Real p0 = 1;
+   for (std::size_t k = 1; k <= n / 2; ++k)
+      p0 *= -Real(2 * k - 1) / Real(2 * k);
+   Real x0 = 0;
+   Real dp0 = 0;
+   std::size_t first = 0;
+   if (n & 1)
+   {
+      dp0 = n * p0;
+      p0 = 0;
+      data.abscissa[0] = 0;
+      data.weights[0] = 2 / (dp0 * dp0);
+      first = 1;
+   }
+
+   for (std::size_t i = first; i < count; ++i)
+   {
+      // Tricomi's approximation to the k'th largest zero:
+      std::size_t k = count - i;
+      Real x = (1 - Real(n - 1) / (8 * Real(n) * Real(n) * Real(n))) * cos(pi<Real>() * Real(4 * k - 1) / Real(4 * n + 2));
+      Real p, dp;
+      bool converged = false;
+      if (x - x0 < (1 - x0) / 2)
+      {
+         legendre_taylor_series<Real> series(n, x0, p0, dp0);
+         Real h = x - x0;
+         for (unsigned iteration = 0; iteration < max_iterations; ++iteration)
+         {
+            if (!series.evaluate(h, p, dp))
+               break;
+            Real delta = p / dp;
+            h -= delta;
+            if (abs(delta) <= eps * (x0 + h))
+            {
+               converged = series.evaluate(h, p, dp);
+               break;
+            }
+         }
+         x = x0 + h;
+      }
+      if (!converged)
+      {
+         for (unsigned iteration = 0; iteration < max_iterations; ++iteration)
+         {
+            legendre_p_and_prime(n, x, p, dp);
+            Real delta = p / dp;
+            x -= delta;
+            if (abs(delta) <= eps * x)
+               break;
+         }
+         legendre_p_and_prime(n, x, p, dp);
+      }
+      data.abscissa[i] = x;
+      data.weights[i] = 2 / ((1 - x) * (1 + x) * dp * dp);
+      x0 = x;
+      p0 = 0;
+      dp0 = dp;
+   }
+}
+
+//
+// Each step loses a little accuracy in P_n', and so in the weights, to cancellation in the
+// series, about 100 epsilon in all at n = 1000: so this is done in long double when that is
+// more precise than Real.
+//
+template <class Real>
+struct gauss_legendre_working_type
+{
+   typedef typename std::conditional<
+      std::is_floating_point<Real>::value && (std::numeric_limits<Real>::digits < std::numeric_limits<long double>::digits),
+      long double, Real>::type type;
+};
+
+//
+// When there is no wider type to work in, each zero is refined by one Newton step on the
+// three term recurrence, whose rounding errors don't accumulate from one zero to the next,
+// and its weight recomputed there.  The relative condition number of the weight with respect
+// to the zero is 2x / (1 - x^2), large near 1, so rather than evaluating it at the rounded
+// zero x, P_n' and 1 - x^2 are carried to the true zero x - delta, delta = P_n(x) / P_n'(x),
+// by a first order Taylor step using P_n'' = (2x P_n' - n(n+1) P_n) / (1 - x^2).
+// This costs O(n) per zero, so O(n^2) in all.
+//
+template <class Real>
+void polish_gauss_legendre(std::size_t n, gauss_legendre_data<Real>& data)
+{
+   const Real nn = static_cast<Real>(n) * static_cast<Real>(n + 1);
+   for (std::size_t i = 0; i < data.abscissa.size(); ++i)
+   {
+      Real x = data.abscissa[i];
+      Real p, dp;
+      legendre_p_and_prime(n, x, p, dp);
+      x -= p / dp;
+      legendre_p_and_prime(n, x, p, dp);
+      Real delta = p / dp;
+      Real s = (1 - x) * (1 + x);
+      Real d2p = (2 * x * dp - nn * p) / s;
+      dp -= delta * d2p;
+      s += 2 * x * delta;
+      data.abscissa[i] = x;
+      data.weights[i] = 2 / (s * dp * dp);
+   }
+}
+
+template <class Real>
+void compute_gauss_legendre(std::size_t n, gauss_legendre_data<Real>& result)
+{
+   typedef typename gauss_legendre_working_type<Real>::type W;
+   gauss_legendre_data<W> data;
+   compute_gauss_legendre_imp(n, data);
+   if (std::is_same<W, Real>::value)
+      polish_gauss_legendre(n, data);
+   result.abscissa.assign(data.abscissa.begin(), data.abscissa.end());
+   result.weights.assign(data.weights.begin(), data.weights.end());
+}
+
+//
+// The rule for each number of points is computed once and then shared by every
+// gauss_legendre object with that number of points:
+//
+template <class Real>
+std::shared_ptr<const gauss_legendre_data<Real> > gauss_legendre_tables(std::size_t n)
+{
+   typedef std::map<std::size_t, std::shared_ptr<const gauss_legendre_data<Real> > > cache_type;
+   static cache_type cache;
+   static boost::detail::lightweight_mutex mutex;
+   {
+      boost::detail::lightweight_mutex::scoped_lock guard(mutex);
+      typename cache_type::const_iterator pos = cache.find(n);
+      if (pos != cache.end())
+         return pos->second;
+   }
+   // Computed without holding the lock, if another thread gets there first we use its tables:
+   std::shared_ptr<gauss_legendre_data<Real> > data = std::make_shared<gauss_legendre_data<Real> >();
+   compute_gauss_legendre(n, *data);
+   boost::detail::lightweight_mutex::scoped_lock guard(mutex);
+   return cache.insert(std::make_pair(n, std::shared_ptr<const gauss_legendre_data<Real> >(data))).first->second;
+}
+
+}
+
+//
+// Gauss-Legendre quadrature with the number of points chosen at runtime.
+//
+template <class Real, class Policy = boost::math::policies::policy<> >
+class gauss_legendre
+{
+public:
+   explicit gauss_legendre(std::size_t points) : m_points(points)
+   {
+      if (points == 0)
+      {
+         policies::raise_domain_error<Real>("boost::math::quadrature::gauss_legendre<%1%>::gauss_legendre(std::size_t)", "The number of points must be at least one, but got %1%.", Real(0), Policy());
+         m_points = 1;
+      }
+      m_data = detail::gauss_legendre_tables<Real>(m_points);
+   }
+
+   std::size_t points()const { return m_points; }
+   // The non-negative abscissas in increasing order, and their weights, as for gauss<Real, N>:
+   const std::vector<Real>& abscissa()const { return m_data->abscissa; }
+   const std::vector<Real>& weights()const { return m_data->weights; }
+
+   template <class F>
+   auto integrate(F f, Real* pL1 = nullptr)const->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      return integrate_imp(f, pL1, detail::is_vector_valued<typename std::decay<decltype(f(Real(0)))>::type>());
+   }
+   template <class F>
+   auto integrate(F f, Real a, Real b, Real* pL1 = nullptr)const->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      return integrate_imp(f, a, b, pL1, detail::is_vector_valued<typename std::decay<decltype(f(a))>::type>());
+   }
+
+private:
+   struct rule
+   {
+      const detail::gauss_legendre_data<Real>* data;
+      bool odd;
+
+      template <class F>
+      auto operator()(F f, Real* pL1)const->decltype(std::declval<F>()(std::declval<Real>()))
+      {
+         return detail::gauss_sum<Real>(f, data->abscissa, data->weights, odd, pL1);
+      }
+   };
+
+   template <class F>
+   auto integrate_imp(F f, Real* pL1, const std::false_type&)const->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      rule r = { m_data.get(), (m_points & 1) != 0 };
+      return r(f, pL1);
+   }
+   template <class F>
+   auto integrate_imp(F f, Real* pL1, const std::true_type&)const->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      return integrate(detail::make_vector_valued_integrand<Real>(f), pL1).value();
+   }
+   template <class F>
+   auto integrate_imp(F f, Real a, Real b, Real* pL1, const std::false_type&)const->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      static const char* function = "boost::math::quadrature::gauss_legendre<%1%>::integrate(f, %1%, %1%)";
+      rule r = { m_data.get(), (m_points & 1) != 0 };
+      return detail::gauss_integrate_mapped<Real, Policy>(f, a, b, pL1, r, function);
+   }
+   template <class F>
+   auto integrate_imp(F f, Real a, Real b, Real* pL1, const std::true_type&)const->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      return integrate(detail::make_vector_valued_integrand<Real>(f), a, b, pL1).value();
+   }
+
+   std::size_t m_points;
+   std::shared_ptr<const detail::gauss_legendre_data<Real> > m_data;
+};
+
+} // namespace quadrature
+} // namespace math
+} // namespace boost
+
+#endif // BOOST_MATH_QUADRATURE_GAUSS_LEGENDRE_HPP
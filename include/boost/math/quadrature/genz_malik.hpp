@@ -0,0 +1,359 @@
+//  Copyright 2020 Boost.Math contributors
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ * Adaptive cubature over hyperrectangles, with the degree 7 rule of Genz and Malik and its embedded
+ * degree 5 rule for the error estimate.
+ *
+ * References:
+ *
+ * 1) A. C. Genz and A. A. Malik, "Remarks on algorithm 006: An adaptive algorithm for numerical integration over
+ *    an N-dimensional rectangular region", Journal of Computational and Applied Mathematics 6 (1980) 295-302.
+ * 2) J. Berntsen, T. O. Espelid and A. Genz, "An adaptive algorithm for the approximate calculation of multiple
+ *    integrals", ACM Transactions on Mathematical Software 17 (1991) 437-451.
+ */
+
+#ifndef BOOST_MATH_QUADRATURE_GENZ_MALIK_HPP
+#define BOOST_MATH_QUADRATURE_GENZ_MALIK_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/math/policies/error_handling.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/tools/precision.hpp>
+#include <boost/math/quadrature/detail/thread_team.hpp>
+#include <boost/math/quadrature/detail/vector_valued.hpp>
+
+namespace boost { namespace math { namespace quadrature {
+
+namespace detail {
+
+template <class Real, class K>
+struct genz_malik_region
+{
+   std::vector<Real> a, b;
+   K result;
+   Real error, L1;
+   unsigned depth;
+   // The coordinate along which the integrand's fourth difference is largest, which is the one to bisect:
+   std::size_t split;
+};
+
+}
+
+//
+// Reports the work done by genz_malik::integrate:
+//
+struct genz_malik_statistics
+{
+   genz_malik_statistics() : regions(0), evaluations(0), depth(0) {}
+
+   std::size_t regions;     // Number of subregions in the final partition of the domain.
+   std::size_t evaluations; // Number of calls to the integrand.
+   unsigned depth;          // Largest number of bisections leading to any one subregion.
+};
+
+template <class Real, class Policy = boost::math::policies::policy<> >
+class genz_malik
+{
+   // Applies the rule to one region, setting its result, error and L1 norm, and choosing the coordinate to split:
+   template <class F, class K>
+   static void evaluate(const F& f, detail::genz_malik_region<Real, K>& region)
+   {
+      using std::abs;
+      using std::ldexp;
+      using std::sqrt;
+      const std::size_t n = region.a.size();
+      const Real lambda2 = sqrt(Real(9) / 70);
+      const Real lambda3 = sqrt(Real(9) / 10);
+      const Real lambda4 = lambda3;
+      const Real lambda5 = sqrt(Real(9) / 19);
+      // The degree 7 weights, normalised so that they sum to one:
+      const Real r = static_cast<Real>(n);
+      const Real w1 = (12824 - 9120 * r + 400 * r * r) / 19683;
+      const Real w2 = Real(980) / 6561;
+      const Real w3 = (1820 - 400 * r) / 19683;
+      const Real w4 = Real(200) / 19683;
+      const Real w5 = ldexp(Real(6859) / 19683, -static_cast<int>(n));
+      // And those of the embedded degree 5 rule:
+      const Real v1 = (729 - 950 * r + 50 * r * r) / 729;
+      const Real v2 = Real(245) / 486;
+      const Real v3 = (265 - 100 * r) / 1458;
+      const Real v4 = Real(25) / 729;
+
+      std::vector<Real> center(n), half_width(n), x(n);
+      Real volume = 1;
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         center[i] = (region.a[i] + region.b[i]) / 2;
+         half_width[i] = (region.b[i] - region.a[i]) / 2;
+         volume *= region.b[i] - region.a[i];
+      }
+
+      x = center;
+      K f1 = f(x);
+      K s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+      Real a2 = 0, a3 = 0, a4 = 0, a5 = 0;
+      Real max_difference = -1;
+      region.split = 0;
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         x[i] = center[i] - lambda2 * half_width[i];
+         K f2m = f(x);
+         x[i] = center[i] + lambda2 * half_width[i];
+         K f2p = f(x);
+         x[i] = center[i] - lambda3 * half_width[i];
+         K f3m = f(x);
+         x[i] = center[i] + lambda3 * half_width[i];
+         K f3p = f(x);
+         x[i] = center[i];
+         s2 += f2m;
+         s2 += f2p;
+         s3 += f3m;
+         s3 += f3p;
+         a2 += abs(f2m) + abs(f2p);
+         a3 += abs(f3m) + abs(f3p);
+         // The fourth difference, with the second differences at the two radii cancelling exactly for quadratics:
+         K difference = f2m + f2p - 2 * f1;
+         difference -= (f3m + f3p - 2 * f1) * (lambda2 * lambda2 / (lambda3 * lambda3));
+         Real d = abs(difference);
+         // Break ties in favour of the widest side:
+         if ((d > max_difference) || ((d == max_difference) && (half_width[i] > half_width[region.split])))
+         {
+            max_difference = d;
+            region.split = i;
+         }
+      }
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         for (std::size_t j = i + 1; j < n; ++j)
+         {
+            for (int corner = 0; corner < 4; ++corner)
+            {
+               x[i] = center[i] + ((corner & 1) ? lambda4 : -lambda4) * half_width[i];
+               x[j] = center[j] + ((corner & 2) ? lambda4 : -lambda4) * half_width[j];
+               K y = f(x);
+               s4 += y;
+               a4 += abs(y);
+            }
+            x[j] = center[j];
+         }
+         x[i] = center[i];
+      }
+      for (std::size_t corner = 0; corner < (std::size_t(1) << n); ++corner)
+      {
+         for (std::size_t i = 0; i < n; ++i)
+            x[i] = center[i] + ((corner >> i) & 1 ? lambda5 : -lambda5) * half_width[i];
+         K y = f(x);
+         s5 += y;
+         a5 += abs(y);
+      }
+
+      K I7 = f1 * w1 + s2 * w2 + s3 * w3 + s4 * w4 + s5 * w5;
+      K I5 = f1 * v1 + s2 * v2 + s3 * v3 + s4 * v4;
+      region.result = I7 * volume;
+      region.error = abs(I7 - I5) * volume;
+      // The same rule applied to |f|, which is an estimate of the L1 norm:
+      region.L1 = abs(abs(f1) * w1 + a2 * w2 + a3 * w3 + a4 * w4 + a5 * w5) * volume;
+   }
+
+   static std::size_t evaluations_per_region(std::size_t n)
+   {
+      return (std::size_t(1) << n) + 2 * n * n + 2 * n + 1;
+   }
+
+   //
+   // Global adaptive integration over the box [a, b]: the current partition is kept in a heap ordered by
+   // error estimate, and the regions with the largest errors are bisected until the total error meets
+   // the tolerance or max_regions is reached.  As in gauss_kronrod::integrate_global, each step bisects
+   // the worst regions_per_step, whose children are evaluated concurrently by team.
+   //
+   template <class F>
+   static auto integrate_box(const F& f, const std::vector<Real>& a, const std::vector<Real>& b, std::size_t max_regions, Real tol, Real* error, Real* pL1, genz_malik_statistics* stats, detail::thread_team& team, std::size_t regions_per_step)
+      ->typename std::decay<decltype(f(a))>::type
+   {
+      typedef typename std::decay<decltype(f(a))>::type K;
+      typedef detail::genz_malik_region<Real, K> region;
+      using std::abs;
+      auto by_error = [](const region& x, const region& y) { return x.error < y.error; };
+
+      std::vector<region> heap(1);
+      heap[0].a = a;
+      heap[0].b = b;
+      heap[0].depth = 0;
+      evaluate(f, heap[0]);
+      std::size_t evaluations = 1;
+      // Running totals, which are recomputed exactly before we stop:
+      K result = heap[0].result;
+      Real err = heap[0].error;
+
+      std::vector<region> parents, children;
+      while ((boost::math::isfinite)(err))
+      {
+         if (err <= abs(result * tol))
+         {
+            result = 0;
+            err = 0;
+            for (std::size_t i = 0; i < heap.size(); ++i)
+            {
+               result += heap[i].result;
+               err += heap[i].error;
+            }
+            if (err <= abs(result * tol))
+               break;
+         }
+         //
+         // Take the worst regions, stopping at any which can no longer be bisected, since
+         // their error will not go down any further:
+         //
+         parents.clear();
+         while (!heap.empty() && (parents.size() < regions_per_step) && (heap.size() + 2 * parents.size() < max_regions))
+         {
+            const region& worst = heap.front();
+            std::size_t s = worst.split;
+            Real mid = (worst.a[s] + worst.b[s]) / 2;
+            if ((mid <= worst.a[s]) || (mid >= worst.b[s]))
+               break;
+            std::pop_heap(heap.begin(), heap.end(), by_error);
+            parents.push_back(std::move(heap.back()));
+            heap.pop_back();
+         }
+         if (parents.empty())
+            break;
+         children.resize(2 * parents.size());
+         for (std::size_t i = 0; i < parents.size(); ++i)
+         {
+            std::size_t s = parents[i].split;
+            Real mid = (parents[i].a[s] + parents[i].b[s]) / 2;
+            children[2 * i].a = children[2 * i + 1].a = parents[i].a;
+            children[2 * i].b = children[2 * i + 1].b = parents[i].b;
+            children[2 * i].b[s] = mid;
+            children[2 * i + 1].a[s] = mid;
+            children[2 * i].depth = children[2 * i + 1].depth = parents[i].depth + 1;
+         }
+         team.for_each_index(children.size(), [&](std::size_t i) { evaluate(f, children[i]); });
+         evaluations += children.size();
+         for (std::size_t i = 0; i < parents.size(); ++i)
+         {
+            result -= parents[i].result;
+            err -= parents[i].error;
+         }
+         for (std::size_t i = 0; i < children.size(); ++i)
+         {
+            result += children[i].result;
+            err += children[i].error;
+            heap.push_back(std::move(children[i]));
+            std::push_heap(heap.begin(), heap.end(), by_error);
+         }
+      }
+
+      result = 0;
+      err = 0;
+      Real L1 = 0;
+      unsigned depth = 0;
+      for (std::size_t i = 0; i < heap.size(); ++i)
+      {
+         result += heap[i].result;
+         err += heap[i].error;
+         L1 += heap[i].L1;
+         depth = (std::max)(depth, heap[i].depth);
+      }
+      if (error)
+         *error = err;
+      if (pL1)
+         *pL1 = L1;
+      if (stats)
+      {
+         stats->regions = heap.size();
+         stats->evaluations = evaluations * evaluations_per_region(a.size());
+         stats->depth = depth;
+      }
+      return result;
+   }
+
+   //
+   // Checks the bounds and orders each pair, then integrates over the box; reversing a pair of
+   // bounds changes the sign of the integral, as in one dimension:
+   //
+   template <class F>
+   static auto integrate_bounds(const F& f, const std::vector<std::pair<Real, Real> >& bounds, std::size_t max_regions, Real tol, Real* error, Real* pL1, genz_malik_statistics* stats, detail::thread_team& team, std::size_t regions_per_step)
+      ->typename std::decay<decltype(f(std::declval<const std::vector<Real>&>()))>::type
+   {
+      typedef typename std::decay<decltype(f(std::declval<const std::vector<Real>&>()))>::type K;
+      static const char* function = "boost::math::quadrature::genz_malik<%1%>::integrate";
+      const std::size_t n = bounds.size();
+      // The rule uses all 2^n corners of a box around the centre of each region:
+      if ((n == 0) || (n > 20))
+         return static_cast<K>(policies::raise_domain_error(function, "The rule is only available in 1 to 20 dimensions, but %1% were requested.", static_cast<Real>(n), Policy()));
+      std::vector<Real> a(n), b(n);
+      Real sign = 1;
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         a[i] = bounds[i].first;
+         b[i] = bounds[i].second;
+         if (!(boost::math::isfinite)(a[i]) || !(boost::math::isfinite)(b[i]))
+            return static_cast<K>(policies::raise_domain_error(function, "The bounds of integration must be finite, but got %1%.", (boost::math::isfinite)(a[i]) ? b[i] : a[i], Policy()));
+         if (a[i] == b[i])
+         {
+            if (error)
+               *error = 0;
+            if (pL1)
+               *pL1 = 0;
+            return K(0);
+         }
+         if (b[i] < a[i])
+         {
+            std::swap(a[i], b[i]);
+            sign = -sign;
+         }
+      }
+      return integrate_box(f, a, b, max_regions, tol, error, pL1, stats, team, regions_per_step) * sign;
+   }
+   // Vector valued integrands are integrated componentwise, with errors measured in the maximum norm:
+   template <class F>
+   static auto integrate_imp(const F& f, const std::vector<std::pair<Real, Real> >& bounds, std::size_t max_regions, Real tol, Real* error, Real* pL1, genz_malik_statistics* stats, detail::thread_team& team, std::size_t regions_per_step, const std::true_type&)
+      ->typename std::decay<decltype(f(std::declval<const std::vector<Real>&>()))>::type
+   {
+      return integrate_bounds(detail::make_vector_valued_integrand<Real>(f), bounds, max_regions, tol, error, pL1, stats, team, regions_per_step).value();
+   }
+   template <class F>
+   static auto integrate_imp(const F& f, const std::vector<std::pair<Real, Real> >& bounds, std::size_t max_regions, Real tol, Real* error, Real* pL1, genz_malik_statistics* stats, detail::thread_team& team, std::size_t regions_per_step, const std::false_type&)
+      ->typename std::decay<decltype(f(std::declval<const std::vector<Real>&>()))>::type
+   {
+      return integrate_bounds(f, bounds, max_regions, tol, error, pL1, stats, team, regions_per_step);
+   }
+
+public:
+   typedef Real value_type;
+
+   //
+   // Integrates f(x), where x is a std::vector<Real> of coordinates, over the box whose i'th side runs from
+   // bounds[i].first to bounds[i].second.  The regions with the largest error estimates are repeatedly bisected
+   // until the estimated error of the whole is below tol relative to the result, or the partition has
+   // max_regions regions.  With threads > 1, f is called concurrently from that many threads (0 means
+   // std::thread::hardware_concurrency()), with each step bisecting as many of the worst regions as there are threads.
+   //
+   template <class F>
+   static auto integrate(F f, const std::vector<std::pair<Real, Real> >& bounds, std::size_t max_regions = 10000, Real tol = tools::root_epsilon<Real>(), Real* error = nullptr, Real* pL1 = nullptr, genz_malik_statistics* stats = nullptr, unsigned threads = 1)
+      ->typename std::decay<decltype(f(std::declval<const std::vector<Real>&>()))>::type
+   {
+      typedef typename std::decay<decltype(f(std::declval<const std::vector<Real>&>()))>::type K;
+      if (threads == 0)
+         threads = (std::max)(std::thread::hardware_concurrency(), 1u);
+      if (stats)
+         *stats = genz_malik_statistics();
+      detail::thread_team team(threads);
+      return integrate_imp(f, bounds, (std::max)(max_regions, std::size_t(1)), tol, error, pL1, stats, team, threads, detail::is_vector_valued<K>());
+   }
+};
+
+}}} // namespaces
+
+#endif // BOOST_MATH_QUADRATURE_GENZ_MALIK_HPP
@@ -10,6 +10,7 @@
 #include <algorithm>
 #include <vector>
 #include <boost/atomic.hpp>
+#include <boost/align/aligned_allocator.hpp>
 #include <functional>
 #include <future>
 #include <thread>
@@ -19,14 +20,24 @@
 #include <chrono>
 #include <map>
 #include <boost/math/policies/error_handling.hpp>
+#include <boost/math/quadrature/detail/monte_carlo_domain.hpp>
 
 namespace boost { namespace math { namespace quadrature {
 
 namespace detail {
-  enum class limit_classification {FINITE,
-                                   LOWER_BOUND_INFINITE,
-                                   UPPER_BOUND_INFINITE,
-                                   DOUBLE_INFINITE};
+  // The running sums of one worker thread, which it publishes after each batch of integrand calls
+  // and the master thread reads.  Each thread's sums get cache lines of their own (and the lines
+  // either side, which some processors prefetch in pairs), since if they shared a line with another
+  // thread's, every publication would invalidate it in that thread's core too.
+  static const std::size_t naive_monte_carlo_cache_line_size = 128;
+
+  template<class Real>
+  struct alignas(naive_monte_carlo_cache_line_size) naive_monte_carlo_thread_state
+  {
+      boost::atomic<uint64_t> calls;
+      boost::atomic<Real> S;
+      boost::atomic<Real> average;
+  };
 }
 
 template<class Real, class F, class RandomNumberGenerator = std::mt19937_64, class Policy = boost::math::policies::policy<>>
@@ -38,117 +49,19 @@ public:
                       Real error_goal,
                       bool singular = true,
                       uint64_t threads = std::thread::hardware_concurrency(),
-                      uint64_t seed = 0): m_num_threads{threads}, m_seed{seed}
+                      uint64_t seed = 0): m_num_threads{(std::max)(threads, (uint64_t) 1)}, m_seed{seed},
+                                          m_thread_state(static_cast<std::size_t>(m_num_threads)),
+                                          m_domain(bounds, singular, "boost::math::quadrature::naive_monte_carlo<%1%>")
     {
-        using std::numeric_limits;
-        using std::sqrt;
-        uint64_t n = bounds.size();
-        m_lbs.resize(n);
-        m_dxs.resize(n);
-        m_limit_types.resize(n);
-        m_volume = 1;
-        static const char* function = "boost::math::quadrature::naive_monte_carlo<%1%>";
-        for (uint64_t i = 0; i < n; ++i)
-        {
-            if (bounds[i].second <= bounds[i].first)
-            {
-                boost::math::policies::raise_domain_error(function, "The upper bound is <= the lower bound.\n", bounds[i].second, Policy());
-                return;
-            }
-            if (bounds[i].first == -numeric_limits<Real>::infinity())
-            {
-                if (bounds[i].second == numeric_limits<Real>::infinity())
-                {
-                    m_limit_types[i] = detail::limit_classification::DOUBLE_INFINITE;
-                }
-                else
-                {
-                    m_limit_types[i] = detail::limit_classification::LOWER_BOUND_INFINITE;
-                    // Ok ok this is bad to use the second bound as the lower limit and then reflect.
-                    m_lbs[i] = bounds[i].second;
-                    m_dxs[i] = numeric_limits<Real>::quiet_NaN();
-                }
-            }
-            else if (bounds[i].second == numeric_limits<Real>::infinity())
-            {
-                m_limit_types[i] = detail::limit_classification::UPPER_BOUND_INFINITE;
-                if (singular)
-                {
-                    // I've found that it's easier to sample on a closed set and perturb the boundary
-                    // than to try to sample very close to the boundary.
-                    m_lbs[i] = std::nextafter(bounds[i].first, (std::numeric_limits<Real>::max)());
-                }
-                else
-                {
-                    m_lbs[i] = bounds[i].first;
-                }
-                m_dxs[i] = numeric_limits<Real>::quiet_NaN();
-            }
-            else
-            {
-                m_limit_types[i] = detail::limit_classification::FINITE;
-                if (singular)
-                {
-                    if (bounds[i].first == 0)
-                    {
-                        m_lbs[i] = std::numeric_limits<Real>::epsilon();
-                    }
-                    else
-                    {
-                        m_lbs[i] = std::nextafter(bounds[i].first, (std::numeric_limits<Real>::max)());
-                    }
-
-                    m_dxs[i] = std::nextafter(bounds[i].second, std::numeric_limits<Real>::lowest()) - m_lbs[i];
-                }
-                else
-                {
-                    m_lbs[i] = bounds[i].first;
-                    m_dxs[i] = bounds[i].second - bounds[i].first;
-                }
-                m_volume *= m_dxs[i];
-            }
-        }
-
         m_integrand = [this, &integrand](std::vector<Real> & x)->Real
         {
-            Real coeff = m_volume;
-            for (uint64_t i = 0; i < x.size(); ++i)
-            {
-                // Variable transformation are listed at:
-                // https://en.wikipedia.org/wiki/Numerical_integration
-                // However, we've made some changes to these so that we can evaluate on a compact domain.
-                if (m_limit_types[i] == detail::limit_classification::FINITE)
-                {
-                    x[i] = m_lbs[i] + x[i]*m_dxs[i];
-                }
-                else if (m_limit_types[i] == detail::limit_classification::UPPER_BOUND_INFINITE)
-                {
-                    Real t = x[i];
-                    Real z = 1/(1 + numeric_limits<Real>::epsilon() - t);
-                    coeff *= (z*z)*(1 + numeric_limits<Real>::epsilon());
-                    x[i] = m_lbs[i] + t*z;
-                }
-                else if (m_limit_types[i] == detail::limit_classification::LOWER_BOUND_INFINITE)
-                {
-                    Real t = x[i];
-                    Real z = 1/(t+sqrt((numeric_limits<Real>::min)()));
-                    coeff *= (z*z);
-                    x[i] = m_lbs[i] + (t-1)*z;
-                }
-                else
-                {
-                    Real t1 = 1/(1+numeric_limits<Real>::epsilon() - x[i]);
-                    Real t2 = 1/(x[i]+numeric_limits<Real>::epsilon());
-                    x[i] = (2*x[i]-1)*t1*t2/4;
-                    coeff *= (t1*t1+t2*t2)/4;
-                }
-            }
+            Real coeff = m_domain.transform(x);
             return coeff*integrand(x);
         };
 
         // If we don't do a single function call in the constructor,
         // we can't do a restart.
-        std::vector<Real> x(m_lbs.size());
+        std::vector<Real> x(m_domain.dimension());
 
         // If the seed is zero, that tells us to choose a random seed for the user:
         if (seed == 0)
@@ -160,22 +73,17 @@ public:
         RandomNumberGenerator gen(seed);
         Real inv_denom = 1/static_cast<Real>(((gen.max)()-(gen.min)()));
 
-        m_num_threads = (std::max)(m_num_threads, (uint64_t) 1);
-        m_thread_calls.reset(new boost::atomic<uint64_t>[threads]);
-        m_thread_Ss.reset(new boost::atomic<Real>[threads]);
-        m_thread_averages.reset(new boost::atomic<Real>[threads]);
-
         Real avg = 0;
         for (uint64_t i = 0; i < m_num_threads; ++i)
         {
-            for (uint64_t j = 0; j < m_lbs.size(); ++j)
+            for (uint64_t j = 0; j < m_domain.dimension(); ++j)
             {
                 x[j] = (gen()-(gen.min)())*inv_denom;
             }
             Real y = m_integrand(x);
-            m_thread_averages[i] = y; // relaxed store
-            m_thread_calls[i] = 1;
-            m_thread_Ss[i] = 0;
+            m_thread_state[i].average = y; // relaxed store
+            m_thread_state[i].calls = 1;
+            m_thread_state[i].S = 0;
             avg += y;
         }
         avg /= m_num_threads;
@@ -185,7 +93,7 @@ public:
         m_start = std::chrono::system_clock::now();
         m_done = false; // relaxed store
         m_total_calls = m_num_threads;  // relaxed store
-        m_variance = (numeric_limits<Real>::max)();
+        m_variance = (std::numeric_limits<Real>::max)();
     }
 
     std::future<Real> integrate()
@@ -288,11 +196,11 @@ private:
             std::cout << "  total calls = " << m_total_calls << std::endl;
 
             for (std::size_t i = 0; i < m_num_threads; ++i)
-               std::cout << "  thread_calls[" << i << "] = " << m_thread_calls[i] << std::endl;
+               std::cout << "  thread_calls[" << i << "] = " << m_thread_state[i].calls << std::endl;
             for (std::size_t i = 0; i < m_num_threads; ++i)
-               std::cout << "  thread_averages[" << i << "] = " << m_thread_averages[i] << std::endl;
+               std::cout << "  thread_averages[" << i << "] = " << m_thread_state[i].average << std::endl;
             for (std::size_t i = 0; i < m_num_threads; ++i)
-               std::cout << "  thread_Ss[" << i << "] = " << m_thread_Ss[i] << std::endl;
+               std::cout << "  thread_Ss[" << i << "] = " << m_thread_state[i].S << std::endl;
 #endif
          }
 
@@ -306,17 +214,17 @@ private:
             uint64_t total_calls = 0;
             for (uint64_t i = 0; i < m_num_threads; ++i)
             {
-               uint64_t t_calls = m_thread_calls[i].load(boost::memory_order::consume);
+               uint64_t t_calls = m_thread_state[i].calls.load(boost::memory_order::consume);
                total_calls += t_calls;
             }
             Real variance = 0;
             Real avg = 0;
             for (uint64_t i = 0; i < m_num_threads; ++i)
             {
-               uint64_t t_calls = m_thread_calls[i].load(boost::memory_order::consume);
+               uint64_t t_calls = m_thread_state[i].calls.load(boost::memory_order::consume);
                // Will this overflow? Not hard to remove . . .
-               avg += m_thread_averages[i].load(boost::memory_order::relaxed)*((Real)t_calls / (Real)total_calls);
-               variance += m_thread_Ss[i].load(boost::memory_order::relaxed);
+               avg += m_thread_state[i].average.load(boost::memory_order::relaxed)*((Real)t_calls / (Real)total_calls);
+               variance += m_thread_state[i].S.load(boost::memory_order::relaxed);
             }
             m_avg.store(avg, boost::memory_order::release);
             m_variance.store(variance / (total_calls - 1), boost::memory_order::release);
@@ -339,7 +247,7 @@ private:
          uint64_t total_calls = 0;
          for (uint64_t i = 0; i < m_num_threads; ++i)
          {
-            uint64_t t_calls = m_thread_calls[i].load(boost::memory_order::consume);
+            uint64_t t_calls = m_thread_state[i].calls.load(boost::memory_order::consume);
             total_calls += t_calls;
          }
          Real variance = 0;
@@ -347,10 +255,10 @@ private:
 
          for (uint64_t i = 0; i < m_num_threads; ++i)
          {
-            uint64_t t_calls = m_thread_calls[i].load(boost::memory_order::consume);
+            uint64_t t_calls = m_thread_state[i].calls.load(boost::memory_order::consume);
             // Averages weighted by the number of calls the thread made:
-            avg += m_thread_averages[i].load(boost::memory_order::relaxed)*((Real)t_calls / (Real)total_calls);
-            variance += m_thread_Ss[i].load(boost::memory_order::relaxed);
+            avg += m_thread_state[i].average.load(boost::memory_order::relaxed)*((Real)t_calls / (Real)total_calls);
+            variance += m_thread_state[i].S.load(boost::memory_order::relaxed);
          }
          m_avg.store(avg, boost::memory_order::release);
          m_variance.store(variance / (total_calls - 1), boost::memory_order::release);
@@ -370,17 +278,18 @@ private:
         using std::numeric_limits;
         try
         {
-            std::vector<Real> x(m_lbs.size());
+            std::vector<Real> x(m_domain.dimension());
             RandomNumberGenerator gen(seed);
             Real inv_denom = (Real) 1/(Real)( (gen.max)() - (gen.min)()  );
-            Real M1 = m_thread_averages[thread_index].load(boost::memory_order::consume);
-            Real S = m_thread_Ss[thread_index].load(boost::memory_order::consume);
+            detail::naive_monte_carlo_thread_state<Real>& state = m_thread_state[thread_index];
+            Real M1 = state.average.load(boost::memory_order::consume);
+            Real S = state.S.load(boost::memory_order::consume);
             // Kahan summation is required or the value of the integrand will go on a random walk during long computations.
             // See the implementation discussion.
             // The idea is that the unstabilized additions have error sigma(f)/sqrt(N) + epsilon*N, which diverges faster than it converges!
             // Kahan summation turns this to sigma(f)/sqrt(N) + epsilon^2*N, and the random walk occurs on a timescale of 10^14 years (on current hardware)
             Real compensator = 0;
-            uint64_t k = m_thread_calls[thread_index].load(boost::memory_order::consume);
+            uint64_t k = state.calls.load(boost::memory_order::consume);
             while (!m_done) // relaxed load
             {
                 int j = 0;
@@ -391,7 +300,7 @@ private:
                 int magic_calls_before_update = 2048;
                 while (j++ < magic_calls_before_update)
                 {
-                    for (uint64_t i = 0; i < m_lbs.size(); ++i)
+                    for (uint64_t i = 0; i < m_domain.dimension(); ++i)
                     {
                         x[i] = (gen() - (gen.min)())*inv_denom;
                     }
@@ -418,9 +327,10 @@ private:
                     S += (f - M1)*(f - M2);
                     M1 = M2;
                 }
-                m_thread_averages[thread_index].store(M1, boost::memory_order::release);
-                m_thread_Ss[thread_index].store(S, boost::memory_order::release);
-                m_thread_calls[thread_index].store(k, boost::memory_order::release);
+                // Everything above is in locals; only now does this thread write to memory the others can see:
+                state.average.store(M1, boost::memory_order::release);
+                state.S.store(S, boost::memory_order::release);
+                state.calls.store(k, boost::memory_order::release);
             }
         }
         catch (...)
@@ -434,20 +344,15 @@ private:
     std::function<Real(std::vector<Real> &)> m_integrand;
     uint64_t m_num_threads;
     uint64_t m_seed;
+    // Sized once in the constructor, since atomics can't be moved:
+    std::vector<detail::naive_monte_carlo_thread_state<Real>,
+                boost::alignment::aligned_allocator<detail::naive_monte_carlo_thread_state<Real>, detail::naive_monte_carlo_cache_line_size>> m_thread_state;
     boost::atomic<Real> m_error_goal;
     boost::atomic<bool> m_done;
-    std::vector<Real> m_lbs;
-    std::vector<Real> m_dxs;
-    std::vector<detail::limit_classification> m_limit_types;
-    Real m_volume;
+    detail::monte_carlo_domain<Real, Policy> m_domain;
     boost::atomic<uint64_t> m_total_calls;
-    // I wanted these to be vectors rather than maps,
-    // but you can't resize a vector of atomics.
-    std::unique_ptr<boost::atomic<uint64_t>[]> m_thread_calls;
     boost::atomic<Real> m_variance;
-    std::unique_ptr<boost::atomic<Real>[]> m_thread_Ss;
     boost::atomic<Real> m_avg;
-    std::unique_ptr<boost::atomic<Real>[]> m_thread_averages;
     std::chrono::time_point<std::chrono::system_clock> m_start;
     std::exception_ptr m_exception;
 };
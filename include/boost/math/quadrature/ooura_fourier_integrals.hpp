@@ -22,11 +22,26 @@ public:
     ooura_fourier_sin(const Real relative_error_tolerance = tools::root_epsilon<Real>(), size_t levels = sizeof(Real)) : impl_(std::make_shared<detail::ooura_fourier_sin_detail<Real>>(relative_error_tolerance, levels))
     {}
 
+    // Constructs from the nodes and weights written by save_tables, which is far quicker than computing them:
+    explicit ooura_fourier_sin(std::istream& is, const Real relative_error_tolerance = tools::root_epsilon<Real>()) : impl_(std::make_shared<detail::ooura_fourier_sin_detail<Real>>(is, relative_error_tolerance))
+    {}
+
     template<class F>
     std::pair<Real, Real> integrate(F const & f, Real omega) {
         return impl_->integrate(f, omega);
     }
 
+    // Integrates at every frequency in omegas, returning the results in the same order:
+    template<class F, class RandomAccessContainer>
+    auto integrate(F const & f, RandomAccessContainer const & omegas) -> decltype((void)omegas.size(), std::vector<std::pair<Real, Real>>()) {
+        return impl_->integrate(f, omegas);
+    }
+
+    // Writes the nodes and weights of all the levels computed so far:
+    void save_tables(std::ostream& os) const {
+        impl_->save(os);
+    }
+
     // These are just for debugging/unit tests:
     std::vector<std::vector<Real>> const & big_nodes() const {
         return impl_->big_nodes();
@@ -55,10 +70,25 @@ public:
     ooura_fourier_cos(const Real relative_error_tolerance = tools::root_epsilon<Real>(), size_t levels = sizeof(Real)) : impl_(std::make_shared<detail::ooura_fourier_cos_detail<Real>>(relative_error_tolerance, levels))
     {}
 
+    // Constructs from the nodes and weights written by save_tables, which is far quicker than computing them:
+    explicit ooura_fourier_cos(std::istream& is, const Real relative_error_tolerance = tools::root_epsilon<Real>()) : impl_(std::make_shared<detail::ooura_fourier_cos_detail<Real>>(is, relative_error_tolerance))
+    {}
+
     template<class F>
     std::pair<Real, Real> integrate(F const & f, Real omega) {
         return impl_->integrate(f, omega);
     }
+
+    // Integrates at every frequency in omegas, returning the results in the same order:
+    template<class F, class RandomAccessContainer>
+    auto integrate(F const & f, RandomAccessContainer const & omegas) -> decltype((void)omegas.size(), std::vector<std::pair<Real, Real>>()) {
+        return impl_->integrate(f, omegas);
+    }
+
+    // Writes the nodes and weights of all the levels computed so far:
+    void save_tables(std::ostream& os) const {
+        impl_->save(os);
+    }
 private:
     std::shared_ptr<detail::ooura_fourier_cos_detail<Real>> impl_;
 };
@@ -0,0 +1,545 @@
+/*
+ * Copyright Boost.Math contributors, 2020
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef BOOST_MATH_QUADRATURE_QUASI_MONTE_CARLO_HPP
+#define BOOST_MATH_QUADRATURE_QUASI_MONTE_CARLO_HPP
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <future>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <boost/atomic.hpp>
+#include <boost/math/policies/error_handling.hpp>
+#include <boost/math/special_functions/prime.hpp>
+#include <boost/math/quadrature/detail/monte_carlo_domain.hpp>
+#include <boost/math/quadrature/detail/thread_team.hpp>
+
+namespace boost { namespace math { namespace quadrature {
+
+namespace detail {
+
+  // x / 2^64, rounded down to a value of Real, so that the result is always < 1:
+  template<class Real>
+  Real fixed_point_to_unit_interval(uint64_t x)
+  {
+      using std::ldexp;
+      static const int bits = (std::min)(std::numeric_limits<Real>::digits, 64);
+      static const Real scale = ldexp(Real(1), -bits);
+      return static_cast<Real>(x >> (64 - bits))*scale;
+  }
+
+  inline uint64_t reverse_bits(uint64_t x)
+  {
+      x = ((x >> 1) & 0x5555555555555555ULL) | ((x & 0x5555555555555555ULL) << 1);
+      x = ((x >> 2) & 0x3333333333333333ULL) | ((x & 0x3333333333333333ULL) << 2);
+      x = ((x >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((x & 0x0F0F0F0F0F0F0F0FULL) << 4);
+      x = ((x >> 8) & 0x00FF00FF00FF00FFULL) | ((x & 0x00FF00FF00FF00FFULL) << 8);
+      x = ((x >> 16) & 0x0000FFFF0000FFFFULL) | ((x & 0x0000FFFF0000FFFFULL) << 16);
+      return (x >> 32) | (x << 32);
+  }
+}
+
+// The low discrepancy sequences below all provide
+//
+//   std::size_t dimension() const;
+//   static std::size_t max_dimension();
+//   template<class Real> void operator()(uint64_t k, std::vector<uint64_t> const & shift, std::vector<Real>& x) const;
+//   template<class Real, class G> void for_each_point(uint64_t begin, uint64_t end, std::vector<uint64_t> const & shift, std::vector<Real>& x, G g) const;
+//
+// where operator() sets x to the k'th point of the sequence, randomized by shift: one uniformly
+// distributed 64 bit word per dimension.  for_each_point calls g(x) with x set to each of the points
+// begin to end - 1 in turn, which is cheaper than finding each one from scratch.  g may change x.
+
+// Sobol's sequence, with the direction numbers of Joe and Kuo (new-joe-kuo-6.21201) and randomized by a digital
+// shift, which leaves each block of 2^m points a (t, m, s)-net.
+class sobol_sequence
+{
+public:
+    explicit sobol_sequence(std::size_t dimension) : m_dimension{dimension}, m_directions(64*dimension)
+    {
+        // Dimension, degree s, coefficients a and initial direction numbers m_1..m_s of the primitive polynomial of each dimension after the first:
+        static const unsigned joe_kuo[][10] = {
+            {2, 1, 0, 1}, {3, 2, 1, 1, 3}, {4, 3, 1, 1, 3, 1}, {5, 3, 2, 1, 1, 1},
+            {6, 4, 1, 1, 1, 3, 3}, {7, 4, 4, 1, 3, 5, 13}, {8, 5, 2, 1, 1, 5, 5, 17}, {9, 5, 4, 1, 1, 5, 5, 5},
+            {10, 5, 7, 1, 1, 7, 11, 19}, {11, 5, 11, 1, 1, 5, 1, 1}, {12, 5, 13, 1, 1, 1, 3, 11}, {13, 5, 14, 1, 3, 5, 5, 31},
+            {14, 6, 1, 1, 3, 3, 9, 7, 49}, {15, 6, 13, 1, 1, 1, 15, 21, 21}, {16, 6, 16, 1, 3, 1, 13, 27, 49}, {17, 6, 19, 1, 1, 1, 15, 7, 5},
+            {18, 6, 22, 1, 3, 1, 15, 13, 25}, {19, 6, 25, 1, 1, 5, 5, 19, 61}, {20, 7, 1, 1, 3, 7, 11, 23, 15, 103}, {21, 7, 4, 1, 3, 7, 13, 13, 15, 69},
+            {22, 7, 7, 1, 1, 3, 13, 7, 35, 63}, {23, 7, 8, 1, 3, 5, 9, 1, 25, 53}, {24, 7, 14, 1, 3, 1, 13, 9, 35, 107}, {25, 7, 19, 1, 3, 1, 5, 27, 61, 31},
+            {26, 7, 21, 1, 1, 5, 11, 19, 41, 61}, {27, 7, 28, 1, 3, 5, 3, 3, 13, 69}, {28, 7, 31, 1, 1, 7, 13, 1, 19, 1}, {29, 7, 32, 1, 3, 7, 5, 13, 19, 59},
+            {30, 7, 37, 1, 1, 3, 9, 25, 29, 41}, {31, 7, 41, 1, 3, 5, 13, 23, 1, 55}, {32, 7, 42, 1, 3, 7, 3, 13, 59, 17} };
+        if (dimension > max_dimension())
+        {
+            boost::math::policies::raise_domain_error("boost::math::quadrature::sobol_sequence", "Sobol's sequence is only available in up to 32 dimensions, but %1% were requested.", static_cast<double>(dimension), boost::math::policies::policy<>());
+            return;
+        }
+        for (std::size_t j = 0; j < dimension; ++j)
+        {
+            if (j == 0)
+            {
+                // The first dimension is van der Corput's sequence:
+                for (unsigned k = 0; k < 64; ++k)
+                {
+                    m_directions[k*dimension] = uint64_t(1) << (63 - k);
+                }
+                continue;
+            }
+            unsigned s = joe_kuo[j - 1][1];
+            unsigned a = joe_kuo[j - 1][2];
+            uint64_t m[64];
+            for (unsigned k = 0; k < s; ++k)
+            {
+                m[k] = joe_kuo[j - 1][3 + k];
+            }
+            // m_k = 2a_1 m_{k-1} ^ 4a_2 m_{k-2} ^ ... ^ 2^{s-1}a_{s-1} m_{k-s+1} ^ 2^s m_{k-s} ^ m_{k-s}:
+            for (unsigned k = s; k < 64; ++k)
+            {
+                m[k] = m[k - s] ^ (m[k - s] << s);
+                for (unsigned i = 1; i < s; ++i)
+                {
+                    if ((a >> (s - 1 - i)) & 1)
+                    {
+                        m[k] ^= m[k - i] << i;
+                    }
+                }
+            }
+            for (unsigned k = 0; k < 64; ++k)
+            {
+                m_directions[k*dimension + j] = m[k] << (63 - k);
+            }
+        }
+    }
+
+    std::size_t dimension() const
+    {
+        return m_dimension;
+    }
+
+    static std::size_t max_dimension()
+    {
+        return 32;
+    }
+
+    template<class Real>
+    void operator()(uint64_t k, std::vector<uint64_t> const & shift, std::vector<Real>& x) const
+    {
+        for_each_point(k, k + 1, shift, x, [](std::vector<Real>&) {});
+    }
+
+    // The points are taken in Gray code order, as usual, so that each differs from the last in one bit of each coordinate:
+    template<class Real, class G>
+    void for_each_point(uint64_t begin, uint64_t end, std::vector<uint64_t> const & shift, std::vector<Real>& x, G g) const
+    {
+        std::vector<uint64_t> y(shift);
+        for (uint64_t bits = begin ^ (begin >> 1); bits; bits &= bits - 1)
+        {
+            const uint64_t* v = &m_directions[count_trailing_zeros(bits)*m_dimension];
+            for (std::size_t j = 0; j < m_dimension; ++j)
+            {
+                y[j] ^= v[j];
+            }
+        }
+        for (uint64_t k = begin; k < end; ++k)
+        {
+            if (k != begin)
+            {
+                const uint64_t* v = &m_directions[count_trailing_zeros(k)*m_dimension];
+                for (std::size_t j = 0; j < m_dimension; ++j)
+                {
+                    y[j] ^= v[j];
+                }
+            }
+            for (std::size_t j = 0; j < m_dimension; ++j)
+            {
+                x[j] = detail::fixed_point_to_unit_interval<Real>(y[j]);
+            }
+            g(x);
+        }
+    }
+
+private:
+    static unsigned count_trailing_zeros(uint64_t x)
+    {
+        unsigned n = 0;
+        while (!(x & 1))
+        {
+            x >>= 1;
+            ++n;
+        }
+        return n;
+    }
+
+    std::size_t m_dimension;
+    std::vector<uint64_t> m_directions;
+};
+
+// Halton's sequence: the radical inverses of k in the first dimension() primes, randomized by a shift modulo 1.
+// The coordinates in large prime bases are strongly correlated over the first few thousand points, so this
+// is best kept to a dozen or so dimensions.
+class halton_sequence
+{
+public:
+    explicit halton_sequence(std::size_t dimension) : m_dimension{dimension}
+    {
+        if (dimension > max_dimension())
+        {
+            boost::math::policies::raise_domain_error("boost::math::quadrature::halton_sequence", "Halton's sequence is only available in up to 10000 dimensions, but %1% were requested.", static_cast<double>(dimension), boost::math::policies::policy<>());
+            return;
+        }
+        for (std::size_t j = 0; j < dimension; ++j)
+        {
+            m_bases.push_back(boost::math::prime(static_cast<unsigned>(j)));
+        }
+    }
+
+    std::size_t dimension() const
+    {
+        return m_dimension;
+    }
+
+    static std::size_t max_dimension()
+    {
+        return boost::math::max_prime;
+    }
+
+    template<class Real>
+    void operator()(uint64_t k, std::vector<uint64_t> const & shift, std::vector<Real>& x) const
+    {
+        for (std::size_t j = 0; j < m_dimension; ++j)
+        {
+            const uint64_t b = m_bases[j];
+            const Real inv_b = 1/static_cast<Real>(b);
+            Real r = 0;
+            Real f = inv_b;
+            for (uint64_t n = k; n; n /= b)
+            {
+                r += static_cast<Real>(n % b)*f;
+                f *= inv_b;
+            }
+            r += detail::fixed_point_to_unit_interval<Real>(shift[j]);
+            x[j] = r < 1 ? r : r - 1;
+        }
+    }
+
+    template<class Real, class G>
+    void for_each_point(uint64_t begin, uint64_t end, std::vector<uint64_t> const & shift, std::vector<Real>& x, G g) const
+    {
+        for (uint64_t k = begin; k < end; ++k)
+        {
+            (*this)(k, shift, x);
+            g(x);
+        }
+    }
+
+private:
+    std::size_t m_dimension;
+    std::vector<uint32_t> m_bases;
+};
+
+// An extensible rank-1 lattice rule in base 2, x_k = {phi_2(k) z + shift}, where phi_2 is van der Corput's sequence:
+// so each block of 2^m points is a shifted lattice rule.  The generating vector z was found by a component-by-component
+// search minimizing the worst case error in a weighted Korobov space (alpha = 2, weights 1/j^2) for all 2^6 to 2^22 points at once.
+// Lattice rules are only accurate for periodic integrands, so the points are then folded by the baker's transform
+// x -> 1 - |2x - 1|, which makes the rule as accurate for smooth integrands that aren't periodic.
+class lattice_sequence
+{
+public:
+    explicit lattice_sequence(std::size_t dimension) : m_dimension{dimension}
+    {
+        static const uint64_t z[] = {
+            1, 2723217, 1896123, 530811, 3834707, 780249, 2945167, 828269, 3197491, 2195993, 3988715, 3237607, 849467, 1484615, 4128097, 41407,
+            1846551, 2039599, 477157, 1538531, 3282015, 686291, 933657, 3350693, 2798071, 1665615, 819283, 1414153, 2083561, 3471853, 2875725, 1260301 };
+        if (dimension > max_dimension())
+        {
+            boost::math::policies::raise_domain_error("boost::math::quadrature::lattice_sequence", "The lattice rule is only available in up to 32 dimensions, but %1% were requested.", static_cast<double>(dimension), boost::math::policies::policy<>());
+            return;
+        }
+        m_z.assign(z, z + dimension);
+    }
+
+    std::size_t dimension() const
+    {
+        return m_dimension;
+    }
+
+    static std::size_t max_dimension()
+    {
+        return 32;
+    }
+
+    // In 64 bit fixed point arithmetic, where the multiplication is exact modulo 1:
+    template<class Real>
+    void operator()(uint64_t k, std::vector<uint64_t> const & shift, std::vector<Real>& x) const
+    {
+        uint64_t phi = detail::reverse_bits(k);
+        for (std::size_t j = 0; j < m_dimension; ++j)
+        {
+            uint64_t y = phi*m_z[j] + shift[j];
+            y = (y >> 63) ? (~y + 1) << 1 : y << 1;
+            x[j] = detail::fixed_point_to_unit_interval<Real>(y);
+        }
+    }
+
+    template<class Real, class G>
+    void for_each_point(uint64_t begin, uint64_t end, std::vector<uint64_t> const & shift, std::vector<Real>& x, G g) const
+    {
+        for (uint64_t k = begin; k < end; ++k)
+        {
+            (*this)(k, shift, x);
+            g(x);
+        }
+    }
+
+private:
+    std::size_t m_dimension;
+    std::vector<uint64_t> m_z;
+};
+
+// Randomized quasi-Monte Carlo integration: the integral is estimated from several independently
+// randomized copies of a low discrepancy sequence, and the spread of those estimates gives the error.
+template<class Real, class F, class Sequence = sobol_sequence, class Policy = boost::math::policies::policy<>>
+class quasi_monte_carlo
+{
+public:
+    quasi_monte_carlo(const F& integrand,
+                      std::vector<std::pair<Real, Real>> const & bounds,
+                      Real error_goal,
+                      bool singular = true,
+                      uint64_t threads = std::thread::hardware_concurrency(),
+                      uint64_t seed = 0,
+                      uint64_t shifts = 16): m_integrand{integrand},
+                                             m_domain(bounds, singular, "boost::math::quadrature::quasi_monte_carlo<%1%>"),
+                                             m_sequence(checked_dimension(bounds.size())),
+                                             m_num_threads{(std::max)(threads, (uint64_t) 1)},
+                                             m_shifts((std::max)(shifts, (uint64_t) 2)),
+                                             m_sums(m_shifts.size()),
+                                             m_compensators(m_shifts.size())
+    {
+        // If the seed is zero, that tells us to choose a random seed for the user:
+        if (seed == 0)
+        {
+            std::random_device rd;
+            seed = rd();
+        }
+        std::mt19937_64 gen(seed);
+        std::uniform_int_distribution<uint64_t> dist;
+        for (uint64_t i = 0; i < m_shifts.size(); ++i)
+        {
+            m_shifts[i].resize(m_domain.dimension());
+            for (uint64_t j = 0; j < m_domain.dimension(); ++j)
+            {
+                m_shifts[i][j] = dist(gen);
+            }
+        }
+
+        // As for naive_monte_carlo, the first point of each shift is evaluated here, so that there's always an estimate:
+        std::vector<Real> x(m_domain.dimension());
+        for (uint64_t i = 0; i < m_shifts.size(); ++i)
+        {
+            m_sequence.for_each_point(0, 1, m_shifts[i], x, [&](std::vector<Real> & y) { m_sums[i] = evaluate(y); });
+            m_compensators[i] = 0;
+        }
+        m_points = 1;
+        m_total_calls = m_shifts.size(); // relaxed store
+        m_error_goal = error_goal; // relaxed store
+        m_done = false; // relaxed store
+        m_start = std::chrono::system_clock::now();
+        update_estimates();
+    }
+
+    std::future<Real> integrate()
+    {
+        // Set done to false in case we wish to restart:
+        m_done.store(false); // relaxed store, no worker threads yet
+        m_start = std::chrono::system_clock::now();
+        return std::async(std::launch::async,
+                          &quasi_monte_carlo::m_integrate, this);
+    }
+
+    void cancel()
+    {
+        m_done = true; // relaxed store, worker threads will get the message eventually
+        // Make sure the error goal is infinite, so we don't start another round:
+        m_error_goal = (std::numeric_limits<Real>::max)();
+    }
+
+    // The estimated error is the standard error of the mean of the randomized estimates:
+    Real current_error_estimate() const
+    {
+        return m_error.load();
+    }
+
+    // The error of quasi-Monte Carlo integration typically falls as 1/N, rather than the 1/sqrt(N) of Monte Carlo:
+    std::chrono::duration<Real> estimated_time_to_completion() const
+    {
+        auto now = std::chrono::system_clock::now();
+        std::chrono::duration<Real> elapsed_seconds = now - m_start;
+        Real r = this->current_error_estimate()/m_error_goal.load(); // relaxed load
+        if (r <= 1) {
+            return 0*elapsed_seconds;
+        }
+        return (r - 1)*elapsed_seconds;
+    }
+
+    void update_target_error(Real new_target_error)
+    {
+        m_error_goal = new_target_error;  // relaxed store
+    }
+
+    Real progress() const
+    {
+        Real r = m_error_goal.load()/this->current_error_estimate();  // relaxed load
+        if (r >= 1)
+        {
+            return 1;
+        }
+        return r;
+    }
+
+    Real current_estimate() const
+    {
+        return m_avg.load();
+    }
+
+    uint64_t calls() const
+    {
+        return m_total_calls.load();  // relaxed load
+    }
+
+private:
+    static std::size_t checked_dimension(std::size_t dimension)
+    {
+        if (dimension > Sequence::max_dimension())
+        {
+            static const char* function = "boost::math::quadrature::quasi_monte_carlo<%1%>";
+            boost::math::policies::raise_domain_error(function, "The integrand has %1% dimensions, which is more than the low discrepancy sequence supports.\n", static_cast<Real>(dimension), Policy());
+            return Sequence::max_dimension();
+        }
+        return dimension;
+    }
+
+    // Evaluates the integrand at the point x of the unit hypercube:
+    Real evaluate(std::vector<Real> & x) const
+    {
+        using std::isfinite;
+        Real coeff = m_domain.transform(x);
+        Real f = coeff*m_integrand(x);
+        if (!isfinite(f))
+        {
+            // The call to transform moved x into the domain, so this error message states the correct node.
+            std::stringstream os;
+            os << "Your integrand was evaluated at {";
+            for (uint64_t i = 0; i + 1 < x.size(); ++i)
+            {
+                 os << x[i] << ", ";
+            }
+            if (x.size())
+            {
+                 os << x[x.size() - 1];
+            }
+            os << "}, and returned " << f << std::endl;
+            static const char* function = "boost::math::quadrature::quasi_monte_carlo<%1%>";
+            boost::math::policies::raise_domain_error(function, os.str().c_str(), f, Policy());
+        }
+        return f;
+    }
+
+    // Sets the estimate to the mean of the estimates of each shift, and the error to the standard error of that mean:
+    void update_estimates()
+    {
+        using std::sqrt;
+        Real n = static_cast<Real>(m_shifts.size());
+        Real avg = 0;
+        for (uint64_t i = 0; i < m_sums.size(); ++i)
+        {
+            avg += m_sums[i]/m_points;
+        }
+        avg /= n;
+        Real variance = 0;
+        for (uint64_t i = 0; i < m_sums.size(); ++i)
+        {
+            Real d = m_sums[i]/m_points - avg;
+            variance += d*d;
+        }
+        m_avg.store(avg, boost::memory_order::release);
+        m_error.store(sqrt(variance/(n*(n - 1))), boost::memory_order::release);
+    }
+
+    Real m_integrate()
+    {
+        // Each round doubles the number of points of every shift, so the estimates always use
+        // 2^m points, which is when the sequences are at their most uniform.  Each round is divided
+        // into blocks of points, which the threads share out between them:
+        const uint64_t block_size = 1024;
+        detail::thread_team team(static_cast<unsigned>(m_num_threads));
+        while (!m_done && (m_points < 2*block_size || this->current_error_estimate() > m_error_goal.load()))
+        {
+            uint64_t first = m_points;
+            uint64_t last = first < block_size ? block_size : 2*first;
+            uint64_t blocks = (last - first + block_size - 1)/block_size;
+            std::vector<Real> partial_sums(blocks*m_shifts.size());
+            team.for_each_index(partial_sums.size(), [&](std::size_t i)
+            {
+                if (m_done) // relaxed load
+                {
+                    return;
+                }
+                const std::vector<uint64_t> & shift = m_shifts[i / blocks];
+                uint64_t begin = first + (i % blocks)*block_size;
+                uint64_t end = (std::min)(begin + block_size, last);
+                std::vector<Real> x(m_domain.dimension());
+                Real sum = 0;
+                m_sequence.for_each_point(begin, end, shift, x, [&](std::vector<Real> & y) { sum += evaluate(y); });
+                partial_sums[i] = sum;
+                m_total_calls.fetch_add(end - begin, boost::memory_order::relaxed);
+            });
+            if (m_done)
+            {
+                // Cancelled part way through the round, so forget it:
+                m_total_calls = m_points*m_shifts.size();
+                break;
+            }
+            // Summed in a fixed order, so the result doesn't depend upon the number of threads.
+            // Kahan summation is required for the same reasons as in naive_monte_carlo:
+            for (uint64_t i = 0; i < partial_sums.size(); ++i)
+            {
+                Real& sum = m_sums[i / blocks];
+                Real& compensator = m_compensators[i / blocks];
+                Real y = partial_sums[i] - compensator;
+                Real t = sum + y;
+                compensator = (t - sum) - y;
+                sum = t;
+            }
+            m_points = last;
+            update_estimates();
+        }
+        return m_avg.load(boost::memory_order::consume);
+    }
+
+    F m_integrand;
+    detail::monte_carlo_domain<Real, Policy> m_domain;
+    Sequence m_sequence;
+    uint64_t m_num_threads;
+    std::vector<std::vector<uint64_t>> m_shifts;
+    // The sums of the integrand over the points evaluated so far, for each shift:
+    std::vector<Real> m_sums;
+    std::vector<Real> m_compensators;
+    uint64_t m_points;
+    boost::atomic<uint64_t> m_total_calls;
+    boost::atomic<Real> m_error_goal;
+    boost::atomic<bool> m_done;
+    boost::atomic<Real> m_avg;
+    boost::atomic<Real> m_error;
+    std::chrono::time_point<std::chrono::system_clock> m_start;
+};
+
+}}}
+#endif
@@ -29,12 +29,43 @@ public:
     sinh_sinh(size_t max_refinements = 9)
         : m_imp(std::make_shared<detail::sinh_sinh_detail<Real, Policy> >(max_refinements)) {}
 
+    // Constructs from tables written by save_tables, which is far quicker than computing
+    // them, especially for multiprecision types:
+    explicit sinh_sinh(std::istream& is)
+        : m_imp(std::make_shared<detail::sinh_sinh_detail<Real, Policy> >(is)) {}
+
     template<class F>
     auto integrate(const F f, Real tol = boost::math::tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr)->decltype(std::declval<F>()(std::declval<Real>())) const
     {
         return m_imp->integrate(f, tol, error, L1, levels);
     }
 
+    // Batched integrands: f(x, y, n) sets y[i] = f(x[i]) for i < n, and is called once per refinement level:
+    template<class F>
+    auto integrate(const F f, Real tol = boost::math::tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr)->decltype((void)std::declval<F>()(std::declval<const Real*>(), std::declval<Real*>(), std::size_t(0)), Real()) const
+    {
+        return m_imp->integrate_batch(f, tol, error, L1, levels);
+    }
+
+    // Computes the abscissas and weights for refinement levels up to and including
+    // levels now, rather than during the first calls to integrate, and returns the
+    // highest level available.  Copies of this object share the same tables.
+    std::size_t reserve_refinements(std::size_t levels) const
+    {
+        return m_imp->reserve_refinements(levels);
+    }
+
+    tools::cache_statistics table_statistics() const
+    {
+        return m_imp->statistics();
+    }
+
+    // Writes the abscissas and weights computed so far, for the constructor above to read back:
+    void save_tables(std::ostream& os) const
+    {
+        m_imp->save(os);
+    }
+
 private:
     std::shared_ptr<detail::sinh_sinh_detail<Real, Policy>> m_imp;
 };
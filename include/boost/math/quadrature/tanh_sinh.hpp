@@ -32,7 +32,9 @@
 #include <cmath>
 #include <limits>
 #include <memory>
+#include <vector>
 #include <boost/math/quadrature/detail/tanh_sinh_detail.hpp>
+#include <boost/math/quadrature/detail/vector_valued.hpp>
 
 namespace boost{ namespace math{ namespace quadrature {
 
@@ -43,6 +45,11 @@ public:
     tanh_sinh(size_t max_refinements = 15, const Real& min_complement = tools::min_value<Real>() * 4)
     : m_imp(std::make_shared<detail::tanh_sinh_detail<Real, Policy>>(max_refinements, min_complement)) {}
 
+    // Constructs from tables written by save_tables, which is far quicker than computing
+    // them, especially for multiprecision types:
+    explicit tanh_sinh(std::istream& is)
+        : m_imp(std::make_shared<detail::tanh_sinh_detail<Real, Policy>>(is)) {}
+
     template<class F>
     auto integrate(const F f, Real a, Real b, Real tolerance = tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr) ->decltype(std::declval<F>()(std::declval<Real>())) const;
     template<class F>
@@ -53,13 +60,63 @@ public:
     template<class F>
     auto integrate(const F f, Real tolerance = tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr) ->decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) const;
 
+    // Batched integrands: f(x, y, n) sets y[i] = f(x[i]) for i < n, and is called once per refinement level:
+    template<class F>
+    auto integrate(const F f, Real a, Real b, Real tolerance = tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr) ->decltype((void)std::declval<F>()(std::declval<const Real*>(), std::declval<Real*>(), std::size_t(0)), Real()) const;
+    template<class F>
+    auto integrate(const F f, Real tolerance = tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr) ->decltype((void)std::declval<F>()(std::declval<const Real*>(), std::declval<Real*>(), std::size_t(0)), Real()) const;
+
+    // Computes the abscissas and weights for refinement levels up to and including
+    // levels now, rather than during the first calls to integrate, and returns the
+    // highest level available.  Copies of this object share the same tables.
+    std::size_t reserve_refinements(std::size_t levels) const
+    {
+        return m_imp->reserve_refinements(levels);
+    }
+
+    tools::cache_statistics table_statistics() const
+    {
+        return m_imp->statistics();
+    }
+
+    // Writes the abscissas and weights computed so far, for the constructor above to read back:
+    void save_tables(std::ostream& os) const
+    {
+        m_imp->save(os);
+    }
+
 private:
+    // Integrands of one argument may be vector valued, and are then integrated componentwise:
+    template<class F>
+    auto integrate_imp(const F& f, Real a, Real b, Real tolerance, Real* error, Real* L1, std::size_t* levels, const std::false_type&) ->decltype(std::declval<F>()(std::declval<Real>()));
+    template<class F>
+    auto integrate_imp(const F& f, Real a, Real b, Real tolerance, Real* error, Real* L1, std::size_t* levels, const std::true_type&) ->decltype(std::declval<F>()(std::declval<Real>()));
+    template<class F>
+    auto integrate_imp(const F& f, Real tolerance, Real* error, Real* L1, std::size_t* levels, const std::false_type&) ->decltype(std::declval<F>()(std::declval<Real>()));
+    template<class F>
+    auto integrate_imp(const F& f, Real tolerance, Real* error, Real* L1, std::size_t* levels, const std::true_type&) ->decltype(std::declval<F>()(std::declval<Real>()));
+
     std::shared_ptr<detail::tanh_sinh_detail<Real, Policy>> m_imp;
 };
 
 template<class Real, class Policy>
 template<class F>
 auto tanh_sinh<Real, Policy>::integrate(const F f, Real a, Real b, Real tolerance, Real* error, Real* L1, std::size_t* levels) ->decltype(std::declval<F>()(std::declval<Real>())) const
+{
+    typedef typename std::decay<decltype(std::declval<F>()(std::declval<Real>()))>::type result_type;
+    return integrate_imp(f, a, b, tolerance, error, L1, levels, detail::is_vector_valued<result_type>());
+}
+
+template<class Real, class Policy>
+template<class F>
+auto tanh_sinh<Real, Policy>::integrate_imp(const F& f, Real a, Real b, Real tolerance, Real* error, Real* L1, std::size_t* levels, const std::true_type&) ->decltype(std::declval<F>()(std::declval<Real>()))
+{
+    return integrate(detail::make_vector_valued_integrand<Real>(f), a, b, tolerance, error, L1, levels).value();
+}
+
+template<class Real, class Policy>
+template<class F>
+auto tanh_sinh<Real, Policy>::integrate_imp(const F& f, Real a, Real b, Real tolerance, Real* error, Real* L1, std::size_t* levels, const std::false_type&) ->decltype(std::declval<F>()(std::declval<Real>()))
 {
     BOOST_MATH_STD_USING
     using boost::math::constants::half;
@@ -249,6 +306,21 @@ auto tanh_sinh<Real, Policy>::integrate(const F f, Real a, Real b, Real toleranc
 template<class Real, class Policy>
 template<class F>
 auto tanh_sinh<Real, Policy>::integrate(const F f, Real tolerance, Real* error, Real* L1, std::size_t* levels) ->decltype(std::declval<F>()(std::declval<Real>())) const
+{
+   typedef typename std::decay<decltype(std::declval<F>()(std::declval<Real>()))>::type result_type;
+   return integrate_imp(f, tolerance, error, L1, levels, detail::is_vector_valued<result_type>());
+}
+
+template<class Real, class Policy>
+template<class F>
+auto tanh_sinh<Real, Policy>::integrate_imp(const F& f, Real tolerance, Real* error, Real* L1, std::size_t* levels, const std::true_type&) ->decltype(std::declval<F>()(std::declval<Real>()))
+{
+   return integrate(detail::make_vector_valued_integrand<Real>(f), tolerance, error, L1, levels).value();
+}
+
+template<class Real, class Policy>
+template<class F>
+auto tanh_sinh<Real, Policy>::integrate_imp(const F& f, Real tolerance, Real* error, Real* L1, std::size_t* levels, const std::false_type&) ->decltype(std::declval<F>()(std::declval<Real>()))
 {
    using boost::math::quadrature::detail::tanh_sinh_detail;
    static const char* function = "tanh_sinh<%1%>::integrate";
@@ -266,6 +338,182 @@ auto tanh_sinh<Real, Policy>::integrate(const F f, Real tolerance, Real* error,
    return m_imp->integrate(f, error, L1, function, min_complement, min_complement, tolerance, levels);
 }
 
+template<class Real, class Policy>
+template<class F>
+auto tanh_sinh<Real, Policy>::integrate(const F f, Real a, Real b, Real tolerance, Real* error, Real* L1, std::size_t* levels) ->decltype((void)std::declval<F>()(std::declval<const Real*>(), std::declval<Real*>(), std::size_t(0)), Real()) const
+{
+    BOOST_MATH_STD_USING
+    using boost::math::constants::half;
+
+    static const char* function = "tanh_sinh<%1%>::integrate";
+    //
+    // The same changes of variable as the scalar version above, applied to a whole row:
+    // the points are mapped into [a, b] and any scale factors applied once f has been
+    // evaluated at all of them.
+    //
+    std::vector<Real> x, scale;
+
+    if (!(boost::math::isnan)(a) && !(boost::math::isnan)(b))
+    {
+
+       // Infinite limits:
+       if ((a <= -tools::max_value<Real>()) && (b >= tools::max_value<Real>()))
+       {
+          auto u = [&](const Real* t, const Real* tc, Real* y, std::size_t n)
+          {
+             x.resize(n);
+             scale.resize(n);
+             for (std::size_t i = 0; i < n; ++i)
+             {
+                Real inv;
+                if (t[i] > 0.5f)
+                   inv = 1 / ((2 - tc[i]) * tc[i]);
+                else if (t[i] < -0.5)
+                   inv = 1 / ((2 + tc[i]) * -tc[i]);
+                else
+                   inv = 1 / (1 - t[i] * t[i]);
+                x[i] = t[i] * inv;
+                scale[i] = inv;
+             }
+             f(x.data(), y, n);
+             for (std::size_t i = 0; i < n; ++i)
+                y[i] = y[i] * (1 + t[i] * t[i]) * scale[i] * scale[i];
+          };
+          Real limit = sqrt(tools::min_value<Real>()) * 4;
+          return m_imp->integrate_batch(u, error, L1, function, limit, limit, tolerance, levels);
+       }
+
+       // Right limit is infinite:
+       if ((boost::math::isfinite)(a) && (b >= tools::max_value<Real>()))
+       {
+          auto u = [&](const Real* t, const Real* tc, Real* y, std::size_t n)
+          {
+             x.resize(n);
+             scale.resize(n);
+             for (std::size_t i = 0; i < n; ++i)
+             {
+                Real z;
+                if (t[i] > -0.5f)
+                   z = 1 / (t[i] + 1);
+                else
+                   z = -1 / tc[i];
+                if (t[i] < 0.5)
+                   x[i] = 2 * z + a - 1;
+                else
+                   x[i] = a + tc[i] / (2 - tc[i]);
+                scale[i] = z;
+             }
+             f(x.data(), y, n);
+             for (std::size_t i = 0; i < n; ++i)
+                y[i] = y[i] * scale[i] * scale[i];
+          };
+          Real left_limit = sqrt(tools::min_value<Real>()) * 4;
+          Real Q = Real(2) * m_imp->integrate_batch(u, error, L1, function, left_limit, tools::min_value<Real>(), tolerance, levels);
+          if (L1)
+          {
+             *L1 *= 2;
+          }
+
+          return Q;
+       }
+
+       if ((boost::math::isfinite)(b) && (a <= -tools::max_value<Real>()))
+       {
+          auto v = [&](const Real* t, const Real* tc, Real* y, std::size_t n)
+          {
+             x.resize(n);
+             scale.resize(n);
+             for (std::size_t i = 0; i < n; ++i)
+             {
+                Real z;
+                if (t[i] > -0.5)
+                   z = 1 / (t[i] + 1);
+                else
+                   z = -1 / tc[i];
+                Real arg;
+                if (t[i] < 0.5)
+                   arg = 2 * z - 1;
+                else
+                   arg = tc[i] / (2 - tc[i]);
+                x[i] = b - arg;
+                scale[i] = z;
+             }
+             f(x.data(), y, n);
+             for (std::size_t i = 0; i < n; ++i)
+                y[i] = y[i] * scale[i] * scale[i];
+          };
+
+          Real left_limit = sqrt(tools::min_value<Real>()) * 4;
+          Real Q = Real(2) * m_imp->integrate_batch(v, error, L1, function, left_limit, tools::min_value<Real>(), tolerance, levels);
+          if (L1)
+          {
+             *L1 *= 2;
+          }
+          return Q;
+       }
+
+       if ((boost::math::isfinite)(a) && (boost::math::isfinite)(b))
+       {
+          if (a == b)
+          {
+             return Real(0);
+          }
+          if (b < a)
+          {
+             return -this->integrate(f, b, a, tolerance, error, L1, levels);
+          }
+          Real avg = (a + b)*half<Real>();
+          Real diff = (b - a)*half<Real>();
+          Real avg_over_diff_m1 = a / diff;
+          Real avg_over_diff_p1 = b / diff;
+          bool have_small_left = fabs(a) < 0.5f;
+          bool have_small_right = fabs(b) < 0.5f;
+          Real left_min_complement = float_next(avg_over_diff_m1) - avg_over_diff_m1;
+          Real min_complement_limit = (std::max)(tools::min_value<Real>(), Real(tools::min_value<Real>() / diff));
+          if (left_min_complement < min_complement_limit)
+             left_min_complement = min_complement_limit;
+          Real right_min_complement = avg_over_diff_p1 - float_prior(avg_over_diff_p1);
+          if (right_min_complement < min_complement_limit)
+             right_min_complement = min_complement_limit;
+          BOOST_ASSERT((left_min_complement * diff + a) > a);
+          BOOST_ASSERT((b - right_min_complement * diff) < b);
+          auto u = [&](const Real* z, const Real* zc, Real* y, std::size_t n)
+          {
+             x.resize(n);
+             for (std::size_t i = 0; i < n; ++i)
+             {
+                if (z[i] < -0.5)
+                   x[i] = have_small_left ? Real(diff * (avg_over_diff_m1 - zc[i])) : Real(a - diff * zc[i]);
+                else if (z[i] > 0.5)
+                   x[i] = have_small_right ? Real(diff * (avg_over_diff_p1 - zc[i])) : Real(b - diff * zc[i]);
+                else
+                   x[i] = avg + diff * z[i];
+                BOOST_ASSERT(x[i] != a);
+                BOOST_ASSERT(x[i] != b);
+             }
+             f(x.data(), y, n);
+          };
+          Real Q = diff*m_imp->integrate_batch(u, error, L1, function, left_min_complement, right_min_complement, tolerance, levels);
+
+          if (L1)
+          {
+             *L1 *= diff;
+          }
+          return Q;
+       }
+    }
+    return policies::raise_domain_error(function, "The domain of integration is not sensible; please check the bounds.", a, Policy());
+}
+
+template<class Real, class Policy>
+template<class F>
+auto tanh_sinh<Real, Policy>::integrate(const F f, Real tolerance, Real* error, Real* L1, std::size_t* levels) ->decltype((void)std::declval<F>()(std::declval<const Real*>(), std::declval<Real*>(), std::size_t(0)), Real()) const
+{
+   static const char* function = "tanh_sinh<%1%>::integrate";
+   Real min_complement = tools::epsilon<Real>();
+   return m_imp->integrate_batch([&](const Real* x, const Real*, Real* y, std::size_t n) { f(x, y, n); }, error, L1, function, min_complement, min_complement, tolerance, levels);
+}
+
 }
 }
 }
@@ -0,0 +1,392 @@
+/*
+ * Copyright Boost.Math contributors, 2020
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef BOOST_MATH_QUADRATURE_VEGAS_MONTE_CARLO_HPP
+#define BOOST_MATH_QUADRATURE_VEGAS_MONTE_CARLO_HPP
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <future>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <boost/atomic.hpp>
+#include <boost/math/policies/error_handling.hpp>
+#include <boost/math/quadrature/detail/monte_carlo_domain.hpp>
+#include <boost/math/quadrature/detail/thread_team.hpp>
+
+namespace boost { namespace math { namespace quadrature {
+
+namespace detail {
+  // Mixes the seed, iteration and block numbers into the seed for one block of samples:
+  inline uint64_t vegas_block_seed(uint64_t seed, uint64_t iteration, uint64_t block)
+  {
+      // splitmix64:
+      uint64_t z = seed + 0x9E3779B97F4A7C15ULL*(1 + iteration) + 0xBF58476D1CE4E5B9ULL*block;
+      z = (z ^ (z >> 30))*0xBF58476D1CE4E5B9ULL;
+      z = (z ^ (z >> 27))*0x94D049BB133111EBULL;
+      return z ^ (z >> 31);
+  }
+}
+
+// Monte Carlo integration with adaptive importance sampling by Lepage's VEGAS algorithm: the samples are
+// drawn from a separable density, which is a piecewise constant function of each coordinate, and which is
+// refined after each iteration to concentrate the samples where the integrand is largest.
+template<class Real, class F, class RandomNumberGenerator = std::mt19937_64, class Policy = boost::math::policies::policy<>>
+class vegas_monte_carlo
+{
+public:
+    vegas_monte_carlo(const F& integrand,
+                      std::vector<std::pair<Real, Real>> const & bounds,
+                      Real error_goal,
+                      bool singular = true,
+                      uint64_t threads = std::thread::hardware_concurrency(),
+                      uint64_t seed = 0,
+                      uint64_t calls_per_iteration = 100000,
+                      uint64_t bins = 50): m_integrand{integrand},
+                                          m_domain(bounds, singular, "boost::math::quadrature::vegas_monte_carlo<%1%>"),
+                                          m_num_threads{(std::max)(threads, (uint64_t) 1)},
+                                          m_calls_per_iteration{(std::max)(calls_per_iteration, (uint64_t) 2)},
+                                          m_bins{(std::max)(bins, (uint64_t) 1)},
+                                          m_edges(m_domain.dimension()*(m_bins + 1)),
+                                          m_chi_squared{std::numeric_limits<Real>::quiet_NaN()}
+    {
+        // If the seed is zero, that tells us to choose a random seed for the user:
+        if (seed == 0)
+        {
+            std::random_device rd;
+            seed = rd();
+        }
+        m_seed = seed;
+        // The grid starts out uniform:
+        for (uint64_t j = 0; j < m_domain.dimension(); ++j)
+        {
+            for (uint64_t i = 0; i <= m_bins; ++i)
+            {
+                m_edges[j*(m_bins + 1) + i] = static_cast<Real>(i)/static_cast<Real>(m_bins);
+            }
+        }
+        m_iteration = 0;
+        m_weight_sum = 0;
+        m_weighted_sum = 0;
+        m_weighted_squares = 0;
+        m_counted_iterations = 0;
+        m_exact = false;
+        m_total_calls = 0; // relaxed store
+        m_avg = 0; // relaxed store
+        m_error = (std::numeric_limits<Real>::max)(); // relaxed store
+        m_error_goal = error_goal; // relaxed store
+        m_done = false; // relaxed store
+        m_start = std::chrono::system_clock::now();
+    }
+
+    std::future<Real> integrate()
+    {
+        // Set done to false in case we wish to restart:
+        m_done.store(false); // relaxed store, no worker threads yet
+        m_start = std::chrono::system_clock::now();
+        return std::async(std::launch::async,
+                          &vegas_monte_carlo::m_integrate, this);
+    }
+
+    void cancel()
+    {
+        m_done = true; // relaxed store, worker threads will get the message eventually
+        // Make sure the error goal is infinite, so we don't start another iteration:
+        m_error_goal = (std::numeric_limits<Real>::max)();
+    }
+
+    Real current_error_estimate() const
+    {
+        return m_error.load();
+    }
+
+    std::chrono::duration<Real> estimated_time_to_completion() const
+    {
+        auto now = std::chrono::system_clock::now();
+        std::chrono::duration<Real> elapsed_seconds = now - m_start;
+        Real r = this->current_error_estimate()/m_error_goal.load(); // relaxed load
+        if (r*r <= 1) {
+            return 0*elapsed_seconds;
+        }
+        return (r*r - 1)*elapsed_seconds;
+    }
+
+    void update_target_error(Real new_target_error)
+    {
+        m_error_goal = new_target_error;  // relaxed store
+    }
+
+    Real progress() const
+    {
+        Real r = m_error_goal.load()/this->current_error_estimate();  // relaxed load
+        if (r*r >= 1)
+        {
+            return 1;
+        }
+        return r*r;
+    }
+
+    Real current_estimate() const
+    {
+        return m_avg.load();
+    }
+
+    uint64_t calls() const
+    {
+        return m_total_calls.load();  // relaxed load
+    }
+
+    // The chi-squared per degree of freedom of the estimates of the iterations which have been combined into
+    // the result: if this is much larger than one, the estimates are inconsistent and the result is not to be trusted.
+    // It is a NaN until two iterations have been combined.
+    Real chi_squared_per_dof() const
+    {
+        return m_chi_squared.load();
+    }
+
+private:
+    // The sums over one block of samples; the mean and the sum of squared deviations from it are accumulated
+    // by Welford's update, since the textbook formula cancels catastrophically when the integrand is nearly flat:
+    struct block_sums
+    {
+        uint64_t count;
+        Real mean;
+        Real m2;
+        // The sum of the squared integrand over the samples in each bin of each dimension:
+        std::vector<Real> bin_squares;
+    };
+
+    void sample_block(uint64_t block, uint64_t count, block_sums& sums) const
+    {
+        using std::isfinite;
+        const uint64_t dimension = m_domain.dimension();
+        RandomNumberGenerator gen(detail::vegas_block_seed(m_seed, m_iteration, block));
+        Real inv_denom = 1/static_cast<Real>(((gen.max)()-(gen.min)()));
+        std::vector<Real> x(dimension);
+        std::vector<uint64_t> bin(dimension);
+        sums.count = 0;
+        sums.mean = 0;
+        sums.m2 = 0;
+        sums.bin_squares.assign(dimension*m_bins, Real(0));
+        for (uint64_t k = 0; k < count; ++k)
+        {
+            // Choose a bin uniformly in each dimension, and a point uniformly in the bin:
+            Real jacobian = 1;
+            for (uint64_t j = 0; j < dimension; ++j)
+            {
+                Real t = (gen()-(gen.min)())*inv_denom*m_bins;
+                uint64_t i = (std::min)(static_cast<uint64_t>(t), m_bins - 1);
+                const Real* edges = &m_edges[j*(m_bins + 1)];
+                Real width = edges[i + 1] - edges[i];
+                x[j] = edges[i] + (t - i)*width;
+                jacobian *= m_bins*width;
+                bin[j] = i;
+            }
+            Real coeff = m_domain.transform(x);
+            Real f = jacobian*coeff*m_integrand(x);
+            if (!isfinite(f))
+            {
+                // The call to transform moved x into the domain, so this error message states the correct node.
+                std::stringstream os;
+                os << "Your integrand was evaluated at {";
+                for (uint64_t i = 0; i + 1 < x.size(); ++i)
+                {
+                     os << x[i] << ", ";
+                }
+                if (x.size())
+                {
+                     os << x[x.size() - 1];
+                }
+                os << "}, and returned " << f << std::endl;
+                static const char* function = "boost::math::quadrature::vegas_monte_carlo<%1%>";
+                boost::math::policies::raise_domain_error(function, os.str().c_str(), f, Policy());
+            }
+            Real delta = f - sums.mean;
+            sums.mean += delta/static_cast<Real>(++sums.count);
+            sums.m2 += delta*(f - sums.mean);
+            for (uint64_t j = 0; j < dimension; ++j)
+            {
+                sums.bin_squares[j*m_bins + bin[j]] += f*f;
+            }
+        }
+    }
+
+    // Moves the bin edges so that each bin would contribute equally to the variance, damped as suggested by Lepage:
+    void refine_grid(std::vector<Real> const & bin_squares)
+    {
+        using std::log;
+        using std::pow;
+        const Real alpha = Real(3)/2;
+        std::vector<Real> d(m_bins);
+        std::vector<Real> w(m_bins);
+        std::vector<Real> new_edges(m_bins + 1);
+        for (uint64_t j = 0; j < m_domain.dimension(); ++j)
+        {
+            const Real* squares = &bin_squares[j*m_bins];
+            Real* edges = &m_edges[j*(m_bins + 1)];
+            // Smooth the contributions of each bin with its neighbours:
+            Real total = 0;
+            for (uint64_t i = 0; i < m_bins; ++i)
+            {
+                Real s = squares[i];
+                uint64_t n = 1;
+                if (i > 0)
+                {
+                    s += squares[i - 1];
+                    ++n;
+                }
+                if (i + 1 < m_bins)
+                {
+                    s += squares[i + 1];
+                    ++n;
+                }
+                d[i] = s/n;
+                total += d[i];
+            }
+            if (!(total > 0))
+            {
+                // The integrand was zero at every sample, so there's nothing to go on:
+                continue;
+            }
+            Real total_weight = 0;
+            for (uint64_t i = 0; i < m_bins; ++i)
+            {
+                Real r = d[i]/total;
+                w[i] = (r > 0) && (r < 1) ? Real(pow((r - 1)/log(r), alpha)) : Real(r > 0 ? 1 : 0);
+                total_weight += w[i];
+            }
+            // Place the new edges so that each new bin has an equal share of the weight:
+            Real share = total_weight/m_bins;
+            Real accumulated = 0;
+            uint64_t old_bin = 0;
+            new_edges[0] = 0;
+            for (uint64_t i = 1; i < m_bins; ++i)
+            {
+                Real target = i*share;
+                while ((old_bin + 1 < m_bins) && (accumulated + w[old_bin] < target))
+                {
+                    accumulated += w[old_bin];
+                    ++old_bin;
+                }
+                Real fraction = w[old_bin] > 0 ? (target - accumulated)/w[old_bin] : Real(0);
+                fraction = (std::min)((std::max)(fraction, Real(0)), Real(1));
+                new_edges[i] = edges[old_bin] + fraction*(edges[old_bin + 1] - edges[old_bin]);
+                new_edges[i] = (std::max)(new_edges[i], new_edges[i - 1]);
+            }
+            new_edges[m_bins] = 1;
+            std::copy(new_edges.begin(), new_edges.end(), edges);
+        }
+    }
+
+    Real m_integrate()
+    {
+        using std::sqrt;
+        // The number of iterations used only to adapt the grid, since their estimates are unreliable:
+        const uint64_t warm_up_iterations = 5;
+        const uint64_t block_size = 1024;
+        detail::thread_team team(static_cast<unsigned>(m_num_threads));
+        uint64_t blocks = (m_calls_per_iteration + block_size - 1)/block_size;
+        std::vector<block_sums> sums(blocks);
+        while (!m_done && !m_exact && (m_counted_iterations < 2 || this->current_error_estimate() > m_error_goal.load()))
+        {
+            // The samples are drawn in blocks, each with its own random number generator, and summed in a fixed order:
+            // so the result depends upon the seed, but not on the number of threads:
+            team.for_each_index(blocks, [&](std::size_t b)
+            {
+                if (m_done) // relaxed load
+                {
+                    return;
+                }
+                uint64_t count = (std::min)(block_size, m_calls_per_iteration - b*block_size);
+                sample_block(b, count, sums[b]);
+                m_total_calls.fetch_add(count, boost::memory_order::relaxed);
+            });
+            if (m_done)
+            {
+                // Cancelled part way through the iteration, so forget it.
+                break;
+            }
+            // Merge the blocks pairwise as described by Chan, Golub and LeVeque:
+            Real n = 0;
+            Real estimate = 0;
+            Real m2 = 0;
+            std::vector<Real> bin_squares(m_domain.dimension()*m_bins, Real(0));
+            for (uint64_t b = 0; b < blocks; ++b)
+            {
+                Real count = static_cast<Real>(sums[b].count);
+                Real delta = sums[b].mean - estimate;
+                n += count;
+                estimate += delta*count/n;
+                m2 += sums[b].m2 + delta*delta*(n - count)*count/n;
+                for (uint64_t i = 0; i < bin_squares.size(); ++i)
+                {
+                    bin_squares[i] += sums[b].bin_squares[i];
+                }
+            }
+            Real variance = m2/(n*(n - 1));
+            if (++m_iteration > warm_up_iterations)
+            {
+                if (!(variance > 0))
+                {
+                    // Every sample was the same, so the integrand is constant under the trained density
+                    // and this estimate is exact; an infinite weight would only turn the sums into NaNs.
+                    m_exact = true;
+                    ++m_counted_iterations;
+                    m_avg.store(estimate, boost::memory_order::release);
+                    m_error.store(Real(0), boost::memory_order::release);
+                    break;
+                }
+                // Combine the estimates of the iterations, weighted by the inverse of their variances:
+                Real weight = 1/variance;
+                m_weight_sum += weight;
+                m_weighted_sum += weight*estimate;
+                m_weighted_squares += weight*estimate*estimate;
+                ++m_counted_iterations;
+                Real avg = m_weighted_sum/m_weight_sum;
+                m_avg.store(avg, boost::memory_order::release);
+                m_error.store(1/sqrt(m_weight_sum), boost::memory_order::release);
+                if (m_counted_iterations > 1)
+                {
+                    Real chi_squared = m_weighted_squares - avg*m_weighted_sum;
+                    m_chi_squared.store((std::max)(chi_squared, Real(0))/(m_counted_iterations - 1), boost::memory_order::release);
+                }
+            }
+            refine_grid(bin_squares);
+        }
+        return m_avg.load(boost::memory_order::consume);
+    }
+
+    F m_integrand;
+    detail::monte_carlo_domain<Real, Policy> m_domain;
+    uint64_t m_num_threads;
+    uint64_t m_calls_per_iteration;
+    uint64_t m_bins;
+    uint64_t m_seed;
+    // The bin edges in each dimension, bins + 1 of them per dimension:
+    std::vector<Real> m_edges;
+    uint64_t m_iteration;
+    uint64_t m_counted_iterations;
+    // Set when an iteration has had no variance at all, so that its estimate is the result:
+    bool m_exact;
+    Real m_weight_sum;
+    Real m_weighted_sum;
+    Real m_weighted_squares;
+    boost::atomic<uint64_t> m_total_calls;
+    boost::atomic<Real> m_error_goal;
+    boost::atomic<bool> m_done;
+    boost::atomic<Real> m_avg;
+    boost::atomic<Real> m_error;
+    boost::atomic<Real> m_chi_squared;
+    std::chrono::time_point<std::chrono::system_clock> m_start;
+};
+
+}}}
+#endif
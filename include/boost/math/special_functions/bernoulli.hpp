@@ -138,6 +138,35 @@ inline OutputIterator tangent_t2n(const int start_index,
    return boost::math::tangent_t2n<T, OutputIterator>(start_index, number_of_tangent_t2n, out_it, policies::policy<>());
 }
 
+//
+// Fills the cache behind bernoulli_b2n and tangent_t2n with at least the first n
+// values, so that later calls for them never need to take a lock, and returns
+// the number of values held (which is less than n only if the cache is full):
+//
+template <class T, class Policy>
+inline std::size_t reserve_bernoulli_b2n(const std::size_t n, const Policy&)
+{
+   return boost::math::detail::get_bernoulli_numbers_cache<T, Policy>().reserve(n);
+}
+
+template <class T>
+inline std::size_t reserve_bernoulli_b2n(const std::size_t n)
+{
+   return boost::math::reserve_bernoulli_b2n<T>(n, policies::policy<>());
+}
+
+template <class T, class Policy>
+inline tools::cache_statistics bernoulli_b2n_cache_statistics(const Policy&)
+{
+   return boost::math::detail::get_bernoulli_numbers_cache<T, Policy>().statistics();
+}
+
+template <class T>
+inline tools::cache_statistics bernoulli_b2n_cache_statistics()
+{
+   return boost::math::bernoulli_b2n_cache_statistics<T>(policies::policy<>());
+}
+
 } } // namespace boost::math
 
 #endif // _BOOST_BERNOULLI_B2N_2013_05_30_HPP_
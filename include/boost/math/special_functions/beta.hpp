@@ -27,6 +27,61 @@ namespace boost{ namespace math{
 
 namespace detail{
 
+//
+// Small cache of the terms in the incomplete beta which depend only upon a and b
+// (and not upon x), used by ibeta_evaluator when the same a and b are evaluated
+// at many different x.  Depending on x, ibeta_imp may swap a and b, or step
+// them to a+20 etc, before calling the routines below, so entries are keyed on
+// the actual arguments as well as the kind of term, and a few entries are kept
+// so that all the variants used for one a and b stay resident.  Each cached
+// value is computed with exactly the same operations as the uncached code, so
+// the results are bit for bit the same as the plain functions.
+//
+template <class T>
+class ibeta_term_cache
+{
+public:
+   enum term_kind
+   {
+      power_terms_prefix,  // ibeta_power_terms: all the factors not involving x or y.
+      series_prefix,       // ibeta_series: the Lanczos sums, those times the power term in b, and log of the latter.
+      delta_ratio          // beta_small_b_large_a_series: tgamma_delta_ratio(a, b).
+   };
+   ibeta_term_cache() : m_count(0), m_next(0) {}
+   const T* find(term_kind k, const T& a, const T& b)const
+   {
+      for(unsigned i = 0; i < m_count; ++i)
+      {
+         if((m_entries[i].kind == k) && (m_entries[i].a == a) && (m_entries[i].b == b))
+            return m_entries[i].values;
+      }
+      return 0;
+   }
+   void insert(term_kind k, const T& a, const T& b, const T& v0, const T& v1 = 0, const T& v2 = 0)
+   {
+      entry& e = m_entries[m_next];
+      e.kind = k;
+      e.a = a;
+      e.b = b;
+      e.values[0] = v0;
+      e.values[1] = v1;
+      e.values[2] = v2;
+      m_next = (m_next + 1) % cache_size;
+      if(m_count < cache_size)
+         ++m_count;
+   }
+private:
+   BOOST_STATIC_CONSTANT(unsigned, cache_size = 16);
+   struct entry
+   {
+      term_kind kind;
+      T a, b;
+      T values[3];
+   };
+   entry m_entries[cache_size];
+   unsigned m_count, m_next;
+};
+
 //
 // Implementation of Beta(a,b) using the Lanczos approximation:
 //
@@ -212,7 +267,8 @@ T ibeta_power_terms(T a,
                         bool normalised,
                         const Policy& pol,
                         T prefix = 1,
-                        const char* function = "boost::math::ibeta<%1%>(%1%, %1%, %1%)")
+                        const char* function = "boost::math::ibeta<%1%>(%1%, %1%, %1%)",
+                        ibeta_term_cache<T>* cache = 0)
 {
    BOOST_MATH_STD_USING
 
@@ -230,11 +286,19 @@ T ibeta_power_terms(T a,
    T agh = static_cast<T>(a + Lanczos::g() - 0.5f);
    T bgh = static_cast<T>(b + Lanczos::g() - 0.5f);
    T cgh = static_cast<T>(c + Lanczos::g() - 0.5f);
-   result = Lanczos::lanczos_sum_expG_scaled(c) / (Lanczos::lanczos_sum_expG_scaled(a) * Lanczos::lanczos_sum_expG_scaled(b));
-   result *= prefix;
-   // combine with the leftover terms from the Lanczos approximation:
-   result *= sqrt(bgh / boost::math::constants::e<T>());
-   result *= sqrt(agh / cgh);
+   const T* cached = (cache && (prefix == 1)) ? cache->find(ibeta_term_cache<T>::power_terms_prefix, a, b) : 0;
+   if(cached)
+      result = cached[0];
+   else
+   {
+      result = Lanczos::lanczos_sum_expG_scaled(c) / (Lanczos::lanczos_sum_expG_scaled(a) * Lanczos::lanczos_sum_expG_scaled(b));
+      result *= prefix;
+      // combine with the leftover terms from the Lanczos approximation:
+      result *= sqrt(bgh / boost::math::constants::e<T>());
+      result *= sqrt(agh / cgh);
+      if(cache && (prefix == 1))
+         cache->insert(ibeta_term_cache<T>::power_terms_prefix, a, b, result);
+   }
 
    // l1 and l2 are the base of the exponents minus one:
    T l1 = (x * b - y * agh) / agh;
@@ -440,7 +504,8 @@ T ibeta_power_terms(T a,
                         bool normalised,
                         const Policy& pol,
                         T prefix = 1,
-                        const char* = "boost::math::ibeta<%1%>(%1%, %1%, %1%)")
+                        const char* = "boost::math::ibeta<%1%>(%1%, %1%, %1%)",
+                        ibeta_term_cache<T>* = 0)
 {
    BOOST_MATH_STD_USING
 
@@ -543,7 +608,7 @@ private:
 };
 
 template <class T, class Lanczos, class Policy>
-T ibeta_series(T a, T b, T x, T s0, const Lanczos&, bool normalised, T* p_derivative, T y, const Policy& pol)
+T ibeta_series(T a, T b, T x, T s0, const Lanczos&, bool normalised, T* p_derivative, T y, const Policy& pol, ibeta_term_cache<T>* cache = 0)
 {
    BOOST_MATH_STD_USING
 
@@ -559,9 +624,29 @@ T ibeta_series(T a, T b, T x, T s0, const Lanczos&, bool normalised, T* p_deriva
       T agh = static_cast<T>(a + Lanczos::g() - 0.5f);
       T bgh = static_cast<T>(b + Lanczos::g() - 0.5f);
       T cgh = static_cast<T>(c + Lanczos::g() - 0.5f);
-      result = Lanczos::lanczos_sum_expG_scaled(c) / (Lanczos::lanczos_sum_expG_scaled(a) * Lanczos::lanczos_sum_expG_scaled(b));
-
-      T l1 = log(cgh / bgh) * (b - 0.5f);
+      T l1, b_term;
+      const T* cached = cache ? cache->find(ibeta_term_cache<T>::series_prefix, a, b) : 0;
+      if(cached)
+      {
+         result = cached[0];
+         b_term = cached[1];
+         l1 = cached[2];
+      }
+      else
+      {
+         result = Lanczos::lanczos_sum_expG_scaled(c) / (Lanczos::lanczos_sum_expG_scaled(a) * Lanczos::lanczos_sum_expG_scaled(b));
+         b_term = result;
+         l1 = log(cgh / bgh) * (b - 0.5f);
+         if((l1 > tools::log_min_value<T>()) && (l1 < tools::log_max_value<T>()))
+         {
+            if(a * b < bgh * 10)
+               b_term *= exp((b - 0.5f) * boost::math::log1p(a / bgh, pol));
+            else
+               b_term *= pow(cgh / bgh, b - 0.5f);
+         }
+         if(cache)
+            cache->insert(ibeta_term_cache<T>::series_prefix, a, b, result, b_term, l1);
+      }
       T l2 = log(x * cgh / agh) * a;
       //
       // Check for over/underflow in the power terms:
@@ -571,10 +656,7 @@ T ibeta_series(T a, T b, T x, T s0, const Lanczos&, bool normalised, T* p_deriva
          && (l2 > tools::log_min_value<T>())
          && (l2 < tools::log_max_value<T>()))
       {
-         if(a * b < bgh * 10)
-            result *= exp((b - 0.5f) * boost::math::log1p(a / bgh, pol));
-         else
-            result *= pow(cgh / bgh, b - 0.5f);
+         result = b_term;
          result *= pow(x * cgh / agh, a);
          result *= sqrt(agh / boost::math::constants::e<T>());
 
@@ -612,7 +694,7 @@ T ibeta_series(T a, T b, T x, T s0, const Lanczos&, bool normalised, T* p_deriva
 // Incomplete Beta series again, this time without Lanczos support:
 //
 template <class T, class Policy>
-T ibeta_series(T a, T b, T x, T s0, const boost::math::lanczos::undefined_lanczos& l, bool normalised, T* p_derivative, T y, const Policy& pol)
+T ibeta_series(T a, T b, T x, T s0, const boost::math::lanczos::undefined_lanczos& l, bool normalised, T* p_derivative, T y, const Policy& pol, ibeta_term_cache<T>* = 0)
 {
    BOOST_MATH_STD_USING
 
@@ -703,11 +785,11 @@ private:
 // Evaluate the incomplete beta via the continued fraction representation:
 //
 template <class T, class Policy>
-inline T ibeta_fraction2(T a, T b, T x, T y, const Policy& pol, bool normalised, T* p_derivative)
+inline T ibeta_fraction2(T a, T b, T x, T y, const Policy& pol, bool normalised, T* p_derivative, ibeta_term_cache<T>* cache = 0)
 {
    typedef typename lanczos::lanczos<T, Policy>::type lanczos_type;
    BOOST_MATH_STD_USING
-   T result = ibeta_power_terms(a, b, x, y, lanczos_type(), normalised, pol);
+   T result = ibeta_power_terms(a, b, x, y, lanczos_type(), normalised, pol, T(1), "boost::math::ibeta<%1%>(%1%, %1%, %1%)", cache);
    if(p_derivative)
    {
       *p_derivative = result;
@@ -726,13 +808,13 @@ inline T ibeta_fraction2(T a, T b, T x, T y, const Policy& pol, bool normalised,
 // Computes the difference between ibeta(a,b,x) and ibeta(a+k,b,x):
 //
 template <class T, class Policy>
-T ibeta_a_step(T a, T b, T x, T y, int k, const Policy& pol, bool normalised, T* p_derivative)
+T ibeta_a_step(T a, T b, T x, T y, int k, const Policy& pol, bool normalised, T* p_derivative, ibeta_term_cache<T>* cache = 0)
 {
    typedef typename lanczos::lanczos<T, Policy>::type lanczos_type;
 
    BOOST_MATH_INSTRUMENT_VARIABLE(k);
 
-   T prefix = ibeta_power_terms(a, b, x, y, lanczos_type(), normalised, pol);
+   T prefix = ibeta_power_terms(a, b, x, y, lanczos_type(), normalised, pol, T(1), "boost::math::ibeta<%1%>(%1%, %1%, %1%)", cache);
    if(p_derivative)
    {
       *p_derivative = prefix;
@@ -817,7 +899,7 @@ struct Pn_size<long double>
 };
 
 template <class T, class Policy>
-T beta_small_b_large_a_series(T a, T b, T x, T y, T s0, T mult, const Policy& pol, bool normalised)
+T beta_small_b_large_a_series(T a, T b, T x, T y, T s0, T mult, const Policy& pol, bool normalised, ibeta_term_cache<T>* cache = 0)
 {
    typedef typename lanczos::lanczos<T, Policy>::type lanczos_type;
    BOOST_MATH_STD_USING
@@ -841,7 +923,11 @@ T beta_small_b_large_a_series(T a, T b, T x, T y, T s0, T mult, const Policy& po
       return s0;
    if(normalised)
    {
-      prefix = h / boost::math::tgamma_delta_ratio(a, b, pol);
+      const T* cached = cache ? cache->find(ibeta_term_cache<T>::delta_ratio, a, b) : 0;
+      T ratio = cached ? *cached : boost::math::tgamma_delta_ratio(a, b, pol);
+      if(cache && !cached)
+         cache->insert(ibeta_term_cache<T>::delta_ratio, a, b, ratio);
+      prefix = h / ratio;
       prefix /= pow(t, b);
    }
    else
@@ -990,7 +1076,7 @@ T binomial_ccdf(T n, T k, T x, T y, const Policy& pol)
 // each domain:
 //
 template <class T, class Policy>
-T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_derivative)
+T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_derivative, ibeta_term_cache<T>* cache = 0)
 {
    static const char* function = "boost::math::ibeta<%1%>(%1%, %1%, %1%)";
    typedef typename lanczos::lanczos<T, Policy>::type lanczos_type;
@@ -1118,14 +1204,14 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
          {
             if(!invert)
             {
-               fract = ibeta_series(a, b, x, T(0), lanczos_type(), normalised, p_derivative, y, pol);
+               fract = ibeta_series(a, b, x, T(0), lanczos_type(), normalised, p_derivative, y, pol, cache);
                BOOST_MATH_INSTRUMENT_VARIABLE(fract);
             }
             else
             {
                fract = -(normalised ? 1 : boost::math::beta(a, b, pol));
                invert = false;
-               fract = -ibeta_series(a, b, x, fract, lanczos_type(), normalised, p_derivative, y, pol);
+               fract = -ibeta_series(a, b, x, fract, lanczos_type(), normalised, p_derivative, y, pol, cache);
                BOOST_MATH_INSTRUMENT_VARIABLE(fract);
             }
          }
@@ -1138,14 +1224,14 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
             {
                if(!invert)
                {
-                  fract = ibeta_series(a, b, x, T(0), lanczos_type(), normalised, p_derivative, y, pol);
+                  fract = ibeta_series(a, b, x, T(0), lanczos_type(), normalised, p_derivative, y, pol, cache);
                   BOOST_MATH_INSTRUMENT_VARIABLE(fract);
                }
                else
                {
                   fract = -(normalised ? 1 : boost::math::beta(a, b, pol));
                   invert = false;
-                  fract = -ibeta_series(a, b, x, fract, lanczos_type(), normalised, p_derivative, y, pol);
+                  fract = -ibeta_series(a, b, x, fract, lanczos_type(), normalised, p_derivative, y, pol, cache);
                   BOOST_MATH_INSTRUMENT_VARIABLE(fract);
                }
             }
@@ -1161,17 +1247,17 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
                {
                   prefix = 1;
                }
-               fract = ibeta_a_step(a, b, x, y, 20, pol, normalised, p_derivative);
+               fract = ibeta_a_step(a, b, x, y, 20, pol, normalised, p_derivative, cache);
                if(!invert)
                {
-                  fract = beta_small_b_large_a_series(T(a + 20), b, x, y, fract, prefix, pol, normalised);
+                  fract = beta_small_b_large_a_series(T(a + 20), b, x, y, fract, prefix, pol, normalised, cache);
                   BOOST_MATH_INSTRUMENT_VARIABLE(fract);
                }
                else
                {
                   fract -= (normalised ? 1 : boost::math::beta(a, b, pol));
                   invert = false;
-                  fract = -beta_small_b_large_a_series(T(a + 20), b, x, y, fract, prefix, pol, normalised);
+                  fract = -beta_small_b_large_a_series(T(a + 20), b, x, y, fract, prefix, pol, normalised, cache);
                   BOOST_MATH_INSTRUMENT_VARIABLE(fract);
                }
             }
@@ -1184,14 +1270,14 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
          {
             if(!invert)
             {
-               fract = ibeta_series(a, b, x, T(0), lanczos_type(), normalised, p_derivative, y, pol);
+               fract = ibeta_series(a, b, x, T(0), lanczos_type(), normalised, p_derivative, y, pol, cache);
                BOOST_MATH_INSTRUMENT_VARIABLE(fract);
             }
             else
             {
                fract = -(normalised ? 1 : boost::math::beta(a, b, pol));
                invert = false;
-               fract = -ibeta_series(a, b, x, fract, lanczos_type(), normalised, p_derivative, y, pol);
+               fract = -ibeta_series(a, b, x, fract, lanczos_type(), normalised, p_derivative, y, pol, cache);
                BOOST_MATH_INSTRUMENT_VARIABLE(fract);
             }
          }
@@ -1205,14 +1291,14 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
             {
                if(!invert)
                {
-                  fract = ibeta_series(a, b, x, T(0), lanczos_type(), normalised, p_derivative, y, pol);
+                  fract = ibeta_series(a, b, x, T(0), lanczos_type(), normalised, p_derivative, y, pol, cache);
                   BOOST_MATH_INSTRUMENT_VARIABLE(fract);
                }
                else
                {
                   fract = -(normalised ? 1 : boost::math::beta(a, b, pol));
                   invert = false;
-                  fract = -ibeta_series(a, b, x, fract, lanczos_type(), normalised, p_derivative, y, pol);
+                  fract = -ibeta_series(a, b, x, fract, lanczos_type(), normalised, p_derivative, y, pol, cache);
                   BOOST_MATH_INSTRUMENT_VARIABLE(fract);
                }
             }
@@ -1220,14 +1306,14 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
             {
                if(!invert)
                {
-                  fract = beta_small_b_large_a_series(a, b, x, y, T(0), T(1), pol, normalised);
+                  fract = beta_small_b_large_a_series(a, b, x, y, T(0), T(1), pol, normalised, cache);
                   BOOST_MATH_INSTRUMENT_VARIABLE(fract);
                }
                else
                {
                   fract = -(normalised ? 1 : boost::math::beta(a, b, pol));
                   invert = false;
-                  fract = -beta_small_b_large_a_series(a, b, x, y, fract, T(1), pol, normalised);
+                  fract = -beta_small_b_large_a_series(a, b, x, y, fract, T(1), pol, normalised, cache);
                   BOOST_MATH_INSTRUMENT_VARIABLE(fract);
                }
             }
@@ -1243,18 +1329,18 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
                {
                   prefix = 1;
                }
-               fract = ibeta_a_step(a, b, x, y, 20, pol, normalised, p_derivative);
+               fract = ibeta_a_step(a, b, x, y, 20, pol, normalised, p_derivative, cache);
                BOOST_MATH_INSTRUMENT_VARIABLE(fract);
                if(!invert)
                {
-                  fract = beta_small_b_large_a_series(T(a + 20), b, x, y, fract, prefix, pol, normalised);
+                  fract = beta_small_b_large_a_series(T(a + 20), b, x, y, fract, prefix, pol, normalised, cache);
                   BOOST_MATH_INSTRUMENT_VARIABLE(fract);
                }
                else
                {
                   fract -= (normalised ? 1 : boost::math::beta(a, b, pol));
                   invert = false;
-                  fract = -beta_small_b_large_a_series(T(a + 20), b, x, y, fract, prefix, pol, normalised);
+                  fract = -beta_small_b_large_a_series(T(a + 20), b, x, y, fract, prefix, pol, normalised, cache);
                   BOOST_MATH_INSTRUMENT_VARIABLE(fract);
                }
             }
@@ -1297,14 +1383,14 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
          {
             if(!invert)
             {
-               fract = ibeta_series(a, b, x, T(0), lanczos_type(), normalised, p_derivative, y, pol);
+               fract = ibeta_series(a, b, x, T(0), lanczos_type(), normalised, p_derivative, y, pol, cache);
                BOOST_MATH_INSTRUMENT_VARIABLE(fract);
             }
             else
             {
                fract = -(normalised ? 1 : boost::math::beta(a, b, pol));
                invert = false;
-               fract = -ibeta_series(a, b, x, fract, lanczos_type(), normalised, p_derivative, y, pol);
+               fract = -ibeta_series(a, b, x, fract, lanczos_type(), normalised, p_derivative, y, pol, cache);
                BOOST_MATH_INSTRUMENT_VARIABLE(fract);
             }
          }
@@ -1324,8 +1410,8 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
             {
                prefix = 1;
             }
-            fract = ibeta_a_step(bbar, a, y, x, n, pol, normalised, static_cast<T*>(0));
-            fract = beta_small_b_large_a_series(a,  bbar, x, y, fract, T(1), pol, normalised);
+            fract = ibeta_a_step(bbar, a, y, x, n, pol, normalised, static_cast<T*>(0), cache);
+            fract = beta_small_b_large_a_series(a,  bbar, x, y, fract, T(1), pol, normalised, cache);
             fract /= prefix;
             BOOST_MATH_INSTRUMENT_VARIABLE(fract);
          }
@@ -1341,11 +1427,11 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
                --n;
                bbar += 1;
             }
-            fract = ibeta_a_step(bbar, a, y, x, n, pol, normalised, static_cast<T*>(0));
-            fract += ibeta_a_step(a, bbar, x, y, 20, pol, normalised, static_cast<T*>(0));
+            fract = ibeta_a_step(bbar, a, y, x, n, pol, normalised, static_cast<T*>(0), cache);
+            fract += ibeta_a_step(a, bbar, x, y, 20, pol, normalised, static_cast<T*>(0), cache);
             if(invert)
                fract -= 1;  // Note this line would need changing if we ever enable this branch in non-normalized case
-            fract = beta_small_b_large_a_series(T(a+20),  bbar, x, y, fract, T(1), pol, normalised);
+            fract = beta_small_b_large_a_series(T(a+20),  bbar, x, y, fract, T(1), pol, normalised, cache);
             if(invert)
             {
                fract = -fract;
@@ -1355,13 +1441,13 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
          }
          else
          {
-            fract = ibeta_fraction2(a, b, x, y, pol, normalised, p_derivative);
+            fract = ibeta_fraction2(a, b, x, y, pol, normalised, p_derivative, cache);
             BOOST_MATH_INSTRUMENT_VARIABLE(fract);
          }
       }
       else
       {
-         fract = ibeta_fraction2(a, b, x, y, pol, normalised, p_derivative);
+         fract = ibeta_fraction2(a, b, x, y, pol, normalised, p_derivative, cache);
          BOOST_MATH_INSTRUMENT_VARIABLE(fract);
       }
    }
@@ -1369,7 +1455,7 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
    {
       if(*p_derivative < 0)
       {
-         *p_derivative = ibeta_power_terms(a, b, x, y, lanczos_type(), true, pol);
+         *p_derivative = ibeta_power_terms(a, b, x, y, lanczos_type(), true, pol, T(1), function, cache);
       }
       T div = y * x;
 
@@ -1591,5 +1677,6 @@ inline typename tools::promote_args<RT1, RT2, RT3>::type
 
 #include <boost/math/special_functions/detail/ibeta_inverse.hpp>
 #include <boost/math/special_functions/detail/ibeta_inv_ab.hpp>
+#include <boost/math/special_functions/detail/ibeta_evaluator.hpp>
 
 #endif // BOOST_MATH_SPECIAL_BETA_HPP
@@ -12,6 +12,7 @@
 #include <boost/math/tools/atomic.hpp>
 #include <boost/utility/enable_if.hpp>
 #include <boost/math/tools/toms748_solve.hpp>
+#include <boost/math/tools/cache_statistics.hpp>
 #include <boost/math/tools/cxx03_warn.hpp>
 #include <vector>
 
@@ -358,6 +359,46 @@ public:
       }
    }
 
+   //
+   // Fills the cache with at least the first n Bernoulli and tangent numbers (or as
+   // many as it can hold), and returns the number it now holds.  Once a value is
+   // in the cache, reading it never takes the lock, so calling this at startup
+   // removes any contention between threads making their first calls.
+   //
+   std::size_t reserve(std::size_t n)
+   {
+      n = (std::min)(n, static_cast<std::size_t>(bn.capacity()));
+   #if !defined(BOOST_HAS_THREADS)
+      extend(n);
+      return bn.size();
+   #elif defined(BOOST_MATH_NO_ATOMIC_INT)
+      boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
+      extend(n);
+      return bn.size();
+   #else
+      if(!is_committed(n))
+      {
+         boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
+         if(!is_committed(n))
+         {
+            extend(n);
+            m_counter.store(static_cast<atomic_integer_type>(bn.size()), BOOST_MATH_ATOMIC_NS::memory_order_release);
+         }
+      }
+      return static_cast<std::size_t>(m_counter.load(BOOST_MATH_ATOMIC_NS::memory_order_acquire));
+   #endif
+   }
+
+   tools::cache_statistics statistics()
+   {
+   #if defined(BOOST_HAS_THREADS)
+      boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
+   #endif
+      tools::cache_statistics result(m_statistics);
+      result.size = bn.size();
+      return result;
+   }
+
    template <class OutputIterator>
    OutputIterator copy_bernoulli_numbers(OutputIterator out, std::size_t start, std::size_t n, const Policy& pol)
    {
@@ -400,18 +441,7 @@ public:
       //
       // Single threaded code, very simple:
       //
-      if(m_current_precision < boost::math::tools::digits<T>())
-      {
-         bn.clear();
-         tn.clear();
-         m_intermediates.clear();
-         m_current_precision = boost::math::tools::digits<T>();
-      }
-      if(start + n >= bn.size())
-      {
-         std::size_t new_size = (std::min)((std::max)((std::max)(std::size_t(start + n), std::size_t(bn.size() + 20)), std::size_t(50)), std::size_t(bn.capacity()));
-         tangent_numbers_series(new_size);
-      }
+      extend(start + n);
 
       for(std::size_t i = (std::max)(std::size_t(max_bernoulli_b2n<T>::value + 1), start); i < start + n; ++i)
       {
@@ -423,18 +453,7 @@ public:
       // We need to grab a mutex every time we get here, for both readers and writers:
       //
       boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
-      if(m_current_precision < boost::math::tools::digits<T>())
-      {
-         bn.clear();
-         tn.clear();
-         m_intermediates.clear();
-         m_current_precision = boost::math::tools::digits<T>();
-      }
-      if(start + n >= bn.size())
-      {
-         std::size_t new_size = (std::min)((std::max)((std::max)(std::size_t(start + n), std::size_t(bn.size() + 20)), std::size_t(50)), std::size_t(bn.capacity()));
-         tangent_numbers_series(new_size);
-      }
+      extend(start + n);
 
       for(std::size_t i = (std::max)(std::size_t(max_bernoulli_b2n<T>::value + 1), start); i < start + n; ++i)
       {
@@ -449,27 +468,13 @@ public:
       //
       // Get the counter and see if we need to calculate more constants:
       //
-      if((static_cast<std::size_t>(m_counter.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < start + n)
-         || (static_cast<int>(m_current_precision.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < boost::math::tools::digits<T>()))
+      if(!is_committed(start + n))
       {
          boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
 
-         if((static_cast<std::size_t>(m_counter.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < start + n)
-            || (static_cast<int>(m_current_precision.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < boost::math::tools::digits<T>()))
+         if(!is_committed(start + n))
          {
-            if(static_cast<int>(m_current_precision.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < boost::math::tools::digits<T>())
-            {
-               bn.clear();
-               tn.clear();
-               m_intermediates.clear();
-               m_counter.store(0, BOOST_MATH_ATOMIC_NS::memory_order_release);
-               m_current_precision = boost::math::tools::digits<T>();
-            }
-            if(start + n >= bn.size())
-            {
-               std::size_t new_size = (std::min)((std::max)((std::max)(std::size_t(start + n), std::size_t(bn.size() + 20)), std::size_t(50)), std::size_t(bn.capacity()));
-               tangent_numbers_series(new_size);
-            }
+            extend(start + n);
             m_counter.store(static_cast<atomic_integer_type>(bn.size()), BOOST_MATH_ATOMIC_NS::memory_order_release);
          }
       }
@@ -527,18 +532,7 @@ public:
       //
       // Single threaded code, very simple:
       //
-      if(m_current_precision < boost::math::tools::digits<T>())
-      {
-         bn.clear();
-         tn.clear();
-         m_intermediates.clear();
-         m_current_precision = boost::math::tools::digits<T>();
-      }
-      if(start + n >= bn.size())
-      {
-         std::size_t new_size = (std::min)((std::max)((std::max)(start + n, std::size_t(bn.size() + 20)), std::size_t(50)), std::size_t(bn.capacity()));
-         tangent_numbers_series(new_size);
-      }
+      extend(start + n);
 
       for(std::size_t i = start; i < start + n; ++i)
       {
@@ -558,18 +552,7 @@ public:
       // We need to grab a mutex every time we get here, for both readers and writers:
       //
       boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
-      if(m_current_precision < boost::math::tools::digits<T>())
-      {
-         bn.clear();
-         tn.clear();
-         m_intermediates.clear();
-         m_current_precision = boost::math::tools::digits<T>();
-      }
-      if(start + n >= bn.size())
-      {
-         std::size_t new_size = (std::min)((std::max)((std::max)(start + n, std::size_t(bn.size() + 20)), std::size_t(50)), std::size_t(bn.capacity()));
-         tangent_numbers_series(new_size);
-      }
+      extend(start + n);
 
       for(std::size_t i = start; i < start + n; ++i)
       {
@@ -592,27 +575,13 @@ public:
       //
       // Get the counter and see if we need to calculate more constants:
       //
-      if((static_cast<std::size_t>(m_counter.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < start + n)
-         || (static_cast<int>(m_current_precision.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < boost::math::tools::digits<T>()))
+      if(!is_committed(start + n))
       {
          boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
 
-         if((static_cast<std::size_t>(m_counter.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < start + n)
-            || (static_cast<int>(m_current_precision.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < boost::math::tools::digits<T>()))
+         if(!is_committed(start + n))
          {
-            if(static_cast<int>(m_current_precision.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < boost::math::tools::digits<T>())
-            {
-               bn.clear();
-               tn.clear();
-               m_intermediates.clear();
-               m_counter.store(0, BOOST_MATH_ATOMIC_NS::memory_order_release);
-               m_current_precision = boost::math::tools::digits<T>();
-            }
-            if(start + n >= bn.size())
-            {
-               std::size_t new_size = (std::min)((std::max)((std::max)(start + n, std::size_t(bn.size() + 20)), std::size_t(50)), std::size_t(bn.capacity()));
-               tangent_numbers_series(new_size);
-            }
+            extend(start + n);
             m_counter.store(static_cast<atomic_integer_type>(bn.size()), BOOST_MATH_ATOMIC_NS::memory_order_release);
          }
       }
@@ -636,6 +605,41 @@ public:
    }
 
 private:
+   //
+   // Makes sure the first required values are present, discarding the existing values
+   // first if they were calculated at a lower precision.  The caller must hold the lock:
+   //
+   void extend(std::size_t required)
+   {
+      if(static_cast<int>(m_current_precision) < boost::math::tools::digits<T>())
+      {
+         bn.clear();
+         tn.clear();
+         m_intermediates.clear();
+   #if defined(BOOST_HAS_THREADS) && !defined(BOOST_MATH_NO_ATOMIC_INT)
+         m_counter.store(0, BOOST_MATH_ATOMIC_NS::memory_order_release);
+   #endif
+         m_current_precision = boost::math::tools::digits<T>();
+      }
+      if((required >= bn.size()) && (bn.size() < bn.capacity()))
+      {
+         tools::detail::cache_growth_timer timer(m_statistics);
+         std::size_t new_size = (std::min)((std::max)((std::max)(required, std::size_t(bn.size() + 20)), std::size_t(50)), std::size_t(bn.capacity()));
+         tangent_numbers_series(new_size);
+      }
+   }
+#if defined(BOOST_HAS_THREADS) && !defined(BOOST_MATH_NO_ATOMIC_INT)
+   //
+   // True if the first n values are already available to every thread.  The acquire
+   // loads pair with the release stores made after each extension of the tables, so
+   // the values themselves (and m_overflow_limit) may then be read without the lock:
+   //
+   bool is_committed(std::size_t n)const
+   {
+      return (static_cast<std::size_t>(m_counter.load(BOOST_MATH_ATOMIC_NS::memory_order_acquire)) >= n)
+         && (static_cast<int>(m_current_precision.load(BOOST_MATH_ATOMIC_NS::memory_order_acquire)) >= boost::math::tools::digits<T>());
+   }
+#endif
    //
    // The caches for Bernoulli and tangent numbers, once allocated,
    // these must NEVER EVER reallocate as it breaks our thread
@@ -645,6 +649,8 @@ private:
    std::vector<T> m_intermediates;
    // The value at which we know overflow has already occurred for the Bn:
    std::size_t m_overflow_limit;
+   // Guarded by the same lock as the tables themselves:
+   tools::cache_statistics m_statistics;
 #if !defined(BOOST_HAS_THREADS)
    int m_current_precision;
 #elif defined(BOOST_MATH_NO_ATOMIC_INT)
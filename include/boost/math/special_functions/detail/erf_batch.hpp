@@ -0,0 +1,316 @@
+//  Copyright 2020 Boost.Math contributors
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_SF_ERF_BATCH_HPP
+#define BOOST_MATH_SF_ERF_BATCH_HPP
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include <iterator>
+#include <limits>
+#include <boost/math/tools/detail/batch.hpp>
+
+//
+// Array overloads of erf, erfc, erf_inv and erfc_inv.
+//
+// For float and double arguments these use the same minimax rational approximations
+// as the scalar 53-bit erf_imp and 64-bit erf_inv_imp, but rearranged so that each
+// block of arguments is evaluated with no data dependent branches: the interval
+// each argument falls in becomes a row index into a table of coefficients (shorter
+// approximations are padded with zero high order terms, which leaves the value
+// unchanged), so whole blocks go through the vector units.  The only remaining
+// scalar work is exp/log from the C runtime, and a fix-up pass which sends
+// arguments that need policy based error handling (NaN's, domain and pole errors)
+// through the scalar functions.
+//
+// Note that these always evaluate at double precision: the promote_double policy
+// is ignored, so results are those of erf(z, policy<promote_double<false> >()).
+// Other types simply loop over the scalar implementation, with the policy and
+// precision dispatch hoisted out of the loop.
+//
+namespace boost{ namespace math{ namespace detail{
+
+template <class T>
+struct erf_batch_use_kernel
+{
+   static const bool value = (boost::is_same<T, double>::value || boost::is_same<T, float>::value)
+      && std::numeric_limits<double>::is_iec559 && (std::numeric_limits<double>::digits == 53);
+};
+
+inline void erf_batch_kernel(const double* z, double* result, std::size_t n, bool invert)
+{
+   BOOST_MATH_STD_USING
+   //
+   // Row 0 is erf for |z| < 0.5, rows 1-4 are erfc for [0.5,1.5), [1.5,2.5), [2.5,4.5) and [4.5,28):
+   // see erf_imp(T, bool, const Policy&, const integral_constant<int, 53>&) for the error terms.
+   //
+   static const double Y[5] = { 1.044948577880859375, 0.405935764312744140625, 0.50672817230224609375, 0.5405750274658203125, 0.5579090118408203125 };
+   static const double offset[5] = { 0, 0.5, 1.5, 3.5, 0 };
+   static const double P[5][7] = {
+      { BOOST_MATH_BIG_CONSTANT(double, 53, 0.0834305892146531832907), BOOST_MATH_BIG_CONSTANT(double, 53, -0.338165134459360935041), BOOST_MATH_BIG_CONSTANT(double, 53, -0.0509990735146777432841), BOOST_MATH_BIG_CONSTANT(double, 53, -0.00772758345802133288487), BOOST_MATH_BIG_CONSTANT(double, 53, -0.000322780120964605683831), 0, 0 },
+      { BOOST_MATH_BIG_CONSTANT(double, 53, -0.098090592216281240205), BOOST_MATH_BIG_CONSTANT(double, 53, 0.178114665841120341155), BOOST_MATH_BIG_CONSTANT(double, 53, 0.191003695796775433986), BOOST_MATH_BIG_CONSTANT(double, 53, 0.0888900368967884466578), BOOST_MATH_BIG_CONSTANT(double, 53, 0.0195049001251218801359), BOOST_MATH_BIG_CONSTANT(double, 53, 0.00180424538297014223957), 0 },
+      { BOOST_MATH_BIG_CONSTANT(double, 53, -0.0243500476207698441272), BOOST_MATH_BIG_CONSTANT(double, 53, 0.0386540375035707201728), BOOST_MATH_BIG_CONSTANT(double, 53, 0.04394818964209516296), BOOST_MATH_BIG_CONSTANT(double, 53, 0.0175679436311802092299), BOOST_MATH_BIG_CONSTANT(double, 53, 0.00323962406290842133584), BOOST_MATH_BIG_CONSTANT(double, 53, 0.000235839115596880717416), 0 },
+      { BOOST_MATH_BIG_CONSTANT(double, 53, 0.00295276716530971662634), BOOST_MATH_BIG_CONSTANT(double, 53, 0.0137384425896355332126), BOOST_MATH_BIG_CONSTANT(double, 53, 0.00840807615555585383007), BOOST_MATH_BIG_CONSTANT(double, 53, 0.00212825620914618649141), BOOST_MATH_BIG_CONSTANT(double, 53, 0.000250269961544794627958), BOOST_MATH_BIG_CONSTANT(double, 53, 0.113212406648847561139e-4), 0 },
+      { BOOST_MATH_BIG_CONSTANT(double, 53, 0.00628057170626964891937), BOOST_MATH_BIG_CONSTANT(double, 53, 0.0175389834052493308818), BOOST_MATH_BIG_CONSTANT(double, 53, -0.212652252872804219852), BOOST_MATH_BIG_CONSTANT(double, 53, -0.687717681153649930619), BOOST_MATH_BIG_CONSTANT(double, 53, -2.5518551727311523996), BOOST_MATH_BIG_CONSTANT(double, 53, -3.22729451764143718517), BOOST_MATH_BIG_CONSTANT(double, 53, -2.8175401114513378771) },
+   };
+   static const double Q[5][7] = {
+      { BOOST_MATH_BIG_CONSTANT(double, 53, 1.0), BOOST_MATH_BIG_CONSTANT(double, 53, 0.455004033050794024546), BOOST_MATH_BIG_CONSTANT(double, 53, 0.0875222600142252549554), BOOST_MATH_BIG_CONSTANT(double, 53, 0.00858571925074406212772), BOOST_MATH_BIG_CONSTANT(double, 53, 0.000370900071787748000569), 0, 0 },
+      { BOOST_MATH_BIG_CONSTANT(double, 53, 1.0), BOOST_MATH_BIG_CONSTANT(double, 53, 1.84759070983002217845), BOOST_MATH_BIG_CONSTANT(double, 53, 1.42628004845511324508), BOOST_MATH_BIG_CONSTANT(double, 53, 0.578052804889902404909), BOOST_MATH_BIG_CONSTANT(double, 53, 0.12385097467900864233), BOOST_MATH_BIG_CONSTANT(double, 53, 0.0113385233577001411017), BOOST_MATH_BIG_CONSTANT(double, 53, 0.337511472483094676155e-5) },
+      { BOOST_MATH_BIG_CONSTANT(double, 53, 1.0), BOOST_MATH_BIG_CONSTANT(double, 53, 1.53991494948552447182), BOOST_MATH_BIG_CONSTANT(double, 53, 0.982403709157920235114), BOOST_MATH_BIG_CONSTANT(double, 53, 0.325732924782444448493), BOOST_MATH_BIG_CONSTANT(double, 53, 0.0563921837420478160373), BOOST_MATH_BIG_CONSTANT(double, 53, 0.00410369723978904575884), 0 },
+      { BOOST_MATH_BIG_CONSTANT(double, 53, 1.0), BOOST_MATH_BIG_CONSTANT(double, 53, 1.04217814166938418171), BOOST_MATH_BIG_CONSTANT(double, 53, 0.442597659481563127003), BOOST_MATH_BIG_CONSTANT(double, 53, 0.0958492726301061423444), BOOST_MATH_BIG_CONSTANT(double, 53, 0.0105982906484876531489), BOOST_MATH_BIG_CONSTANT(double, 53, 0.000479411269521714493907), 0 },
+      { BOOST_MATH_BIG_CONSTANT(double, 53, 1.0), BOOST_MATH_BIG_CONSTANT(double, 53, 2.79257750980575282228), BOOST_MATH_BIG_CONSTANT(double, 53, 11.0567237927800161565), BOOST_MATH_BIG_CONSTANT(double, 53, 15.930646027911794143), BOOST_MATH_BIG_CONSTANT(double, 53, 22.9367376522880577224), BOOST_MATH_BIG_CONSTANT(double, 53, 13.5064170191802889145), BOOST_MATH_BIG_CONSTANT(double, 53, 5.48409182238641741584) },
+   };
+
+   double s[tools::detail::batch_block_size];
+   double sq[tools::detail::batch_block_size];
+   double e[tools::detail::batch_block_size];
+
+   for(std::size_t i = 0; i < n; ++i)
+   {
+      double a = fabs(z[i]);
+      std::size_t k = (a >= 0.5) + (a >= 1.5) + (a >= 2.5) + (a >= 4.5);
+      double t = (k == 0) ? a * a : (k == 4) ? 1 / a : a - offset[k];
+      s[i] = Y[k] + tools::detail::evaluate_polynomial_row(P, k, t) / tools::detail::evaluate_polynomial_row(Q, k, t);
+      sq[i] = a * a;
+   }
+   for(std::size_t i = 0; i < n; ++i)
+      e[i] = exp(-sq[i]);
+   for(std::size_t i = 0; i < n; ++i)
+   {
+      double a = fabs(z[i]);
+      //
+      // exp(-z^2) loses accuracy through the rounding error in z^2, so recover that
+      // error exactly by splitting z into 26-bit halves (Veltkamp) and correct with
+      // exp(-err) = 1 - err, which is exact to double precision as |err| < 1e-13:
+      //
+      double c = 134217729.0 * a;
+      double hi = c - (c - a);
+      double lo = a - hi;
+      double err = ((hi * hi - sq[i]) + 2 * hi * lo) + lo * lo;
+      double tail = s[i] * (e[i] * (1 - err)) / a;
+      // erfc(z) underflows to zero for z >= 28:
+      tail = (a < 28) ? tail : 0;
+      double small = a * s[i];
+      double sign = (z[i] < 0) ? -1 : 1;
+      if(invert)
+         result[i] = (a < 0.5) ? 1 - sign * small : (z[i] < 0) ? 2 - tail : tail;
+      else
+         result[i] = sign * ((a < 0.5) ? small : 1 - tail);
+   }
+}
+
+inline void erf_inv_batch_kernel(const double* z, double* result, std::size_t n, bool invert)
+{
+   BOOST_MATH_STD_USING
+   //
+   // Row 0 is p <= 0.5, row 1 is 0.5 > q >= 0.25 and rows 2-6 are the tail approximations in
+   // x = sqrt(-log(q)) for x in [0,3), [3,6), [6,18), [18,44) and [44,inf): the coefficients
+   // are those of erf_inv_imp(const T&, const T&, const Policy&, const integral_constant<int, 64>*).
+   //
+   static const double Y[7] = { 0.0891314744949340820313f, 2.249481201171875f, 0.807220458984375f, 0.93995571136474609375f, 0.98362827301025390625f, 0.99714565277099609375f, 0.99941349029541015625f };
+   static const double offset[7] = { 0, 0.25, 1.125, 3, 6, 18, 44 };
+   static const double P[7][11] = {
+      { BOOST_MATH_BIG_CONSTANT(double, 64, -0.000508781949658280665617), BOOST_MATH_BIG_CONSTANT(double, 64, -0.00836874819741736770379), BOOST_MATH_BIG_CONSTANT(double, 64, 0.0334806625409744615033), BOOST_MATH_BIG_CONSTANT(double, 64, -0.0126926147662974029034), BOOST_MATH_BIG_CONSTANT(double, 64, -0.0365637971411762664006), BOOST_MATH_BIG_CONSTANT(double, 64, 0.0219878681111168899165), BOOST_MATH_BIG_CONSTANT(double, 64, 0.00822687874676915743155), BOOST_MATH_BIG_CONSTANT(double, 64, -0.00538772965071242932965), 0, 0, 0 },
+      { BOOST_MATH_BIG_CONSTANT(double, 64, -0.202433508355938759655), BOOST_MATH_BIG_CONSTANT(double, 64, 0.105264680699391713268), BOOST_MATH_BIG_CONSTANT(double, 64, 8.37050328343119927838), BOOST_MATH_BIG_CONSTANT(double, 64, 17.6447298408374015486), BOOST_MATH_BIG_CONSTANT(double, 64, -18.8510648058714251895), BOOST_MATH_BIG_CONSTANT(double, 64, -44.6382324441786960818), BOOST_MATH_BIG_CONSTANT(double, 64, 17.445385985570866523), BOOST_MATH_BIG_CONSTANT(double, 64, 21.1294655448340526258), BOOST_MATH_BIG_CONSTANT(double, 64, -3.67192254707729348546), 0, 0 },
+      { BOOST_MATH_BIG_CONSTANT(double, 64, -0.131102781679951906451), BOOST_MATH_BIG_CONSTANT(double, 64, -0.163794047193317060787), BOOST_MATH_BIG_CONSTANT(double, 64, 0.117030156341995252019), BOOST_MATH_BIG_CONSTANT(double, 64, 0.387079738972604337464), BOOST_MATH_BIG_CONSTANT(double, 64, 0.337785538912035898924), BOOST_MATH_BIG_CONSTANT(double, 64, 0.142869534408157156766), BOOST_MATH_BIG_CONSTANT(double, 64, 0.0290157910005329060432), BOOST_MATH_BIG_CONSTANT(double, 64, 0.00214558995388805277169), BOOST_MATH_BIG_CONSTANT(double, 64, -0.679465575181126350155e-6), BOOST_MATH_BIG_CONSTANT(double, 64, 0.285225331782217055858e-7), BOOST_MATH_BIG_CONSTANT(double, 64, -0.681149956853776992068e-9) },
+      { BOOST_MATH_BIG_CONSTANT(double, 64, -0.0350353787183177984712), BOOST_MATH_BIG_CONSTANT(double, 64, -0.00222426529213447927281), BOOST_MATH_BIG_CONSTANT(double, 64, 0.0185573306514231072324), BOOST_MATH_BIG_CONSTANT(double, 64, 0.00950804701325919603619), BOOST_MATH_BIG_CONSTANT(double, 64, 0.00187123492819559223345), BOOST_MATH_BIG_CONSTANT(double, 64, 0.000157544617424960554631), BOOST_MATH_BIG_CONSTANT(double, 64, 0.460469890584317994083e-5), BOOST_MATH_BIG_CONSTANT(double, 64, -0.230404776911882601748e-9), BOOST_MATH_BIG_CONSTANT(double, 64, 0.266339227425782031962e-11), 0, 0 },
+      { BOOST_MATH_BIG_CONSTANT(double, 64, -0.0167431005076633737133), BOOST_MATH_BIG_CONSTANT(double, 64, -0.00112951438745580278863), BOOST_MATH_BIG_CONSTANT(double, 64, 0.00105628862152492910091), BOOST_MATH_BIG_CONSTANT(double, 64, 0.000209386317487588078668), BOOST_MATH_BIG_CONSTANT(double, 64, 0.149624783758342370182e-4), BOOST_MATH_BIG_CONSTANT(double, 64, 0.449696789927706453732e-6), BOOST_MATH_BIG_CONSTANT(double, 64, 0.462596163522878599135e-8), BOOST_MATH_BIG_CONSTANT(double, 64, -0.281128735628831791805e-13), BOOST_MATH_BIG_CONSTANT(double, 64, 0.99055709973310326855e-16), 0, 0 },
+      { BOOST_MATH_BIG_CONSTANT(double, 64, -0.0024978212791898131227), BOOST_MATH_BIG_CONSTANT(double, 64, -0.779190719229053954292e-5), BOOST_MATH_BIG_CONSTANT(double, 64, 0.254723037413027451751e-4), BOOST_MATH_BIG_CONSTANT(double, 64, 0.162397777342510920873e-5), BOOST_MATH_BIG_CONSTANT(double, 64, 0.396341011304801168516e-7), BOOST_MATH_BIG_CONSTANT(double, 64, 0.411632831190944208473e-9), BOOST_MATH_BIG_CONSTANT(double, 64, 0.145596286718675035587e-11), BOOST_MATH_BIG_CONSTANT(double, 64, -0.116765012397184275695e-17), 0, 0, 0 },
+      { BOOST_MATH_BIG_CONSTANT(double, 64, -0.000539042911019078575891), BOOST_MATH_BIG_CONSTANT(double, 64, -0.28398759004727721098e-6), BOOST_MATH_BIG_CONSTANT(double, 64, 0.899465114892291446442e-6), BOOST_MATH_BIG_CONSTANT(double, 64, 0.229345859265920864296e-7), BOOST_MATH_BIG_CONSTANT(double, 64, 0.225561444863500149219e-9), BOOST_MATH_BIG_CONSTANT(double, 64, 0.947846627503022684216e-12), BOOST_MATH_BIG_CONSTANT(double, 64, 0.135880130108924861008e-14), BOOST_MATH_BIG_CONSTANT(double, 64, -0.348890393399948882918e-21), 0, 0, 0 },
+   };
+   static const double Q[7][10] = {
+      { BOOST_MATH_BIG_CONSTANT(double, 64, 1.0), BOOST_MATH_BIG_CONSTANT(double, 64, -0.970005043303290640362), BOOST_MATH_BIG_CONSTANT(double, 64, -1.56574558234175846809), BOOST_MATH_BIG_CONSTANT(double, 64, 1.56221558398423026363), BOOST_MATH_BIG_CONSTANT(double, 64, 0.662328840472002992063), BOOST_MATH_BIG_CONSTANT(double, 64, -0.71228902341542847553), BOOST_MATH_BIG_CONSTANT(double, 64, -0.0527396382340099713954), BOOST_MATH_BIG_CONSTANT(double, 64, 0.0795283687341571680018), BOOST_MATH_BIG_CONSTANT(double, 64, -0.00233393759374190016776), BOOST_MATH_BIG_CONSTANT(double, 64, 0.000886216390456424707504) },
+      { BOOST_MATH_BIG_CONSTANT(double, 64, 1.0), BOOST_MATH_BIG_CONSTANT(double, 64, 6.24264124854247537712), BOOST_MATH_BIG_CONSTANT(double, 64, 3.9713437953343869095), BOOST_MATH_BIG_CONSTANT(double, 64, -28.6608180499800029974), BOOST_MATH_BIG_CONSTANT(double, 64, -20.1432634680485188801), BOOST_MATH_BIG_CONSTANT(double, 64, 48.5609213108739935468), BOOST_MATH_BIG_CONSTANT(double, 64, 10.8268667355460159008), BOOST_MATH_BIG_CONSTANT(double, 64, -22.6436933413139721736), BOOST_MATH_BIG_CONSTANT(double, 64, 1.72114765761200282724), 0 },
+      { BOOST_MATH_BIG_CONSTANT(double, 64, 1.0), BOOST_MATH_BIG_CONSTANT(double, 64, 3.46625407242567245975), BOOST_MATH_BIG_CONSTANT(double, 64, 5.38168345707006855425), BOOST_MATH_BIG_CONSTANT(double, 64, 4.77846592945843778382), BOOST_MATH_BIG_CONSTANT(double, 64, 2.59301921623620271374), BOOST_MATH_BIG_CONSTANT(double, 64, 0.848854343457902036425), BOOST_MATH_BIG_CONSTANT(double, 64, 0.152264338295331783612), BOOST_MATH_BIG_CONSTANT(double, 64, 0.01105924229346489121), 0, 0 },
+      { BOOST_MATH_BIG_CONSTANT(double, 64, 1.0), BOOST_MATH_BIG_CONSTANT(double, 64, 1.3653349817554063097), BOOST_MATH_BIG_CONSTANT(double, 64, 0.762059164553623404043), BOOST_MATH_BIG_CONSTANT(double, 64, 0.220091105764131249824), BOOST_MATH_BIG_CONSTANT(double, 64, 0.0341589143670947727934), BOOST_MATH_BIG_CONSTANT(double, 64, 0.00263861676657015992959), BOOST_MATH_BIG_CONSTANT(double, 64, 0.764675292302794483503e-4), 0, 0, 0 },
+      { BOOST_MATH_BIG_CONSTANT(double, 64, 1.0), BOOST_MATH_BIG_CONSTANT(double, 64, 0.591429344886417493481), BOOST_MATH_BIG_CONSTANT(double, 64, 0.138151865749083321638), BOOST_MATH_BIG_CONSTANT(double, 64, 0.0160746087093676504695), BOOST_MATH_BIG_CONSTANT(double, 64, 0.000964011807005165528527), BOOST_MATH_BIG_CONSTANT(double, 64, 0.275335474764726041141e-4), BOOST_MATH_BIG_CONSTANT(double, 64, 0.282243172016108031869e-6), 0, 0, 0 },
+      { BOOST_MATH_BIG_CONSTANT(double, 64, 1.0), BOOST_MATH_BIG_CONSTANT(double, 64, 0.207123112214422517181), BOOST_MATH_BIG_CONSTANT(double, 64, 0.0169410838120975906478), BOOST_MATH_BIG_CONSTANT(double, 64, 0.000690538265622684595676), BOOST_MATH_BIG_CONSTANT(double, 64, 0.145007359818232637924e-4), BOOST_MATH_BIG_CONSTANT(double, 64, 0.144437756628144157666e-6), BOOST_MATH_BIG_CONSTANT(double, 64, 0.509761276599778486139e-9), 0, 0, 0 },
+      { BOOST_MATH_BIG_CONSTANT(double, 64, 1.0), BOOST_MATH_BIG_CONSTANT(double, 64, 0.0845746234001899436914), BOOST_MATH_BIG_CONSTANT(double, 64, 0.00282092984726264681981), BOOST_MATH_BIG_CONSTANT(double, 64, 0.468292921940894236786e-4), BOOST_MATH_BIG_CONSTANT(double, 64, 0.399968812193862100054e-6), BOOST_MATH_BIG_CONSTANT(double, 64, 0.161809290887904476097e-8), BOOST_MATH_BIG_CONSTANT(double, 64, 0.231558608310259605225e-11), 0, 0, 0 },
+   };
+
+   //
+   // Normalise to p in [0,1] and q = 1 - p exactly as erf_inv and erfc_inv do, the
+   // sign of the result is restored at the end:
+   //
+   double q[tools::detail::batch_block_size];
+   double lq[tools::detail::batch_block_size];
+   for(std::size_t i = 0; i < n; ++i)
+      q[i] = invert ? ((z[i] > 1) ? 2 - z[i] : z[i]) : 1 - fabs(z[i]);
+   //
+   // log(q) is only needed outside the central region, and is a call into the
+   // C runtime whatever we do, so only make it for the lanes that need it:
+   //
+   for(std::size_t i = 0; i < n; ++i)
+      lq[i] = (q[i] < 0.5) ? log(q[i]) : 0;
+   for(std::size_t i = 0; i < n; ++i)
+   {
+      double p = invert ? 1 - q[i] : fabs(z[i]);
+      double sign = (invert ? (z[i] > 1) : (z[i] < 0)) ? -1 : 1;
+      double x = sqrt(-lq[i]);
+      std::size_t k = (p <= 0.5) ? 0 : (q[i] >= 0.25) ? 1 : 2 + (x >= 3) + (x >= 6) + (x >= 18) + (x >= 44);
+      double t = (k == 0) ? p : (k == 1) ? q[i] - offset[1] : x - offset[k];
+      double r = tools::detail::evaluate_polynomial_row(P, k, t) / tools::detail::evaluate_polynomial_row(Q, k, t);
+      double g = p * (p + 10);
+      double central = g * Y[0] + g * r;
+      double mid = sqrt(-2 * lq[i]) / (Y[1] + r);
+      double far = Y[k] * x + r * x;
+      result[i] = sign * ((k == 0) ? central : (k == 1) ? mid : far);
+   }
+}
+
+template <class T, class Policy>
+struct erf_batch_functor
+{
+   erf_batch_functor(bool inv, const Policy& p) : invert(inv), pol(p) {}
+   void operator()(const double* z, double* result, std::size_t n)const
+   {
+      erf_batch_kernel(z, result, n, invert);
+      for(std::size_t i = 0; i < n; ++i)
+      {
+         if((boost::math::isnan)(z[i]))
+            result[i] = static_cast<double>(invert ? boost::math::erfc(static_cast<T>(z[i]), pol) : boost::math::erf(static_cast<T>(z[i]), pol));
+      }
+   }
+   bool invert;
+   Policy pol;
+};
+
+template <class T, class Policy>
+struct erf_inv_batch_functor
+{
+   erf_inv_batch_functor(bool inv, const Policy& p) : invert(inv), pol(p) {}
+   void operator()(const double* z, double* result, std::size_t n)const
+   {
+      BOOST_MATH_STD_USING
+      erf_inv_batch_kernel(z, result, n, invert);
+      //
+      // Anything on or outside the boundary of the domain (including NaN's) gets
+      // the full error handling of the scalar version:
+      //
+      for(std::size_t i = 0; i < n; ++i)
+      {
+         if(invert ? !((z[i] > 0) && (z[i] < 2)) : !(fabs(z[i]) < 1))
+            result[i] = static_cast<double>(invert ? boost::math::erfc_inv(static_cast<T>(z[i]), pol) : boost::math::erf_inv(static_cast<T>(z[i]), pol));
+      }
+   }
+   bool invert;
+   Policy pol;
+};
+
+template <class InputIterator, class OutputIterator, class Policy>
+inline OutputIterator erf_batch_imp(InputIterator first, InputIterator last, OutputIterator out, bool invert, const Policy& pol, const boost::true_type&)
+{
+   typedef typename tools::promote_args<typename std::iterator_traits<InputIterator>::value_type>::type result_type;
+   return tools::detail::batch_transform<double>(first, last, out, erf_batch_functor<result_type, Policy>(invert, pol));
+}
+
+template <class InputIterator, class OutputIterator, class Policy>
+OutputIterator erf_batch_imp(InputIterator first, InputIterator last, OutputIterator out, bool invert, const Policy&, const boost::false_type&)
+{
+   typedef typename tools::promote_args<typename std::iterator_traits<InputIterator>::value_type>::type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::precision<result_type, Policy>::type precision_type;
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+
+   typedef boost::integral_constant<int,
+      precision_type::value <= 0 ? 0 :
+      precision_type::value <= 53 ? 53 :
+      precision_type::value <= 64 ? 64 :
+      precision_type::value <= 113 ? 113 : 0
+   > tag_type;
+
+   erf_initializer<value_type, forwarding_policy, tag_type>::force_instantiate();
+
+   for(; first != last; ++first, ++out)
+   {
+      *out = policies::checked_narrowing_cast<result_type, forwarding_policy>(
+         erf_imp(static_cast<value_type>(*first), invert, forwarding_policy(), tag_type()),
+         invert ? "boost::math::erfc<%1%>(%1%, %1%)" : "boost::math::erf<%1%>(%1%, %1%)");
+   }
+   return out;
+}
+
+template <class InputIterator, class OutputIterator, class Policy>
+inline OutputIterator erf_inv_batch_imp(InputIterator first, InputIterator last, OutputIterator out, bool invert, const Policy& pol, const boost::true_type&)
+{
+   typedef typename tools::promote_args<typename std::iterator_traits<InputIterator>::value_type>::type result_type;
+   return tools::detail::batch_transform<double>(first, last, out, erf_inv_batch_functor<result_type, Policy>(invert, pol));
+}
+
+template <class InputIterator, class OutputIterator, class Policy>
+OutputIterator erf_inv_batch_imp(InputIterator first, InputIterator last, OutputIterator out, bool invert, const Policy& pol, const boost::false_type&)
+{
+   for(; first != last; ++first, ++out)
+      *out = invert ? boost::math::erfc_inv(*first, pol) : boost::math::erf_inv(*first, pol);
+   return out;
+}
+
+template <class InputIterator>
+struct erf_batch_tag
+{
+   typedef typename tools::promote_args<typename std::iterator_traits<InputIterator>::value_type>::type result_type;
+   typedef boost::integral_constant<bool, erf_batch_use_kernel<result_type>::value> type;
+};
+
+} // namespace detail
+
+template <class InputIterator, class OutputIterator, class Policy>
+inline OutputIterator erf(InputIterator first, InputIterator last, OutputIterator result, const Policy& pol)
+{
+   return detail::erf_batch_imp(first, last, result, false, pol, typename detail::erf_batch_tag<InputIterator>::type());
+}
+
+template <class InputIterator, class OutputIterator>
+inline OutputIterator erf(InputIterator first, InputIterator last, OutputIterator result)
+{
+   return boost::math::erf(first, last, result, policies::policy<>());
+}
+
+template <class InputIterator, class OutputIterator, class Policy>
+inline OutputIterator erfc(InputIterator first, InputIterator last, OutputIterator result, const Policy& pol)
+{
+   return detail::erf_batch_imp(first, last, result, true, pol, typename detail::erf_batch_tag<InputIterator>::type());
+}
+
+template <class InputIterator, class OutputIterator>
+inline OutputIterator erfc(InputIterator first, InputIterator last, OutputIterator result)
+{
+   return boost::math::erfc(first, last, result, policies::policy<>());
+}
+
+template <class InputIterator, class OutputIterator, class Policy>
+inline OutputIterator erf_inv(InputIterator first, InputIterator last, OutputIterator result, const Policy& pol)
+{
+   return detail::erf_inv_batch_imp(first, last, result, false, pol, typename detail::erf_batch_tag<InputIterator>::type());
+}
+
+template <class InputIterator, class OutputIterator>
+inline OutputIterator erf_inv(InputIterator first, InputIterator last, OutputIterator result)
+{
+   return boost::math::erf_inv(first, last, result, policies::policy<>());
+}
+
+template <class InputIterator, class OutputIterator, class Policy>
+inline OutputIterator erfc_inv(InputIterator first, InputIterator last, OutputIterator result, const Policy& pol)
+{
+   return detail::erf_inv_batch_imp(first, last, result, true, pol, typename detail::erf_batch_tag<InputIterator>::type());
+}
+
+template <class InputIterator, class OutputIterator>
+inline OutputIterator erfc_inv(InputIterator first, InputIterator last, OutputIterator result)
+{
+   return boost::math::erfc_inv(first, last, result, policies::policy<>());
+}
+
+}} // namespaces
+
+#endif // BOOST_MATH_SF_ERF_BATCH_HPP
@@ -0,0 +1,505 @@
+//  Copyright 2020 Boost.Math contributors
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_SF_GAMMA_BATCH_HPP
+#define BOOST_MATH_SF_GAMMA_BATCH_HPP
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include <iterator>
+#include <limits>
+#include <boost/type_traits/remove_reference.hpp>
+#include <boost/math/tools/detail/batch.hpp>
+
+//
+// Array overloads of tgamma, lgamma and tgamma_ratio.
+//
+// For float and double arguments the Lanczos sums of lanczos13m53 are evaluated a
+// block at a time: the coefficients are the same for every lane, so unlike the
+// SSE2 specialisation in lanczos_sse2.hpp (which splits a single sum into odd and
+// even halves) each vector register holds 2, 4 or 8 different arguments and the
+// compiler is free to use whichever instruction set is enabled.  For lgamma the
+// small argument rational approximations of lgamma_small_imp are handled the
+// same way, with the argument reduction z -> z-1 done as a fixed length masked
+// product so that each lane needs at most one log.  The remaining scalar work is
+// pow/exp/log from the C runtime, and a fix-up pass which sends arguments that
+// need policy based error handling, or the reflection formula, through the
+// scalar functions.
+//
+// As with the erf overloads these always evaluate at double precision, ignoring
+// the promote_double policy.  Other types (including those which would use
+// lanczos24m113) simply loop over the scalar functions.
+//
+namespace boost{ namespace math{ namespace detail{
+
+template <class T>
+struct gamma_batch_use_kernel
+{
+   static const bool value = (boost::is_same<T, double>::value || boost::is_same<T, float>::value)
+      && std::numeric_limits<double>::is_iec559 && (std::numeric_limits<double>::digits == 53);
+};
+//
+// Evaluates lanczos13m53::lanczos_sum (expG_scaled false) or
+// lanczos13m53::lanczos_sum_expG_scaled (expG_scaled true) for z[0..n).
+//
+// As in tools::evaluate_rational, arguments greater than 1 are evaluated as
+// polynomials in 1/z, which is both more accurate and free from overflow: here
+// that is done by selecting a second row of each table holding the coefficients
+// in reverse order.
+//
+inline void lanczos13m53_sum_batch(const double* z, double* result, std::size_t n, bool expG_scaled)
+{
+   static const double lanczos_num[2][13] = {
+      {
+         static_cast<double>(23531376880.41075968857200767445163675473L),
+         static_cast<double>(42919803642.64909876895789904700198885093L),
+         static_cast<double>(35711959237.35566804944018545154716670596L),
+         static_cast<double>(17921034426.03720969991975575445893111267L),
+         static_cast<double>(6039542586.35202800506429164430729792107L),
+         static_cast<double>(1439720407.311721673663223072794912393972L),
+         static_cast<double>(248874557.8620541565114603864132294232163L),
+         static_cast<double>(31426415.58540019438061423162831820536287L),
+         static_cast<double>(2876370.628935372441225409051620849613599L),
+         static_cast<double>(186056.2653952234950402949897160456992822L),
+         static_cast<double>(8071.672002365816210638002902272250613822L),
+         static_cast<double>(210.8242777515793458725097339207133627117L),
+         static_cast<double>(2.506628274631000270164908177133837338626L)
+      },
+      {
+         static_cast<double>(2.506628274631000270164908177133837338626L),
+         static_cast<double>(210.8242777515793458725097339207133627117L),
+         static_cast<double>(8071.672002365816210638002902272250613822L),
+         static_cast<double>(186056.2653952234950402949897160456992822L),
+         static_cast<double>(2876370.628935372441225409051620849613599L),
+         static_cast<double>(31426415.58540019438061423162831820536287L),
+         static_cast<double>(248874557.8620541565114603864132294232163L),
+         static_cast<double>(1439720407.311721673663223072794912393972L),
+         static_cast<double>(6039542586.35202800506429164430729792107L),
+         static_cast<double>(17921034426.03720969991975575445893111267L),
+         static_cast<double>(35711959237.35566804944018545154716670596L),
+         static_cast<double>(42919803642.64909876895789904700198885093L),
+         static_cast<double>(23531376880.41075968857200767445163675473L)
+      }
+   };
+   static const double expG_scaled_num[2][13] = {
+      {
+         static_cast<double>(56906521.91347156388090791033559122686859L),
+         static_cast<double>(103794043.1163445451906271053616070238554L),
+         static_cast<double>(86363131.28813859145546927288977868422342L),
+         static_cast<double>(43338889.32467613834773723740590533316085L),
+         static_cast<double>(14605578.08768506808414169982791359218571L),
+         static_cast<double>(3481712.15498064590882071018964774556468L),
+         static_cast<double>(601859.6171681098786670226533699352302507L),
+         static_cast<double>(75999.29304014542649875303443598909137092L),
+         static_cast<double>(6955.999602515376140356310115515198987526L),
+         static_cast<double>(449.9445569063168119446858607650988409623L),
+         static_cast<double>(19.51992788247617482847860966235652136208L),
+         static_cast<double>(0.5098416655656676188125178644804694509993L),
+         static_cast<double>(0.006061842346248906525783753964555936883222L)
+      },
+      {
+         static_cast<double>(0.006061842346248906525783753964555936883222L),
+         static_cast<double>(0.5098416655656676188125178644804694509993L),
+         static_cast<double>(19.51992788247617482847860966235652136208L),
+         static_cast<double>(449.9445569063168119446858607650988409623L),
+         static_cast<double>(6955.999602515376140356310115515198987526L),
+         static_cast<double>(75999.29304014542649875303443598909137092L),
+         static_cast<double>(601859.6171681098786670226533699352302507L),
+         static_cast<double>(3481712.15498064590882071018964774556468L),
+         static_cast<double>(14605578.08768506808414169982791359218571L),
+         static_cast<double>(43338889.32467613834773723740590533316085L),
+         static_cast<double>(86363131.28813859145546927288977868422342L),
+         static_cast<double>(103794043.1163445451906271053616070238554L),
+         static_cast<double>(56906521.91347156388090791033559122686859L)
+      }
+   };
+   static const double denom[2][13] = {
+      {
+         static_cast<double>(0u),
+         static_cast<double>(39916800u),
+         static_cast<double>(120543840u),
+         static_cast<double>(150917976u),
+         static_cast<double>(105258076u),
+         static_cast<double>(45995730u),
+         static_cast<double>(13339535u),
+         static_cast<double>(2637558u),
+         static_cast<double>(357423u),
+         static_cast<double>(32670u),
+         static_cast<double>(1925u),
+         static_cast<double>(66u),
+         static_cast<double>(1u)
+      },
+      {
+         static_cast<double>(1u),
+         static_cast<double>(66u),
+         static_cast<double>(1925u),
+         static_cast<double>(32670u),
+         static_cast<double>(357423u),
+         static_cast<double>(2637558u),
+         static_cast<double>(13339535u),
+         static_cast<double>(45995730u),
+         static_cast<double>(105258076u),
+         static_cast<double>(150917976u),
+         static_cast<double>(120543840u),
+         static_cast<double>(39916800u),
+         static_cast<double>(0u)
+      }
+   };
+   const double (&num)[2][13] = expG_scaled ? expG_scaled_num : lanczos_num;
+   for(std::size_t i = 0; i < n; ++i)
+   {
+      std::size_t k = z[i] > 1;
+      double x = k ? 1 / z[i] : z[i];
+      result[i] = tools::detail::evaluate_polynomial_blend(num, k, x) / tools::detail::evaluate_polynomial_blend(denom, k, x);
+   }
+}
+//
+// tgamma(z) for 0 < z < max_factorial<double>::value, other lanes are left
+// with unspecified values.
+//
+inline void tgamma_batch_kernel(const double* z, double* result, std::size_t n)
+{
+   BOOST_MATH_STD_USING
+   const double g = lanczos::lanczos13m53::g();
+   lanczos13m53_sum_batch(z, result, n, false);
+   for(std::size_t i = 0; i < n; ++i)
+   {
+      double zgh = z[i] + g - 0.5;
+      if(z[i] > 140)
+      {
+         // z * log(zgh) is greater than log_max_value, so split the power term in two
+         // to avoid spurious overflow:
+         double hp = pow(zgh, z[i] / 2 - 0.25);
+         result[i] *= hp / exp(zgh);
+         result[i] *= hp;
+      }
+      else
+         result[i] *= pow(zgh, z[i] - 0.5) / exp(zgh);
+   }
+   //
+   // Small and integer arguments as per gamma_imp:
+   //
+   for(std::size_t i = 0; i < n; ++i)
+   {
+      if(z[i] < tools::root_epsilon<double>())
+         result[i] = 1 / z[i] - constants::euler<double>();
+      else if((floor(z[i]) == z[i]) && (z[i] < max_factorial<double>::value))
+         result[i] = unchecked_factorial<double>(static_cast<unsigned>(z[i]) - 1);
+   }
+}
+
+inline bool tgamma_batch_in_domain(double z)
+{
+   return (z >= tools::min_value<double>()) && (z < max_factorial<double>::value);
+}
+//
+// lgamma(z) for finite z > 0, other lanes are left with unspecified values.
+//
+inline void lgamma_batch_kernel(const double* z, double* result, std::size_t n)
+{
+   BOOST_MATH_STD_USING
+   //
+   // For z < 15 the rational approximations of the 64-bit lgamma_small_imp, with
+   // one row per interval: [1,1.5], (1.5,2) and [2,3).  The approximations take the
+   // form prefix * (Y + R(t)):
+   //
+   static const double Y[3] = { 0.52815341949462890625, 0.452017307281494140625, 0.158963680267333984375 };
+   static const double P[3][7] = {
+      {
+         static_cast<double>(0.490622454069039543534e-1L),
+         static_cast<double>(-0.969117530159521214579e-1L),
+         static_cast<double>(-0.414983358359495381969e0L),
+         static_cast<double>(-0.406567124211938417342e0L),
+         static_cast<double>(-0.158413586390692192217e0L),
+         static_cast<double>(-0.240149820648571559892e-1L),
+         static_cast<double>(-0.100346687696279557415e-2L)
+      },
+      {
+         static_cast<double>(-0.292329721830270012337e-1L),
+         static_cast<double>(0.144216267757192309184e0L),
+         static_cast<double>(-0.142440390738631274135e0L),
+         static_cast<double>(0.542809694055053558157e-1L),
+         static_cast<double>(-0.850535976868336437746e-2L),
+         static_cast<double>(0.431171342679297331241e-3L),
+         0
+      },
+      {
+         static_cast<double>(-0.180355685678449379109e-1L),
+         static_cast<double>(0.25126649619989678683e-1L),
+         static_cast<double>(0.494103151567532234274e-1L),
+         static_cast<double>(0.172491608709613993966e-1L),
+         static_cast<double>(-0.259453563205438108893e-3L),
+         static_cast<double>(-0.541009869215204396339e-3L),
+         static_cast<double>(-0.324588649825948492091e-4L)
+      }
+   };
+   static const double Q[3][8] = {
+      {
+         static_cast<double>(0.1e1L),
+         static_cast<double>(0.302349829846463038743e1L),
+         static_cast<double>(0.348739585360723852576e1L),
+         static_cast<double>(0.191415588274426679201e1L),
+         static_cast<double>(0.507137738614363510846e0L),
+         static_cast<double>(0.577039722690451849648e-1L),
+         static_cast<double>(0.195768102601107189171e-2L),
+         0
+      },
+      {
+         static_cast<double>(0.1e1L),
+         static_cast<double>(-0.150169356054485044494e1L),
+         static_cast<double>(0.846973248876495016101e0L),
+         static_cast<double>(-0.220095151814995745555e0L),
+         static_cast<double>(0.25582797155975869989e-1L),
+         static_cast<double>(-0.100666795539143372762e-2L),
+         static_cast<double>(-0.827193521891290553639e-6L),
+         0
+      },
+      {
+         static_cast<double>(0.1e1L),
+         static_cast<double>(0.196202987197795200688e1L),
+         static_cast<double>(0.148019669424231326694e1L),
+         static_cast<double>(0.541391432071720958364e0L),
+         static_cast<double>(0.988504251128010129477e-1L),
+         static_cast<double>(0.82130967464889339326e-2L),
+         static_cast<double>(0.224936291922115757597e-3L),
+         static_cast<double>(-0.223352763208617092964e-6L)
+      }
+   };
+   const double g = lanczos::lanczos13m53::g();
+   double prod[tools::detail::batch_block_size];
+   double sum[tools::detail::batch_block_size];
+   //
+   // Blocks of all large, or all small, arguments (the common case with sorted
+   // or clustered data) only need one of the two approximations:
+   //
+   bool any_small = false;
+   bool any_large = false;
+   for(std::size_t i = 0; i < n; ++i)
+   {
+      any_small |= z[i] < 15;
+      any_large |= z[i] >= 15;
+   }
+   if(any_large)
+      lanczos13m53_sum_batch(z, sum, n, true);
+   if(any_small)
+   {
+      for(std::size_t i = 0; i < n; ++i)
+      {
+         //
+         // Argument reduction into [2,3) for 3 <= z < 15, keeping the product of
+         // the factors removed rather than summing their logs:
+         //
+         double w = z[i];
+         double p = 1;
+         for(unsigned j = 0; j < 12; ++j)
+         {
+            bool c = w >= 3;
+            w = c ? w - 1 : w;
+            p *= c ? w : 1;
+         }
+         prod[i] = p;
+         //
+         // z < 1 shifts up to [1,2) instead, keeping z-1 and z-2 exact:
+         //
+         bool shift = z[i] < 1;
+         double zm1 = shift ? z[i] : w - 1;
+         double zm2 = shift ? z[i] - 1 : w - 2;
+         w = shift ? z[i] + 1 : w;
+         std::size_t k = (w > 1.5) + (w >= 2);
+         double t = k == 0 ? zm1 : k == 1 ? -zm2 : zm2;
+         double prefix = k == 2 ? zm2 * (w + 1) : zm1 * zm2;
+         double R = tools::detail::evaluate_polynomial_blend(P, k, t) / tools::detail::evaluate_polynomial_blend(Q, k, t);
+         result[i] = prefix * Y[k] + prefix * R;
+      }
+   }
+   for(std::size_t i = 0; i < n; ++i)
+   {
+      if(z[i] < 1)
+         result[i] -= log(z[i]);
+      else if(z[i] >= 15)
+      {
+         double zgh = z[i] + g - 0.5;
+         result[i] = (log(zgh) - 1) * (z[i] - 0.5) + log(sum[i]);
+      }
+      else if(z[i] >= 3)
+         result[i] += log(prod[i]);
+   }
+}
+
+inline bool lgamma_batch_in_domain(double z)
+{
+   return (z > 0) && (z <= tools::max_value<double>());
+}
+//
+// True if r is a normalised, finite value of type T:
+//
+template <class T>
+inline bool gamma_batch_result_in_range(double r)
+{
+   BOOST_MATH_STD_USING
+   return (fabs(r) >= tools::min_value<T>()) && (fabs(r) <= tools::max_value<T>());
+}
+
+template <class T, class Policy>
+struct tgamma_batch_functor
+{
+   tgamma_batch_functor(const Policy& p) : pol(p) {}
+   void operator()(const double* z, double* result, std::size_t n)const
+   {
+      tgamma_batch_kernel(z, result, n);
+      for(std::size_t i = 0; i < n; ++i)
+      {
+         if(!tgamma_batch_in_domain(z[i]) || !gamma_batch_result_in_range<T>(result[i]))
+            result[i] = static_cast<double>(boost::math::tgamma(static_cast<T>(z[i]), pol));
+      }
+   }
+   Policy pol;
+};
+
+template <class T, class Policy>
+struct lgamma_batch_functor
+{
+   lgamma_batch_functor(const Policy& p) : pol(p) {}
+   void operator()(const double* z, double* result, std::size_t n)const
+   {
+      lgamma_batch_kernel(z, result, n);
+      for(std::size_t i = 0; i < n; ++i)
+      {
+         if(!lgamma_batch_in_domain(z[i]))
+            result[i] = static_cast<double>(boost::math::lgamma(static_cast<T>(z[i]), pol));
+      }
+   }
+   Policy pol;
+};
+
+template <class T, class Policy>
+struct tgamma_ratio_batch_functor
+{
+   tgamma_ratio_batch_functor(const Policy& p) : pol(p) {}
+   void operator()(const double* a, const double* b, double* result, std::size_t n)const
+   {
+      double denom[tools::detail::batch_block_size];
+      tgamma_batch_kernel(a, result, n);
+      tgamma_batch_kernel(b, denom, n);
+      for(std::size_t i = 0; i < n; ++i)
+         result[i] /= denom[i];
+      //
+      // Arguments beyond the factorial table need the more careful treatment
+      // in tgamma_ratio_imp:
+      //
+      for(std::size_t i = 0; i < n; ++i)
+      {
+         if(!tgamma_batch_in_domain(a[i]) || !tgamma_batch_in_domain(b[i]) || !gamma_batch_result_in_range<T>(result[i]))
+            result[i] = static_cast<double>(boost::math::tgamma_ratio(static_cast<T>(a[i]), static_cast<T>(b[i]), pol));
+      }
+   }
+   Policy pol;
+};
+
+template <class InputIterator, class OutputIterator, class Policy>
+inline OutputIterator tgamma_batch_imp(InputIterator first, InputIterator last, OutputIterator out, const Policy& pol, const boost::true_type&)
+{
+   typedef typename tools::promote_args<typename std::iterator_traits<InputIterator>::value_type>::type result_type;
+   return tools::detail::batch_transform<double>(first, last, out, tgamma_batch_functor<result_type, Policy>(pol));
+}
+
+template <class InputIterator, class OutputIterator, class Policy>
+OutputIterator tgamma_batch_imp(InputIterator first, InputIterator last, OutputIterator out, const Policy& pol, const boost::false_type&)
+{
+   for(; first != last; ++first, ++out)
+      *out = boost::math::tgamma(*first, pol);
+   return out;
+}
+
+template <class InputIterator, class OutputIterator, class Policy>
+inline OutputIterator lgamma_batch_imp(InputIterator first, InputIterator last, OutputIterator out, const Policy& pol, const boost::true_type&)
+{
+   typedef typename tools::promote_args<typename std::iterator_traits<InputIterator>::value_type>::type result_type;
+   return tools::detail::batch_transform<double>(first, last, out, lgamma_batch_functor<result_type, Policy>(pol));
+}
+
+template <class InputIterator, class OutputIterator, class Policy>
+OutputIterator lgamma_batch_imp(InputIterator first, InputIterator last, OutputIterator out, const Policy& pol, const boost::false_type&)
+{
+   for(; first != last; ++first, ++out)
+      *out = boost::math::lgamma(*first, pol);
+   return out;
+}
+
+template <class InputIterator1, class InputIterator2, class OutputIterator, class Policy>
+inline OutputIterator tgamma_ratio_batch_imp(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, OutputIterator out, const Policy& pol, const boost::true_type&)
+{
+   typedef typename tools::promote_args<
+      typename std::iterator_traits<InputIterator1>::value_type,
+      typename std::iterator_traits<InputIterator2>::value_type>::type result_type;
+   return tools::detail::batch_transform<double>(first1, last1, first2, out, tgamma_ratio_batch_functor<result_type, Policy>(pol));
+}
+
+template <class InputIterator1, class InputIterator2, class OutputIterator, class Policy>
+OutputIterator tgamma_ratio_batch_imp(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, OutputIterator out, const Policy& pol, const boost::false_type&)
+{
+   for(; first1 != last1; ++first1, ++first2, ++out)
+      *out = boost::math::tgamma_ratio(*first1, *first2, pol);
+   return out;
+}
+
+template <class InputIterator1, class InputIterator2 = InputIterator1>
+struct gamma_batch_tag
+{
+   typedef typename tools::promote_args<
+      typename std::iterator_traits<InputIterator1>::value_type,
+      typename std::iterator_traits<InputIterator2>::value_type>::type result_type;
+   typedef boost::integral_constant<bool, gamma_batch_use_kernel<result_type>::value> type;
+};
+
+} // namespace detail
+
+template <class InputIterator, class OutputIterator, class Policy>
+inline OutputIterator tgamma(InputIterator first, InputIterator last, OutputIterator result, const Policy& pol)
+{
+   return detail::tgamma_batch_imp(first, last, result, pol, typename detail::gamma_batch_tag<InputIterator>::type());
+}
+//
+// Disabled when the third argument is a policy, so as not to hijack calls to
+// the upper incomplete gamma function tgamma(a, z, pol) when a and z have the
+// same type.  The reference is removed because an explicit instantiation of
+// tgamma(a, z, const Policy&) deduces OutputIterator as a reference type:
+//
+template <class InputIterator, class OutputIterator>
+inline typename boost::enable_if_c<!policies::is_policy<typename boost::remove_reference<OutputIterator>::type>::value, OutputIterator>::type
+   tgamma(InputIterator first, InputIterator last, OutputIterator result)
+{
+   return boost::math::tgamma(first, last, result, policies::policy<>());
+}
+
+template <class InputIterator, class OutputIterator, class Policy>
+inline OutputIterator lgamma(InputIterator first, InputIterator last, OutputIterator result, const Policy& pol)
+{
+   return detail::lgamma_batch_imp(first, last, result, pol, typename detail::gamma_batch_tag<InputIterator>::type());
+}
+
+template <class InputIterator, class OutputIterator>
+inline OutputIterator lgamma(InputIterator first, InputIterator last, OutputIterator result)
+{
+   return boost::math::lgamma(first, last, result, policies::policy<>());
+}
+
+template <class InputIterator1, class InputIterator2, class OutputIterator, class Policy>
+inline OutputIterator tgamma_ratio(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, OutputIterator result, const Policy& pol)
+{
+   return detail::tgamma_ratio_batch_imp(first1, last1, first2, result, pol, typename detail::gamma_batch_tag<InputIterator1, InputIterator2>::type());
+}
+
+template <class InputIterator1, class InputIterator2, class OutputIterator>
+inline OutputIterator tgamma_ratio(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, OutputIterator result)
+{
+   return boost::math::tgamma_ratio(first1, last1, first2, result, policies::policy<>());
+}
+
+}} // namespaces
+
+#endif // BOOST_MATH_SF_GAMMA_BATCH_HPP
@@ -0,0 +1,93 @@
+//  Copyright 2020 Boost.Math contributors
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_SF_IBETA_EVALUATOR_HPP
+#define BOOST_MATH_SF_IBETA_EVALUATOR_HPP
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+//
+// ibeta_evaluator: the regularised incomplete beta function for fixed a and b
+// at many different x.
+//
+// Everything in ibeta_imp which depends only upon a and b - the ratio of Lanczos
+// sums and the leftover power terms in ibeta_power_terms and ibeta_series, and
+// the gamma function ratio in beta_small_b_large_a_series - is kept in an
+// ibeta_term_cache after the first time it is needed, so subsequent x values
+// only pay for the x dependent parts.  Results are bit for bit the same as
+// ibeta and ibetac.
+//
+namespace boost{ namespace math{
+
+template <class RealType = double, class Policy = policies::policy<> >
+class ibeta_evaluator
+{
+   typedef typename policies::evaluation<RealType, Policy>::type eval_type;
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+public:
+   typedef RealType value_type;
+   typedef Policy policy_type;
+
+   ibeta_evaluator(RealType a, RealType b) : m_a(a), m_b(b)
+   {
+      static const char* function = "boost::math::ibeta_evaluator<%1%>::ibeta_evaluator(%1%,%1%)";
+      if(a < 0)
+         policies::raise_domain_error<RealType>(function, "The argument a to the incomplete beta function must be >= zero (got a=%1%).", a, Policy());
+      if(b < 0)
+         policies::raise_domain_error<RealType>(function, "The argument b to the incomplete beta function must be >= zero (got b=%1%).", b, Policy());
+      if((a == 0) && (b == 0))
+         policies::raise_domain_error<RealType>(function, "The arguments a and b to the incomplete beta function cannot both be zero (got a=%1%).", a, Policy());
+   }
+
+   RealType a()const { return m_a; }
+   RealType b()const { return m_b; }
+
+   RealType ibeta(RealType x)
+   {
+      return evaluate(x, false, "boost::math::ibeta<%1%>(%1%,%1%,%1%)");
+   }
+   RealType ibetac(RealType x)
+   {
+      return evaluate(x, true, "boost::math::ibetac<%1%>(%1%,%1%,%1%)");
+   }
+
+   template <class InputIterator, class OutputIterator>
+   OutputIterator ibeta(InputIterator first, InputIterator last, OutputIterator result)
+   {
+      for(; first != last; ++first, ++result)
+         *result = this->ibeta(static_cast<RealType>(*first));
+      return result;
+   }
+   template <class InputIterator, class OutputIterator>
+   OutputIterator ibetac(InputIterator first, InputIterator last, OutputIterator result)
+   {
+      for(; first != last; ++first, ++result)
+         *result = this->ibetac(static_cast<RealType>(*first));
+      return result;
+   }
+
+private:
+   RealType evaluate(RealType x, bool invert, const char* function)
+   {
+      BOOST_FPU_EXCEPTION_GUARD
+      return policies::checked_narrowing_cast<RealType, forwarding_policy>(
+         detail::ibeta_imp(static_cast<eval_type>(m_a), static_cast<eval_type>(m_b), static_cast<eval_type>(x),
+            forwarding_policy(), invert, true, static_cast<eval_type*>(0), &m_cache), function);
+   }
+
+   RealType m_a, m_b;
+   detail::ibeta_term_cache<eval_type> m_cache;
+};
+
+}} // namespaces
+
+#endif // BOOST_MATH_SF_IBETA_EVALUATOR_HPP
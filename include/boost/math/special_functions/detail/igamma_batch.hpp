@@ -0,0 +1,386 @@
+//  Copyright 2020 Boost.Math contributors
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_SF_IGAMMA_BATCH_HPP
+#define BOOST_MATH_SF_IGAMMA_BATCH_HPP
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include <iterator>
+#include <limits>
+#include <boost/math/tools/detail/batch.hpp>
+
+//
+// Array overloads of gamma_p and gamma_q, either with both a and x varying, or
+// with a fixed a and a range of x.
+//
+// For float and double arguments each block is split by method: lanes with
+// x < max(a, 1.1) are summed with the series for P (method 2 of
+// gamma_incomplete_imp), and the rest with the continued fraction for Q (method
+// 4).  Each group is packed into contiguous arrays and iterated in fixed
+// length chunks until every lane has converged (extra terms past convergence
+// are harmless), so the inner loops have no branches and are vectorised.
+//
+// The prefix x^a e^-x / tgamma(a) uses the batched Lanczos sums from
+// gamma_batch.hpp, with the rounding errors in a + g - 0.5, x / (a + g - 0.5)
+// and a - x corrected for so that the error does not grow with a.
+//
+// Lanes not covered by those two methods - a > 150 (where gamma_incomplete_imp
+// uses log1pmx or Temme's method), a or x out of range, results which underflow,
+// and complements which would suffer from cancellation - are sent through the
+// scalar functions so that their accuracy and error handling are unchanged.
+// As with the other batch overloads, the arithmetic is done in double
+// regardless of the promote_double policy.
+//
+namespace boost{ namespace math{ namespace detail{
+//
+// Dekker's splitting of a double into two halves whose products are exact, used
+// to find the rounding error in a product when there is no fast fma (and hence
+// no risk of the compiler contracting the expressions involved into fma's):
+//
+inline void igamma_batch_split(double v, double& hi, double& lo)
+{
+   double t = 134217729.0 * v;
+   hi = t - (t - v);
+   lo = v - hi;
+}
+//
+// Computes P(a, x) (invert false) or Q(a, x) (invert true) for each lane, and
+// sets use_scalar[i] for the lanes whose result must be computed by the scalar
+// function instead.  min_result is the smallest result that may be returned
+// from the kernel.
+//
+inline void igamma_batch_kernel(const double* a, const double* x, double* result, bool* use_scalar, std::size_t n, bool invert, double min_result)
+{
+   BOOST_MATH_STD_USING
+   const std::size_t block = tools::detail::batch_block_size;
+   const double g = lanczos::lanczos13m53::g();
+   const double eps = std::numeric_limits<double>::epsilon();
+   const unsigned max_iterations = 1000;
+   //
+   // Chunk of iterations between convergence tests:
+   //
+   const unsigned chunk = 8;
+
+   double prefix[block];
+   double lsum[block];
+   bool any_small_a = false;
+   for(std::size_t i = 0; i < n; ++i)
+   {
+      use_scalar[i] = !((a[i] >= tools::min_value<double>()) && (a[i] <= 150) && (x[i] > 0) && (x[i] <= tools::max_value<double>()));
+      any_small_a |= a[i] < 1;
+   }
+   //
+   // The prefix x^a e^-x / tgamma(a), as in regularised_gamma_prefix:
+   //
+   lanczos13m53_sum_batch(a, lsum, n, true);
+   for(std::size_t i = 0; i < n; ++i)
+   {
+      //
+      // agh = a + g - 0.5 and its rounding error:
+      //
+      double c = g - 0.5;
+      double agh = a[i] + c;
+      double bv = agh - a[i];
+      double agh_lo = (a[i] - (agh - bv)) + (c - bv);
+      //
+      // q = x / agh and the residual of the division, with q * agh computed exactly:
+      //
+      double q = x[i] / agh;
+#ifdef FP_FAST_FMA
+      double r = fma(-q, agh, x[i]);
+#else
+      double qh, ql, ah, al;
+      igamma_batch_split(q, qh, ql);
+      igamma_batch_split(agh, ah, al);
+      double qa = q * agh;
+      double r = (x[i] - qa) - (((qh * ah - qa) + qh * al + ql * ah) + ql * al);
+#endif
+      //
+      // amz = a - x and its rounding error:
+      //
+      double amz = a[i] - x[i];
+      double dv = amz - a[i];
+      double amz_lo = (a[i] - (amz - dv)) - (x[i] + dv);
+      double alz = a[i] * log(q);
+      bool in_range = ((alz > tools::log_min_value<double>()) && (alz < tools::log_max_value<double>())
+         && (amz > tools::log_min_value<double>()) && (amz < tools::log_max_value<double>()));
+      use_scalar[i] = use_scalar[i] || (!in_range && (a[i] >= 1));
+      double correction = 1 + a[i] * (r / x[i] - agh_lo / agh) + amz_lo;
+      prefix[i] = pow(q, a[i]) * exp(amz) * correction * sqrt(agh / constants::e<double>()) / lsum[i];
+   }
+   if(any_small_a)
+   {
+      //
+      // a < 1 uses the direct form, which can not overflow as tgamma(a) < 1/a:
+      //
+      double tg[block];
+      tgamma_batch_kernel(a, tg, n);
+      for(std::size_t i = 0; i < n; ++i)
+      {
+         if(a[i] < 1)
+            prefix[i] = pow(x[i], a[i]) * exp(-x[i]) / tg[i];
+      }
+   }
+   //
+   // Group the lanes by method:
+   //
+   std::size_t series_index[block];
+   std::size_t fraction_index[block];
+   std::size_t n_series = 0;
+   std::size_t n_fraction = 0;
+   for(std::size_t i = 0; i < n; ++i)
+   {
+      if(use_scalar[i])
+         continue;
+      if(x[i] < (std::max)(a[i], 1.1))
+         series_index[n_series++] = i;
+      else
+         fraction_index[n_fraction++] = i;
+   }
+   double va[block];
+   double vx[block];
+   double term[block];
+   double sum[block];
+   double last[block];
+   if(n_series)
+   {
+      //
+      // P(a, x) = prefix / a * sum x^k / ((a+1)(a+2)...(a+k)):
+      //
+      for(std::size_t j = 0; j < n_series; ++j)
+      {
+         va[j] = a[series_index[j]];
+         vx[j] = x[series_index[j]];
+         term[j] = 1;
+         sum[j] = 1;
+      }
+      bool converged = false;
+      for(unsigned k = 0; !converged && (k < max_iterations); k += chunk)
+      {
+         for(unsigned m = 0; m < chunk; ++m)
+         {
+            for(std::size_t j = 0; j < n_series; ++j)
+            {
+               va[j] += 1;
+               term[j] *= vx[j] / va[j];
+               sum[j] += term[j];
+            }
+         }
+         converged = true;
+         for(std::size_t j = 0; j < n_series; ++j)
+            converged &= term[j] <= eps * sum[j];
+      }
+      for(std::size_t j = 0; j < n_series; ++j)
+      {
+         std::size_t i = series_index[j];
+         double p = prefix[i] * sum[j] / a[i];
+         result[i] = invert ? 1 - p : p;
+         // The complement of a P close to 1 loses too many digits:
+         use_scalar[i] = !(term[j] <= eps * sum[j]) || (invert && (p > 0.75));
+      }
+   }
+   if(n_fraction)
+   {
+      //
+      // Q(a, x) = prefix / (b0 + a1 / (b1 + a2 / (b2 + ...))) with b0 = x - a + 1,
+      // ak = k(a - k) and bk = b0 + 2k.  As in upper_gamma_fraction the tail from b1
+      // on is evaluated first with the modified Lentz algorithm, and b0 + a1 / tail
+      // formed at the end, which is considerably more accurate than including b0
+      // in the product when there are many terms:
+      //
+      const double tiny = 16 * tools::min_value<double>();
+      double C[block];
+      double D[block];
+      double b[block];
+      for(std::size_t j = 0; j < n_fraction; ++j)
+      {
+         va[j] = a[fraction_index[j]];
+         // b1 >= 3 as x >= a here:
+         b[j] = x[fraction_index[j]] - va[j] + 3;
+         sum[j] = b[j];
+         C[j] = b[j];
+         D[j] = 0;
+      }
+      bool converged = false;
+      for(unsigned k = 1; !converged && (k < max_iterations); k += chunk)
+      {
+         for(unsigned m = 1; m <= chunk; ++m)
+         {
+            double kk = k + m;
+            for(std::size_t j = 0; j < n_fraction; ++j)
+            {
+               double ak = kk * (va[j] - kk);
+               b[j] += 2;
+               double d = b[j] + ak * D[j];
+               d = d == 0 ? tiny : d;
+               double cc = b[j] + ak / C[j];
+               cc = cc == 0 ? tiny : cc;
+               D[j] = 1 / d;
+               C[j] = cc;
+               last[j] = cc * D[j];
+               sum[j] *= last[j];
+            }
+         }
+         converged = true;
+         for(std::size_t j = 0; j < n_fraction; ++j)
+            converged &= fabs(last[j] - 1) <= eps;
+      }
+      for(std::size_t j = 0; j < n_fraction; ++j)
+      {
+         std::size_t i = fraction_index[j];
+         double q = prefix[i] / ((x[i] - a[i] + 1) + (a[i] - 1) / sum[j]);
+         result[i] = invert ? q : 1 - q;
+         use_scalar[i] = !(fabs(last[j] - 1) <= eps) || (!invert && (q > 0.75));
+      }
+   }
+   for(std::size_t i = 0; i < n; ++i)
+      use_scalar[i] = use_scalar[i] || !(result[i] >= min_result);
+}
+
+template <class T, class Policy>
+struct igamma_batch_functor
+{
+   igamma_batch_functor(bool inv, const Policy& p) : invert(inv), pol(p) {}
+   void operator()(const double* a, const double* x, double* result, std::size_t n)const
+   {
+      bool use_scalar[tools::detail::batch_block_size];
+      igamma_batch_kernel(a, x, result, use_scalar, n, invert, tools::min_value<T>());
+      for(std::size_t i = 0; i < n; ++i)
+      {
+         if(use_scalar[i])
+            result[i] = static_cast<double>(invert
+               ? boost::math::gamma_q(static_cast<T>(a[i]), static_cast<T>(x[i]), pol)
+               : boost::math::gamma_p(static_cast<T>(a[i]), static_cast<T>(x[i]), pol));
+      }
+   }
+   bool invert;
+   Policy pol;
+};
+//
+// As above for a fixed value of a:
+//
+template <class T, class Policy>
+struct igamma_fixed_a_batch_functor
+{
+   igamma_fixed_a_batch_functor(double a, bool inv, const Policy& p) : f(inv, p)
+   {
+      for(std::size_t i = 0; i < tools::detail::batch_block_size; ++i)
+         a_block[i] = a;
+   }
+   void operator()(const double* x, double* result, std::size_t n)const
+   {
+      f(a_block, x, result, n);
+   }
+   igamma_batch_functor<T, Policy> f;
+   double a_block[tools::detail::batch_block_size];
+};
+
+template <class InputIterator1, class InputIterator2, class OutputIterator, class Policy>
+inline OutputIterator igamma_batch_imp(InputIterator1 first_a, InputIterator1 last_a, InputIterator2 first_x, OutputIterator out, bool invert, const Policy& pol, const boost::true_type&)
+{
+   typedef typename tools::promote_args<
+      typename std::iterator_traits<InputIterator1>::value_type,
+      typename std::iterator_traits<InputIterator2>::value_type>::type result_type;
+   return tools::detail::batch_transform<double>(first_a, last_a, first_x, out, igamma_batch_functor<result_type, Policy>(invert, pol));
+}
+
+template <class InputIterator1, class InputIterator2, class OutputIterator, class Policy>
+OutputIterator igamma_batch_imp(InputIterator1 first_a, InputIterator1 last_a, InputIterator2 first_x, OutputIterator out, bool invert, const Policy& pol, const boost::false_type&)
+{
+   for(; first_a != last_a; ++first_a, ++first_x, ++out)
+      *out = invert ? boost::math::gamma_q(*first_a, *first_x, pol) : boost::math::gamma_p(*first_a, *first_x, pol);
+   return out;
+}
+
+template <class RealType, class InputIterator, class OutputIterator, class Policy>
+inline OutputIterator igamma_fixed_a_batch_imp(RealType a, InputIterator first, InputIterator last, OutputIterator out, bool invert, const Policy& pol, const boost::true_type&)
+{
+   typedef typename tools::promote_args<RealType, typename std::iterator_traits<InputIterator>::value_type>::type result_type;
+   return tools::detail::batch_transform<double>(first, last, out, igamma_fixed_a_batch_functor<result_type, Policy>(static_cast<double>(a), invert, pol));
+}
+
+template <class RealType, class InputIterator, class OutputIterator, class Policy>
+OutputIterator igamma_fixed_a_batch_imp(RealType a, InputIterator first, InputIterator last, OutputIterator out, bool invert, const Policy& pol, const boost::false_type&)
+{
+   for(; first != last; ++first, ++out)
+      *out = invert ? boost::math::gamma_q(a, *first, pol) : boost::math::gamma_p(a, *first, pol);
+   return out;
+}
+
+template <class RealType, class InputIterator>
+struct igamma_fixed_a_batch_tag
+{
+   typedef typename tools::promote_args<RealType, typename std::iterator_traits<InputIterator>::value_type>::type result_type;
+   typedef boost::integral_constant<bool, gamma_batch_use_kernel<result_type>::value> type;
+};
+
+} // namespace detail
+//
+// The overloads taking a range of a are only enabled when the first argument is
+// not a number, and those taking a single a only when it is, since both take
+// four or five arguments:
+//
+template <class InputIterator1, class InputIterator2, class OutputIterator, class Policy>
+inline typename boost::disable_if_c<std::numeric_limits<InputIterator1>::is_specialized, OutputIterator>::type
+   gamma_p(InputIterator1 first_a, InputIterator1 last_a, InputIterator2 first_x, OutputIterator result, const Policy& pol)
+{
+   return detail::igamma_batch_imp(first_a, last_a, first_x, result, false, pol, typename detail::gamma_batch_tag<InputIterator1, InputIterator2>::type());
+}
+
+template <class InputIterator1, class InputIterator2, class OutputIterator>
+inline typename boost::disable_if_c<std::numeric_limits<InputIterator1>::is_specialized, OutputIterator>::type
+   gamma_p(InputIterator1 first_a, InputIterator1 last_a, InputIterator2 first_x, OutputIterator result)
+{
+   return boost::math::gamma_p(first_a, last_a, first_x, result, policies::policy<>());
+}
+
+template <class RealType, class InputIterator, class OutputIterator, class Policy>
+inline typename boost::enable_if_c<std::numeric_limits<RealType>::is_specialized, OutputIterator>::type
+   gamma_p(RealType a, InputIterator first_x, InputIterator last_x, OutputIterator result, const Policy& pol)
+{
+   return detail::igamma_fixed_a_batch_imp(a, first_x, last_x, result, false, pol, typename detail::igamma_fixed_a_batch_tag<RealType, InputIterator>::type());
+}
+
+template <class RealType, class InputIterator, class OutputIterator>
+inline typename boost::enable_if_c<std::numeric_limits<RealType>::is_specialized, OutputIterator>::type
+   gamma_p(RealType a, InputIterator first_x, InputIterator last_x, OutputIterator result)
+{
+   return boost::math::gamma_p(a, first_x, last_x, result, policies::policy<>());
+}
+
+template <class InputIterator1, class InputIterator2, class OutputIterator, class Policy>
+inline typename boost::disable_if_c<std::numeric_limits<InputIterator1>::is_specialized, OutputIterator>::type
+   gamma_q(InputIterator1 first_a, InputIterator1 last_a, InputIterator2 first_x, OutputIterator result, const Policy& pol)
+{
+   return detail::igamma_batch_imp(first_a, last_a, first_x, result, true, pol, typename detail::gamma_batch_tag<InputIterator1, InputIterator2>::type());
+}
+
+template <class InputIterator1, class InputIterator2, class OutputIterator>
+inline typename boost::disable_if_c<std::numeric_limits<InputIterator1>::is_specialized, OutputIterator>::type
+   gamma_q(InputIterator1 first_a, InputIterator1 last_a, InputIterator2 first_x, OutputIterator result)
+{
+   return boost::math::gamma_q(first_a, last_a, first_x, result, policies::policy<>());
+}
+
+template <class RealType, class InputIterator, class OutputIterator, class Policy>
+inline typename boost::enable_if_c<std::numeric_limits<RealType>::is_specialized, OutputIterator>::type
+   gamma_q(RealType a, InputIterator first_x, InputIterator last_x, OutputIterator result, const Policy& pol)
+{
+   return detail::igamma_fixed_a_batch_imp(a, first_x, last_x, result, true, pol, typename detail::igamma_fixed_a_batch_tag<RealType, InputIterator>::type());
+}
+
+template <class RealType, class InputIterator, class OutputIterator>
+inline typename boost::enable_if_c<std::numeric_limits<RealType>::is_specialized, OutputIterator>::type
+   gamma_q(RealType a, InputIterator first_x, InputIterator last_x, OutputIterator result)
+{
+   return boost::math::gamma_q(a, first_x, last_x, result, policies::policy<>());
+}
+
+}} // namespaces
+
+#endif // BOOST_MATH_SF_IGAMMA_BATCH_HPP
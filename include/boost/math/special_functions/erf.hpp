@@ -1261,6 +1261,7 @@ inline typename tools::promote_args<T>::type erfc(T z)
 } // namespace boost
 
 #include <boost/math/special_functions/detail/erf_inv.hpp>
+#include <boost/math/special_functions/detail/erf_batch.hpp>
 
 #endif // BOOST_MATH_SPECIAL_ERF_HPP
 
@@ -2170,5 +2170,7 @@ inline typename tools::promote_args<T1, T2>::type
 #include <boost/math/special_functions/detail/igamma_inverse.hpp>
 #include <boost/math/special_functions/detail/gamma_inva.hpp>
 #include <boost/math/special_functions/erf.hpp>
+#include <boost/math/special_functions/detail/gamma_batch.hpp>
+#include <boost/math/special_functions/detail/igamma_batch.hpp>
 
 #endif // BOOST_MATH_SF_GAMMA_HPP
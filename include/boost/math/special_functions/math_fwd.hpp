@@ -1157,6 +1157,10 @@ namespace boost
    OutputIterator tangent_t2n(const int start_index,
                                        const unsigned number_of_bernoullis_b2n,
                                        OutputIterator out_it);
+   template <class T, class Policy>
+   std::size_t reserve_bernoulli_b2n(const std::size_t n, const Policy& pol);
+   template <class T>
+   std::size_t reserve_bernoulli_b2n(const std::size_t n);
 
    // Lambert W:
    template <class T, class Policy>
@@ -1806,6 +1810,9 @@ template <class OutputIterator, class T>\
    template <class T, class OutputIterator>\
    OutputIterator tangent_t2n(int start_index, unsigned number_of_bernoullis_b2n, OutputIterator out_it)\
    { return boost::math::tangent_t2n<T>(start_index, number_of_bernoullis_b2n, out_it, Policy()); }\
+   template <class T>\
+   std::size_t reserve_bernoulli_b2n(const std::size_t n)\
+   { return boost::math::reserve_bernoulli_b2n<T>(n, Policy()); }\
    \
    template <class T> inline typename boost::math::tools::promote_args<T>::type lambert_w0(T z) { return boost::math::lambert_w0(z, Policy()); }\
    template <class T> inline typename boost::math::tools::promote_args<T>::type lambert_wm1(T z) { return boost::math::lambert_w0(z, Policy()); }\
@@ -0,0 +1,66 @@
+//  Copyright 2020 Boost.Math contributors
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_TOOLS_CACHE_STATISTICS_HPP
+#define BOOST_MATH_TOOLS_CACHE_STATISTICS_HPP
+
+#include <cstddef>
+#include <boost/config.hpp>
+#ifndef BOOST_NO_CXX11_HDR_CHRONO
+#include <chrono>
+#endif
+
+namespace boost{ namespace math{ namespace tools{
+
+//
+// Describes the state of one of the lazily filled tables of constants (the
+// Bernoulli numbers, or the abscissas and weights of the double exponential
+// quadratures).  Tables only grow while holding a lock, so growth_time is also
+// an upper bound on the time other threads can have spent waiting for one.
+//
+struct cache_statistics
+{
+   cache_statistics() : size(0), growth_events(0), growth_time(0) {}
+
+   std::size_t size;          // Number of entries (or rows) currently in the table.
+   std::size_t growth_events; // Number of times the table has been filled or extended.
+   double growth_time;        // Total time in seconds spent filling or extending it.
+};
+
+namespace detail{
+
+//
+// Records one growth event, lasting for the lifetime of this object:
+//
+class cache_growth_timer
+{
+public:
+   explicit cache_growth_timer(cache_statistics& s) : m_statistics(s)
+#ifndef BOOST_NO_CXX11_HDR_CHRONO
+      , m_start(std::chrono::steady_clock::now())
+#endif
+   {}
+   ~cache_growth_timer()
+   {
+      ++m_statistics.growth_events;
+#ifndef BOOST_NO_CXX11_HDR_CHRONO
+      m_statistics.growth_time += std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start).count();
+#endif
+   }
+private:
+   cache_growth_timer(const cache_growth_timer&);
+   cache_growth_timer& operator=(const cache_growth_timer&);
+
+   cache_statistics& m_statistics;
+#ifndef BOOST_NO_CXX11_HDR_CHRONO
+   std::chrono::steady_clock::time_point m_start;
+#endif
+};
+
+} // namespace detail
+
+}}} // namespaces
+
+#endif // BOOST_MATH_TOOLS_CACHE_STATISTICS_HPP
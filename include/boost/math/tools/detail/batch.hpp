@@ -0,0 +1,160 @@
+//  Copyright 2020 Boost.Math contributors
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_TOOLS_DETAIL_BATCH_HPP
+#define BOOST_MATH_TOOLS_DETAIL_BATCH_HPP
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include <cstddef>
+#include <iterator>
+#include <boost/math/tools/config.hpp>
+
+//
+// Infrastructure shared by the array ("batch") overloads of the special functions
+// and distributions.
+//
+// The batch kernels are written as straight-line loops over small fixed size blocks
+// of plain arrays, with no branches inside the loop bodies: per-lane choices of
+// approximation are made by indexing into coefficient tables rather than by
+// if/else.  That is enough for GCC, clang, MSVC and Intel to emit SSE2, AVX2 or
+// AVX-512 code (including gathers for the table lookups) depending upon the
+// instruction set selected at compile time, while the same source still runs as
+// plain scalar code everywhere else.
+//
+// BOOST_MATH_SIMD_DOUBLE_WIDTH is the number of doubles in the widest vector
+// register enabled at compile time.  It may be defined by the user to override
+// the automatic choice.
+//
+#ifndef BOOST_MATH_SIMD_DOUBLE_WIDTH
+#  if defined(__AVX512F__)
+#     define BOOST_MATH_SIMD_DOUBLE_WIDTH 8
+#  elif defined(__AVX__)
+#     define BOOST_MATH_SIMD_DOUBLE_WIDTH 4
+#  elif defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)) || defined(__ARM_NEON)
+#     define BOOST_MATH_SIMD_DOUBLE_WIDTH 2
+#  else
+#     define BOOST_MATH_SIMD_DOUBLE_WIDTH 1
+#  endif
+#endif
+
+namespace boost{ namespace math{ namespace tools{ namespace detail{
+//
+// Number of values processed per block: several vector registers worth so that
+// the loop overhead and any scalar fix-up passes are amortised, but small enough
+// that the temporaries stay in L1:
+//
+static const std::size_t batch_block_size = 16 * BOOST_MATH_SIMD_DOUBLE_WIDTH;
+//
+// Evaluates the polynomial in row "row" of a table of coefficients, lowest order
+// term first.  Rows of lower degree are padded with trailing zeros which is exact,
+// since Horner's scheme then just computes 0 * z + 0 until the first true coefficient.
+//
+template <class T, std::size_t Rows, std::size_t Cols, class U>
+inline U evaluate_polynomial_row(const T (&table)[Rows][Cols], std::size_t row, const U& z)
+{
+   U result = static_cast<U>(table[row][Cols - 1]);
+   for(std::size_t i = Cols - 1; i > 0; --i)
+      result = result * z + static_cast<U>(table[row][i - 1]);
+   return result;
+}
+//
+// As above, but picks each coefficient with a chain of selects across the rows
+// rather than an indexed load.  For tables of only a few rows this compiles to
+// blends of broadcast constants, which is considerably cheaper than the gathers
+// needed for evaluate_polynomial_row when each lane may use a different row.
+//
+template <std::size_t Row>
+struct polynomial_coefficient_selector
+{
+   template <class T, std::size_t Rows, std::size_t Cols>
+   static T get(const T (&table)[Rows][Cols], std::size_t row, std::size_t i)
+   {
+      return row == Row ? table[Row][i] : polynomial_coefficient_selector<Row - 1>::get(table, row, i);
+   }
+};
+
+template <>
+struct polynomial_coefficient_selector<0>
+{
+   template <class T, std::size_t Rows, std::size_t Cols>
+   static T get(const T (&table)[Rows][Cols], std::size_t, std::size_t i)
+   {
+      return table[0][i];
+   }
+};
+
+template <class T, std::size_t Rows, std::size_t Cols, class U>
+inline U evaluate_polynomial_blend(const T (&table)[Rows][Cols], std::size_t row, const U& z)
+{
+   U result = static_cast<U>(polynomial_coefficient_selector<Rows - 1>::get(table, row, Cols - 1));
+   for(std::size_t i = Cols - 1; i > 0; --i)
+      result = result * z + static_cast<U>(polynomial_coefficient_selector<Rows - 1>::get(table, row, i - 1));
+   return result;
+}
+//
+// Applies Kernel to [first, last) and writes the results to out.  The input is
+// copied block by block into a contiguous buffer of type Real so that the kernel
+// only ever sees plain arrays, whatever the iterator category.  Kernel is called
+// as k(const Real* in, Real* out, std::size_t n) with n <= batch_block_size.
+//
+template <class Real, class InputIterator, class OutputIterator, class Kernel>
+OutputIterator batch_transform(InputIterator first, InputIterator last, OutputIterator out, Kernel k)
+{
+   Real in_block[batch_block_size];
+   Real out_block[batch_block_size];
+   while(first != last)
+   {
+      std::size_t n = 0;
+      while((n < batch_block_size) && (first != last))
+      {
+         in_block[n++] = static_cast<Real>(*first);
+         ++first;
+      }
+      k(static_cast<const Real*>(in_block), static_cast<Real*>(out_block), n);
+      for(std::size_t i = 0; i < n; ++i)
+      {
+         *out = out_block[i];
+         ++out;
+      }
+   }
+   return out;
+}
+//
+// As above, but for binary functions: the second argument is taken from the
+// range starting at first2, and Kernel is called as
+// k(const Real* in1, const Real* in2, Real* out, std::size_t n).
+//
+template <class Real, class InputIterator1, class InputIterator2, class OutputIterator, class Kernel>
+OutputIterator batch_transform(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, OutputIterator out, Kernel k)
+{
+   Real in_block1[batch_block_size];
+   Real in_block2[batch_block_size];
+   Real out_block[batch_block_size];
+   while(first1 != last1)
+   {
+      std::size_t n = 0;
+      while((n < batch_block_size) && (first1 != last1))
+      {
+         in_block1[n] = static_cast<Real>(*first1);
+         in_block2[n++] = static_cast<Real>(*first2);
+         ++first1;
+         ++first2;
+      }
+      k(static_cast<const Real*>(in_block1), static_cast<const Real*>(in_block2), static_cast<Real*>(out_block), n);
+      for(std::size_t i = 0; i < n; ++i)
+      {
+         *out = out_block[i];
+         ++out;
+      }
+   }
+   return out;
+}
+
+}}}} // namespaces
+
+#endif // BOOST_MATH_TOOLS_DETAIL_BATCH_HPP
@@ -0,0 +1,92 @@
+//  Copyright 2020 Boost.Math contributors
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares pdf_range and cdf_range against calling pdf and cdf at each point, build with for example:
+// g++ -O3 -march=native -I../../include discrete_range_performance.cpp -lbenchmark -lpthread
+
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/math/distributions/binomial.hpp>
+#include <boost/math/distributions/hypergeometric.hpp>
+#include <boost/math/distributions/negative_binomial.hpp>
+#include <boost/math/distributions/poisson.hpp>
+
+template<class Distribution>
+void Pdf(benchmark::State& state, Distribution dist, double k0, double k1)
+{
+    std::vector<double> y(static_cast<size_t>(k1 - k0) + 1);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < y.size(); ++i)
+        {
+            y[i] = pdf(dist, k0 + i);
+        }
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*y.size());
+}
+
+template<class Distribution>
+void PdfRange(benchmark::State& state, Distribution dist, double k0, double k1)
+{
+    std::vector<double> y(static_cast<size_t>(k1 - k0) + 1);
+    for (auto _ : state)
+    {
+        pdf_range(dist, k0, k1, y.begin());
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*y.size());
+}
+
+template<class Distribution>
+void Cdf(benchmark::State& state, Distribution dist, double k0, double k1)
+{
+    std::vector<double> y(static_cast<size_t>(k1 - k0) + 1);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < y.size(); ++i)
+        {
+            y[i] = cdf(dist, k0 + i);
+        }
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*y.size());
+}
+
+template<class Distribution>
+void CdfRange(benchmark::State& state, Distribution dist, double k0, double k1)
+{
+    std::vector<double> y(static_cast<size_t>(k1 - k0) + 1);
+    for (auto _ : state)
+    {
+        cdf_range(dist, k0, k1, y.begin());
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*y.size());
+}
+
+using boost::math::binomial_distribution;
+using boost::math::hypergeometric_distribution;
+using boost::math::negative_binomial_distribution;
+using boost::math::poisson_distribution;
+
+BENCHMARK_CAPTURE(Pdf, binomial, binomial_distribution<double>(1000, 0.3), 0.0, 1000.0);
+BENCHMARK_CAPTURE(PdfRange, binomial, binomial_distribution<double>(1000, 0.3), 0.0, 1000.0);
+BENCHMARK_CAPTURE(Cdf, binomial, binomial_distribution<double>(1000, 0.3), 0.0, 1000.0);
+BENCHMARK_CAPTURE(CdfRange, binomial, binomial_distribution<double>(1000, 0.3), 0.0, 1000.0);
+BENCHMARK_CAPTURE(Pdf, poisson, poisson_distribution<double>(250), 0.0, 1000.0);
+BENCHMARK_CAPTURE(PdfRange, poisson, poisson_distribution<double>(250), 0.0, 1000.0);
+BENCHMARK_CAPTURE(Cdf, poisson, poisson_distribution<double>(250), 0.0, 1000.0);
+BENCHMARK_CAPTURE(CdfRange, poisson, poisson_distribution<double>(250), 0.0, 1000.0);
+BENCHMARK_CAPTURE(Pdf, negative_binomial, negative_binomial_distribution<double>(20, 0.3), 0.0, 1000.0);
+BENCHMARK_CAPTURE(PdfRange, negative_binomial, negative_binomial_distribution<double>(20, 0.3), 0.0, 1000.0);
+BENCHMARK_CAPTURE(Cdf, negative_binomial, negative_binomial_distribution<double>(20, 0.3), 0.0, 1000.0);
+BENCHMARK_CAPTURE(CdfRange, negative_binomial, negative_binomial_distribution<double>(20, 0.3), 0.0, 1000.0);
+BENCHMARK_CAPTURE(Pdf, hypergeometric, hypergeometric_distribution<double>(500, 1000, 5000), 0.0, 500.0);
+BENCHMARK_CAPTURE(PdfRange, hypergeometric, hypergeometric_distribution<double>(500, 1000, 5000), 0.0, 500.0);
+BENCHMARK_CAPTURE(Cdf, hypergeometric, hypergeometric_distribution<double>(500, 1000, 5000), 0.0, 500.0);
+BENCHMARK_CAPTURE(CdfRange, hypergeometric, hypergeometric_distribution<double>(500, 1000, 5000), 0.0, 500.0);
+
+BENCHMARK_MAIN();
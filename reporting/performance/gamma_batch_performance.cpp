@@ -0,0 +1,158 @@
+//  Copyright 2020 Boost.Math contributors
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares the range versions of tgamma, lgamma and tgamma_ratio against calling
+// the scalar versions in a loop, build with for example:
+// g++ -O3 -march=native -I../../include gamma_batch_performance.cpp -lbenchmark -lpthread
+
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/math/special_functions/gamma.hpp>
+
+template<class Real>
+std::vector<Real> random_vector(size_t n, Real a, Real b)
+{
+    std::mt19937_64 mt(12345);
+    std::uniform_real_distribution<Real> unif(a, b);
+    std::vector<Real> v(n);
+    for (auto & t : v)
+    {
+        t = unif(mt);
+    }
+    return v;
+}
+
+template<class Real>
+void TgammaScalarLoop(benchmark::State& state)
+{
+    auto x = random_vector<Real>(state.range(0), 0, 30);
+    std::vector<Real> y(x.size());
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < x.size(); ++i)
+        {
+            y[i] = boost::math::tgamma(x[i]);
+        }
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+template<class Real>
+void TgammaRange(benchmark::State& state)
+{
+    auto x = random_vector<Real>(state.range(0), 0, 30);
+    std::vector<Real> y(x.size());
+    for (auto _ : state)
+    {
+        boost::math::tgamma(x.begin(), x.end(), y.begin());
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+// Counts and shape parameters typical of likelihood calculations:
+template<class Real>
+void LgammaScalarLoop(benchmark::State& state)
+{
+    auto x = random_vector<Real>(state.range(0), 0, 1000);
+    std::vector<Real> y(x.size());
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < x.size(); ++i)
+        {
+            y[i] = boost::math::lgamma(x[i]);
+        }
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+template<class Real>
+void LgammaRange(benchmark::State& state)
+{
+    auto x = random_vector<Real>(state.range(0), 0, 1000);
+    std::vector<Real> y(x.size());
+    for (auto _ : state)
+    {
+        boost::math::lgamma(x.begin(), x.end(), y.begin());
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+template<class Real>
+void LgammaSmallScalarLoop(benchmark::State& state)
+{
+    auto x = random_vector<Real>(state.range(0), 0, 15);
+    std::vector<Real> y(x.size());
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < x.size(); ++i)
+        {
+            y[i] = boost::math::lgamma(x[i]);
+        }
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+template<class Real>
+void LgammaSmallRange(benchmark::State& state)
+{
+    auto x = random_vector<Real>(state.range(0), 0, 15);
+    std::vector<Real> y(x.size());
+    for (auto _ : state)
+    {
+        boost::math::lgamma(x.begin(), x.end(), y.begin());
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+template<class Real>
+void TgammaRatioScalarLoop(benchmark::State& state)
+{
+    auto a = random_vector<Real>(state.range(0), 0, 30);
+    std::vector<Real> b(a.rbegin(), a.rend());
+    std::vector<Real> y(a.size());
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < a.size(); ++i)
+        {
+            y[i] = boost::math::tgamma_ratio(a[i], b[i]);
+        }
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*a.size());
+}
+
+template<class Real>
+void TgammaRatioRange(benchmark::State& state)
+{
+    auto a = random_vector<Real>(state.range(0), 0, 30);
+    std::vector<Real> b(a.rbegin(), a.rend());
+    std::vector<Real> y(a.size());
+    for (auto _ : state)
+    {
+        boost::math::tgamma_ratio(a.begin(), a.end(), b.begin(), y.begin());
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*a.size());
+}
+
+BENCHMARK_TEMPLATE(TgammaScalarLoop, double)->RangeMultiplier(16)->Range(1<<4, 1<<20);
+BENCHMARK_TEMPLATE(TgammaRange, double)->RangeMultiplier(16)->Range(1<<4, 1<<20);
+BENCHMARK_TEMPLATE(LgammaScalarLoop, float)->RangeMultiplier(16)->Range(1<<4, 1<<20);
+BENCHMARK_TEMPLATE(LgammaRange, float)->RangeMultiplier(16)->Range(1<<4, 1<<20);
+BENCHMARK_TEMPLATE(LgammaScalarLoop, double)->RangeMultiplier(16)->Range(1<<4, 1<<20);
+BENCHMARK_TEMPLATE(LgammaRange, double)->RangeMultiplier(16)->Range(1<<4, 1<<20);
+BENCHMARK_TEMPLATE(LgammaSmallScalarLoop, double)->RangeMultiplier(16)->Range(1<<4, 1<<20);
+BENCHMARK_TEMPLATE(LgammaSmallRange, double)->RangeMultiplier(16)->Range(1<<4, 1<<20);
+BENCHMARK_TEMPLATE(TgammaRatioScalarLoop, double)->RangeMultiplier(16)->Range(1<<4, 1<<20);
+BENCHMARK_TEMPLATE(TgammaRatioRange, double)->RangeMultiplier(16)->Range(1<<4, 1<<20);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,66 @@
+//  Copyright 2020 Boost.Math contributors
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares ibeta_evaluator against calling ibeta with the same a and b in a loop,
+// build with for example:
+// g++ -O3 -march=native -I../../include ibeta_evaluator_performance.cpp -lbenchmark -lpthread
+
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/math/special_functions/beta.hpp>
+
+// Shape parameters: a student's t cdf with 5 degrees of freedom, a binomial
+// cdf with n = 100 and k = 30, a small b, and a pair of large parameters.
+static const double shapes[][2] = { { 2.5, 0.5 }, { 31, 70 }, { 20, 0.5 }, { 300, 400 } };
+
+std::vector<double> random_x(size_t n)
+{
+    std::mt19937_64 mt(12345);
+    std::uniform_real_distribution<double> unif(0, 1);
+    std::vector<double> v(n);
+    for (auto & t : v)
+    {
+        t = unif(mt);
+    }
+    return v;
+}
+
+void IbetaScalarLoop(benchmark::State& state)
+{
+    double a = shapes[state.range(0)][0];
+    double b = shapes[state.range(0)][1];
+    auto x = random_x(4096);
+    std::vector<double> y(x.size());
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < x.size(); ++i)
+        {
+            y[i] = boost::math::ibeta(a, b, x[i]);
+        }
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+void IbetaEvaluator(benchmark::State& state)
+{
+    double a = shapes[state.range(0)][0];
+    double b = shapes[state.range(0)][1];
+    auto x = random_x(4096);
+    std::vector<double> y(x.size());
+    for (auto _ : state)
+    {
+        boost::math::ibeta_evaluator<double> ev(a, b);
+        ev.ibeta(x.begin(), x.end(), y.begin());
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+BENCHMARK(IbetaScalarLoop)->DenseRange(0, 3);
+BENCHMARK(IbetaEvaluator)->DenseRange(0, 3);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,108 @@
+//  Copyright 2020 Boost.Math contributors
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares the range versions of gamma_p and gamma_q against calling the scalar
+// versions in a loop, build with for example:
+// g++ -O3 -march=native -I../../include igamma_batch_performance.cpp -lbenchmark -lpthread
+
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/math/special_functions/gamma.hpp>
+
+std::vector<double> random_vector(size_t n, double a, double b)
+{
+    std::mt19937_64 mt(12345);
+    std::uniform_real_distribution<double> unif(a, b);
+    std::vector<double> v(n);
+    for (auto & t : v)
+    {
+        t = unif(mt);
+    }
+    return v;
+}
+
+// Chi squared cdf's with 1 to 60 degrees of freedom, Q(df/2, x/2):
+void ChiSquaredScalarLoop(benchmark::State& state)
+{
+    auto x = random_vector(4096, 0, 100);
+    std::vector<double> y(x.size());
+    for (auto _ : state)
+    {
+        for (unsigned df = 1; df <= 60; df += 3)
+        {
+            for (size_t i = 0; i < x.size(); ++i)
+            {
+                y[i] = boost::math::gamma_q(df / 2.0, x[i] / 2);
+            }
+            benchmark::DoNotOptimize(y.data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations()*x.size()*20);
+}
+
+void ChiSquaredRange(benchmark::State& state)
+{
+    auto x = random_vector(4096, 0, 100);
+    for (auto & t : x)
+    {
+        t /= 2;
+    }
+    std::vector<double> y(x.size());
+    for (auto _ : state)
+    {
+        for (unsigned df = 1; df <= 60; df += 3)
+        {
+            boost::math::gamma_q(df / 2.0, x.begin(), x.end(), y.begin());
+            benchmark::DoNotOptimize(y.data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations()*x.size()*20);
+}
+
+// Poisson cdf's, Q(k + 1, mean) for counts k and means up to 50:
+void PoissonScalarLoop(benchmark::State& state)
+{
+    auto k = random_vector(4096, 0, 60);
+    auto mean = random_vector(4096, 0.5, 50);
+    std::vector<double> y(k.size());
+    for (auto & t : k)
+    {
+        t = std::floor(t) + 1;
+    }
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < k.size(); ++i)
+        {
+            y[i] = boost::math::gamma_q(k[i], mean[i]);
+        }
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*k.size());
+}
+
+void PoissonRange(benchmark::State& state)
+{
+    auto k = random_vector(4096, 0, 60);
+    auto mean = random_vector(4096, 0.5, 50);
+    std::vector<double> y(k.size());
+    for (auto & t : k)
+    {
+        t = std::floor(t) + 1;
+    }
+    for (auto _ : state)
+    {
+        boost::math::gamma_q(k.begin(), k.end(), mean.begin(), y.begin());
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*k.size());
+}
+
+BENCHMARK(ChiSquaredScalarLoop);
+BENCHMARK(ChiSquaredRange);
+BENCHMARK(PoissonScalarLoop);
+BENCHMARK(PoissonRange);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,67 @@
+//  Copyright 2020 Boost.Math contributors
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures how the rate of integrand calls made by naive_monte_carlo scales with the number of threads,
+// build with for example:
+// g++ -O3 -march=native -I../../include naive_monte_carlo_performance.cpp -lbenchmark -lpthread
+
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/math/quadrature/naive_monte_carlo.hpp>
+
+using boost::math::quadrature::naive_monte_carlo;
+
+// Each run integrates for a fixed time with an unattainable error goal, and is then cancelled:
+template<class Real, class F>
+void Calls(benchmark::State& state, F f, std::size_t dimension)
+{
+    std::vector<std::pair<Real, Real>> bounds(dimension, std::make_pair(Real(0), Real(1)));
+    uint64_t threads = state.range(0);
+    double calls = 0;
+    for (auto _ : state)
+    {
+        naive_monte_carlo<Real, F> mc(f, bounds, Real(0), false, threads, 1234);
+        auto task = mc.integrate();
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        mc.cancel();
+        benchmark::DoNotOptimize(task.get());
+        calls += static_cast<double>(mc.calls());
+    }
+    state.counters["calls"] = benchmark::Counter(calls, benchmark::Counter::kIsRate);
+}
+
+// An integrand as cheap as they come, where the bookkeeping dominates:
+template<class Real>
+void CheapIntegrand(benchmark::State& state)
+{
+    auto f = [](std::vector<Real> const & x)->Real { return x[0]*x[1]; };
+    Calls<Real>(state, f, 2);
+}
+
+// And one which costs about as much as a special function call:
+template<class Real>
+void ExpensiveIntegrand(benchmark::State& state)
+{
+    auto f = [](std::vector<Real> const & x)->Real
+    {
+        using std::exp;
+        using std::cos;
+        Real r = 0;
+        for (std::size_t i = 0; i < x.size(); ++i)
+        {
+            r += cos(x[i]*x[i]);
+        }
+        return exp(-r);
+    };
+    Calls<Real>(state, f, 6);
+}
+
+BENCHMARK_TEMPLATE(CheapIntegrand, double)->RangeMultiplier(2)->Range(1, 64)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(ExpensiveIntegrand, double)->RangeMultiplier(2)->Range(1, 64)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
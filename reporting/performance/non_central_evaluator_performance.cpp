@@ -0,0 +1,73 @@
+//  Copyright 2020 Boost.Math contributors
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares the noncentral distribution evaluators against calling cdf at each point, build with for example:
+// g++ -O3 -march=native -I../../include non_central_evaluator_performance.cpp -lbenchmark -lpthread
+
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/math/distributions/non_central_beta.hpp>
+#include <boost/math/distributions/non_central_chi_squared.hpp>
+#include <boost/math/distributions/non_central_f.hpp>
+#include <boost/math/distributions/non_central_t.hpp>
+
+std::vector<double> grid(double a, double b, size_t n)
+{
+    std::vector<double> x(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        x[i] = a + (b - a)*(i + 0.5)/n;
+    }
+    return x;
+}
+
+template<class Distribution>
+void Cdf(benchmark::State& state, Distribution dist, double a, double b)
+{
+    auto x = grid(a, b, state.range(0));
+    std::vector<double> y(x.size());
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < x.size(); ++i)
+        {
+            y[i] = cdf(dist, x[i]);
+        }
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+template<class CdfEvaluator>
+void EvaluatorCdf(benchmark::State& state, CdfEvaluator e, double a, double b)
+{
+    auto x = grid(a, b, state.range(0));
+    std::vector<double> y(x.size());
+    for (auto _ : state)
+    {
+        // Include the cost of filling the cache each time:
+        CdfEvaluator evaluator(e.distribution());
+        evaluator.cdf(x.begin(), x.end(), y.begin());
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+using boost::math::non_central_beta_distribution;
+using boost::math::non_central_chi_squared_distribution;
+using boost::math::non_central_f_distribution;
+using boost::math::non_central_t_distribution;
+
+BENCHMARK_CAPTURE(Cdf, chi_squared_small, non_central_chi_squared_distribution<double>(4, 2), 0.0, 30.0)->RangeMultiplier(10)->Range(10, 10000);
+BENCHMARK_CAPTURE(EvaluatorCdf, chi_squared_small, boost::math::non_central_chi_squared_evaluator<double>(non_central_chi_squared_distribution<double>(4, 2)), 0.0, 30.0)->RangeMultiplier(10)->Range(10, 10000);
+BENCHMARK_CAPTURE(Cdf, chi_squared_large, non_central_chi_squared_distribution<double>(4, 200), 100.0, 350.0)->RangeMultiplier(10)->Range(10, 10000);
+BENCHMARK_CAPTURE(EvaluatorCdf, chi_squared_large, boost::math::non_central_chi_squared_evaluator<double>(non_central_chi_squared_distribution<double>(4, 200)), 100.0, 350.0)->RangeMultiplier(10)->Range(10, 10000);
+BENCHMARK_CAPTURE(Cdf, beta, non_central_beta_distribution<double>(2.5, 7, 30), 0.0, 1.0)->RangeMultiplier(10)->Range(10, 10000);
+BENCHMARK_CAPTURE(EvaluatorCdf, beta, boost::math::non_central_beta_evaluator<double>(non_central_beta_distribution<double>(2.5, 7, 30)), 0.0, 1.0)->RangeMultiplier(10)->Range(10, 10000);
+BENCHMARK_CAPTURE(Cdf, f, non_central_f_distribution<double>(5, 12, 10), 0.0, 10.0)->RangeMultiplier(10)->Range(10, 10000);
+BENCHMARK_CAPTURE(EvaluatorCdf, f, boost::math::non_central_f_evaluator<double>(non_central_f_distribution<double>(5, 12, 10)), 0.0, 10.0)->RangeMultiplier(10)->Range(10, 10000);
+BENCHMARK_CAPTURE(Cdf, t, non_central_t_distribution<double>(8, 2.5), -3.0, 10.0)->RangeMultiplier(10)->Range(10, 10000);
+BENCHMARK_CAPTURE(EvaluatorCdf, t, boost::math::non_central_t_evaluator<double>(non_central_t_distribution<double>(8, 2.5)), -3.0, 10.0)->RangeMultiplier(10)->Range(10, 10000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,134 @@
+//  Copyright 2020 Boost.Math contributors
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares the range versions of pdf, cdf and quantile for the normal distribution
+// against calling the scalar versions in a loop, build with for example:
+// g++ -O3 -march=native -I../../include normal_distribution_batch_performance.cpp -lbenchmark -lpthread
+
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/math/distributions/normal.hpp>
+
+using boost::math::normal_distribution;
+
+template<class Real>
+std::vector<Real> random_vector(size_t n, Real a, Real b)
+{
+    std::mt19937_64 mt(12345);
+    std::uniform_real_distribution<Real> unif(a, b);
+    std::vector<Real> v(n);
+    for (auto & t : v)
+    {
+        t = unif(mt);
+    }
+    return v;
+}
+
+template<class Real>
+void NormalCdfScalarLoop(benchmark::State& state)
+{
+    normal_distribution<Real> dist(Real(0.5), Real(2));
+    auto x = random_vector<Real>(state.range(0), -10, 10);
+    std::vector<Real> y(x.size());
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < x.size(); ++i)
+        {
+            y[i] = cdf(dist, x[i]);
+        }
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+template<class Real>
+void NormalCdfRange(benchmark::State& state)
+{
+    normal_distribution<Real> dist(Real(0.5), Real(2));
+    auto x = random_vector<Real>(state.range(0), -10, 10);
+    std::vector<Real> y(x.size());
+    for (auto _ : state)
+    {
+        cdf(dist, x.begin(), x.end(), y.begin());
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+template<class Real>
+void NormalPdfScalarLoop(benchmark::State& state)
+{
+    normal_distribution<Real> dist(Real(0.5), Real(2));
+    auto x = random_vector<Real>(state.range(0), -10, 10);
+    std::vector<Real> y(x.size());
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < x.size(); ++i)
+        {
+            y[i] = pdf(dist, x[i]);
+        }
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+template<class Real>
+void NormalPdfRange(benchmark::State& state)
+{
+    normal_distribution<Real> dist(Real(0.5), Real(2));
+    auto x = random_vector<Real>(state.range(0), -10, 10);
+    std::vector<Real> y(x.size());
+    for (auto _ : state)
+    {
+        pdf(dist, x.begin(), x.end(), y.begin());
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+template<class Real>
+void NormalQuantileScalarLoop(benchmark::State& state)
+{
+    normal_distribution<Real> dist(Real(0.5), Real(2));
+    auto p = random_vector<Real>(state.range(0), 0, 1);
+    std::vector<Real> y(p.size());
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < p.size(); ++i)
+        {
+            y[i] = quantile(dist, p[i]);
+        }
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*p.size());
+}
+
+template<class Real>
+void NormalQuantileRange(benchmark::State& state)
+{
+    normal_distribution<Real> dist(Real(0.5), Real(2));
+    auto p = random_vector<Real>(state.range(0), 0, 1);
+    std::vector<Real> y(p.size());
+    for (auto _ : state)
+    {
+        quantile(dist, p.begin(), p.end(), y.begin());
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*p.size());
+}
+
+BENCHMARK_TEMPLATE(NormalCdfScalarLoop, float)->RangeMultiplier(16)->Range(1<<4, 1<<20);
+BENCHMARK_TEMPLATE(NormalCdfRange, float)->RangeMultiplier(16)->Range(1<<4, 1<<20);
+BENCHMARK_TEMPLATE(NormalCdfScalarLoop, double)->RangeMultiplier(16)->Range(1<<4, 1<<20);
+BENCHMARK_TEMPLATE(NormalCdfRange, double)->RangeMultiplier(16)->Range(1<<4, 1<<20);
+BENCHMARK_TEMPLATE(NormalPdfScalarLoop, double)->RangeMultiplier(16)->Range(1<<4, 1<<20);
+BENCHMARK_TEMPLATE(NormalPdfRange, double)->RangeMultiplier(16)->Range(1<<4, 1<<20);
+BENCHMARK_TEMPLATE(NormalQuantileScalarLoop, float)->RangeMultiplier(16)->Range(1<<4, 1<<20);
+BENCHMARK_TEMPLATE(NormalQuantileRange, float)->RangeMultiplier(16)->Range(1<<4, 1<<20);
+BENCHMARK_TEMPLATE(NormalQuantileScalarLoop, double)->RangeMultiplier(16)->Range(1<<4, 1<<20);
+BENCHMARK_TEMPLATE(NormalQuantileRange, double)->RangeMultiplier(16)->Range(1<<4, 1<<20);
+
+BENCHMARK_MAIN();
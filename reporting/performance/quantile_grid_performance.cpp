@@ -0,0 +1,81 @@
+//  Copyright 2020 Boost.Math contributors
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares quantile_grid against calling quantile at each point, build with for example:
+// g++ -O3 -march=native -I../../include quantile_grid_performance.cpp -lbenchmark -lpthread
+
+#include <thread>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/math/distributions/beta.hpp>
+#include <boost/math/distributions/gamma.hpp>
+#include <boost/math/distributions/non_central_t.hpp>
+#include <boost/math/distributions/quantile_grid.hpp>
+
+std::vector<double> uniform_grid(size_t n)
+{
+    std::vector<double> p(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        p[i] = (i + 0.5)/n;
+    }
+    return p;
+}
+
+template<class Distribution>
+void Quantile(benchmark::State& state, Distribution dist)
+{
+    auto p = uniform_grid(state.range(0));
+    std::vector<double> y(p.size());
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < p.size(); ++i)
+        {
+            y[i] = quantile(dist, p[i]);
+        }
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*p.size());
+}
+
+template<class Distribution>
+void QuantileGrid(benchmark::State& state, Distribution dist)
+{
+    auto p = uniform_grid(state.range(0));
+    std::vector<double> y(p.size());
+    for (auto _ : state)
+    {
+        boost::math::quantile_grid(dist, p.begin(), p.end(), y.begin());
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*p.size());
+}
+
+template<class Distribution>
+void QuantileGridThreaded(benchmark::State& state, Distribution dist)
+{
+    auto p = uniform_grid(state.range(0));
+    std::vector<double> y(p.size());
+    unsigned threads = std::thread::hardware_concurrency();
+    for (auto _ : state)
+    {
+        boost::math::quantile_grid(dist, p.begin(), p.end(), y.begin(), threads);
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*p.size());
+    state.counters["threads"] = threads;
+}
+
+BENCHMARK_CAPTURE(Quantile, beta, boost::math::beta_distribution<double>(2.5, 7))->RangeMultiplier(10)->Range(100, 100000)->UseRealTime();
+BENCHMARK_CAPTURE(QuantileGrid, beta, boost::math::beta_distribution<double>(2.5, 7))->RangeMultiplier(10)->Range(100, 100000)->UseRealTime();
+BENCHMARK_CAPTURE(QuantileGridThreaded, beta, boost::math::beta_distribution<double>(2.5, 7))->RangeMultiplier(10)->Range(100, 100000)->UseRealTime();
+BENCHMARK_CAPTURE(Quantile, gamma, boost::math::gamma_distribution<double>(3.3))->RangeMultiplier(10)->Range(100, 100000)->UseRealTime();
+BENCHMARK_CAPTURE(QuantileGrid, gamma, boost::math::gamma_distribution<double>(3.3))->RangeMultiplier(10)->Range(100, 100000)->UseRealTime();
+BENCHMARK_CAPTURE(QuantileGridThreaded, gamma, boost::math::gamma_distribution<double>(3.3))->RangeMultiplier(10)->Range(100, 100000)->UseRealTime();
+BENCHMARK_CAPTURE(Quantile, non_central_t, boost::math::non_central_t_distribution<double>(5, 1.5))->RangeMultiplier(10)->Range(100, 10000)->UseRealTime();
+BENCHMARK_CAPTURE(QuantileGrid, non_central_t, boost::math::non_central_t_distribution<double>(5, 1.5))->RangeMultiplier(10)->Range(100, 10000)->UseRealTime();
+BENCHMARK_CAPTURE(QuantileGridThreaded, non_central_t, boost::math::non_central_t_distribution<double>(5, 1.5))->RangeMultiplier(10)->Range(100, 10000)->UseRealTime();
+
+BENCHMARK_MAIN();
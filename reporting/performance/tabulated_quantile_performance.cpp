@@ -0,0 +1,83 @@
+//  Copyright 2020 Boost.Math contributors
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares tabulated_quantile against calling quantile directly, build with for example:
+// g++ -O3 -march=native -I../../include tabulated_quantile_performance.cpp -lbenchmark -lpthread
+
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/math/distributions/beta.hpp>
+#include <boost/math/distributions/gamma.hpp>
+#include <boost/math/distributions/students_t.hpp>
+#include <boost/math/distributions/tabulated_quantile.hpp>
+
+std::vector<double> random_probabilities(size_t n)
+{
+    std::mt19937_64 mt(12345);
+    std::uniform_real_distribution<double> unif(0, 1);
+    std::vector<double> v(n);
+    for (auto & t : v)
+    {
+        t = unif(mt);
+    }
+    return v;
+}
+
+template<class Distribution>
+void Quantile(benchmark::State& state, Distribution dist)
+{
+    auto p = random_probabilities(1024);
+    std::vector<double> y(p.size());
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < p.size(); ++i)
+        {
+            y[i] = quantile(dist, p[i]);
+        }
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*p.size());
+}
+
+template<class Distribution>
+void TabulatedQuantile(benchmark::State& state, Distribution dist)
+{
+    auto p = random_probabilities(1024);
+    std::vector<double> y(p.size());
+    boost::math::tabulated_quantile<Distribution> q(dist);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < p.size(); ++i)
+        {
+            y[i] = q(p[i]);
+        }
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*p.size());
+    state.counters["max_relative_error"] = q.max_relative_error();
+}
+
+template<class Distribution>
+void TabulatedQuantileConstruction(benchmark::State& state, Distribution dist)
+{
+    for (auto _ : state)
+    {
+        boost::math::tabulated_quantile<Distribution> q(dist);
+        benchmark::DoNotOptimize(q.pieces());
+    }
+}
+
+BENCHMARK_CAPTURE(Quantile, gamma, boost::math::gamma_distribution<double>(2.5));
+BENCHMARK_CAPTURE(TabulatedQuantile, gamma, boost::math::gamma_distribution<double>(2.5));
+BENCHMARK_CAPTURE(TabulatedQuantileConstruction, gamma, boost::math::gamma_distribution<double>(2.5))->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(Quantile, beta, boost::math::beta_distribution<double>(2, 3));
+BENCHMARK_CAPTURE(TabulatedQuantile, beta, boost::math::beta_distribution<double>(2, 3));
+BENCHMARK_CAPTURE(TabulatedQuantileConstruction, beta, boost::math::beta_distribution<double>(2, 3))->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(Quantile, students_t, boost::math::students_t_distribution<double>(5));
+BENCHMARK_CAPTURE(TabulatedQuantile, students_t, boost::math::students_t_distribution<double>(5));
+BENCHMARK_CAPTURE(TabulatedQuantileConstruction, students_t, boost::math::students_t_distribution<double>(5))->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,170 @@
+/*
+ * Copyright 2020 Boost.Math contributors
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <limits>
+#include <boost/math/quadrature/tanh_sinh.hpp>
+#include <boost/math/quadrature/exp_sinh.hpp>
+#include <boost/math/quadrature/sinh_sinh.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::math::quadrature::tanh_sinh;
+using boost::math::quadrature::exp_sinh;
+using boost::math::quadrature::sinh_sinh;
+using boost::multiprecision::cpp_bin_float_50;
+
+struct call_counts
+{
+    call_counts() : calls(0), points(0) {}
+    std::size_t calls, points;
+};
+
+//
+// Turns a scalar integrand into a batched one, optionally counting the calls made
+// (the integrators take their integrands by value, so the counts live elsewhere):
+//
+template<class F>
+struct batched
+{
+    batched(F f, call_counts* counts) : f(f), counts(counts) {}
+    template<class Real>
+    void operator()(const Real* x, Real* y, std::size_t n) const
+    {
+        if (counts)
+        {
+            ++counts->calls;
+            counts->points += n;
+        }
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            y[i] = f(x[i]);
+        }
+    }
+    F f;
+    call_counts* counts;
+};
+
+template<class F>
+batched<F> make_batched(F f, call_counts* counts = nullptr)
+{
+    return batched<F>(f, counts);
+}
+
+// The batched forms should give bit-identical results to the scalar forms, since they
+// make the same changes of variable and sum the same terms in the same order:
+template<class Real, class Integrator, class F>
+void check_same(Integrator& integrator, F f, Real a, Real b, Real tol, const char* name)
+{
+    Real err1, L11, err2, L12;
+    std::size_t levels1, levels2;
+    Real I1 = integrator.integrate(f, a, b, tol, &err1, &L11, &levels1);
+    call_counts counts;
+    Real I2 = integrator.integrate(make_batched(f, &counts), a, b, tol, &err2, &L12, &levels2);
+    if (I1 != I2)
+    {
+        std::cerr << "  Batched and scalar integrals differ for " << name << " over [" << a << ", " << b << "]\n";
+    }
+    CHECK_EQUAL(I1, I2);
+    CHECK_EQUAL(err1, err2);
+    CHECK_EQUAL(L11, L12);
+    CHECK_EQUAL(levels1, levels2);
+    // There should be at most a few calls per level:
+    CHECK_LE(counts.calls, 2 * levels2 + 3);
+    if (a != b)
+    {
+        CHECK_LE(levels2, counts.calls);
+    }
+}
+
+template<class Real>
+void test_tanh_sinh()
+{
+    using std::sqrt;
+    using std::log;
+    using std::exp;
+    Real inf = std::numeric_limits<Real>::infinity();
+    Real tol = boost::math::tools::root_epsilon<Real>();
+    tanh_sinh<Real> integrator;
+    auto f = [](Real x)->Real { return sqrt(1 - x * x) * log(1 + x + Real(1) / 4); };
+    check_same(integrator, f, Real(-1), Real(1), tol, "tanh_sinh");
+    check_same(integrator, f, Real(-0.25), Real(0.75), tol, "tanh_sinh");
+    auto g = [](Real x)->Real { return 1 / sqrt(x); };
+    check_same(integrator, g, Real(0), Real(1), tol, "tanh_sinh");
+    check_same(integrator, g, Real(2), Real(1), tol, "tanh_sinh");
+    check_same(integrator, g, Real(1), Real(1), tol, "tanh_sinh");
+    auto h = [](Real x)->Real { return exp(-x * x); };
+    check_same(integrator, h, -inf, inf, tol, "tanh_sinh");
+    check_same(integrator, h, Real(-1), inf, tol, "tanh_sinh");
+    check_same(integrator, h, -inf, Real(0.5), tol, "tanh_sinh");
+
+    // And with no limits, over [-1, 1]:
+    Real I1 = integrator.integrate(f, tol);
+    Real I2 = integrator.integrate(make_batched(f), tol);
+    CHECK_EQUAL(I1, I2);
+
+    // A lambda may be used directly:
+    I2 = integrator.integrate([](const Real* x, Real* y, std::size_t n) { for (std::size_t i = 0; i < n; ++i) { y[i] = 1 / sqrt(x[i]); } }, Real(0), Real(1));
+    CHECK_ULP_CLOSE(Real(2), I2, 20);
+}
+
+template<class Real>
+void test_exp_sinh()
+{
+    using std::exp;
+    using std::sqrt;
+    Real inf = std::numeric_limits<Real>::infinity();
+    Real tol = boost::math::tools::root_epsilon<Real>();
+    exp_sinh<Real> integrator;
+    auto f = [](Real x)->Real { return exp(-x) / (1 + x * x); };
+    check_same(integrator, f, Real(0), inf, tol, "exp_sinh");
+    check_same(integrator, f, Real(2), inf, tol, "exp_sinh");
+    auto g = [](Real x)->Real { return exp(x) * sqrt(-x); };
+    check_same(integrator, g, -inf, Real(0), tol, "exp_sinh");
+
+    Real I1 = integrator.integrate(f, tol);
+    Real I2 = integrator.integrate(make_batched(f), tol);
+    CHECK_EQUAL(I1, I2);
+}
+
+template<class Real>
+void test_sinh_sinh()
+{
+    using std::exp;
+    Real tol = boost::math::tools::root_epsilon<Real>();
+    sinh_sinh<Real> integrator;
+    auto f = [](Real x)->Real { return 1 / (1 + x * x + x * x * x * x); };
+    auto g = [](Real x)->Real { return exp(-x * x / 2) * (1 + x); };
+    for (int i = 0; i < 2; ++i)
+    {
+        Real err1, L11, err2, L12;
+        std::size_t levels1, levels2;
+        Real I1 = i ? integrator.integrate(g, tol, &err1, &L11, &levels1) : integrator.integrate(f, tol, &err1, &L11, &levels1);
+        Real I2 = i ? integrator.integrate(make_batched(g), tol, &err2, &L12, &levels2) : integrator.integrate(make_batched(f), tol, &err2, &L12, &levels2);
+        CHECK_EQUAL(I1, I2);
+        CHECK_EQUAL(err1, err2);
+        CHECK_EQUAL(L11, L12);
+        CHECK_EQUAL(levels1, levels2);
+    }
+}
+
+int main()
+{
+    test_tanh_sinh<float>();
+    test_tanh_sinh<double>();
+    test_tanh_sinh<long double>();
+    test_tanh_sinh<cpp_bin_float_50>();
+    test_exp_sinh<float>();
+    test_exp_sinh<double>();
+    test_exp_sinh<long double>();
+    test_exp_sinh<cpp_bin_float_50>();
+    test_sinh_sinh<float>();
+    test_sinh_sinh<double>();
+    test_sinh_sinh<long double>();
+    test_sinh_sinh<cpp_bin_float_50>();
+    return boost::math::test::report_errors();
+}
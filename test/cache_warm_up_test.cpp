@@ -0,0 +1,163 @@
+/*
+ * Copyright 2020 Boost.Math contributors
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <thread>
+#include <vector>
+#include <boost/math/special_functions/bernoulli.hpp>
+#include <boost/math/quadrature/tanh_sinh.hpp>
+#include <boost/math/quadrature/exp_sinh.hpp>
+#include <boost/math/quadrature/sinh_sinh.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::math::tools::cache_statistics;
+using boost::math::quadrature::tanh_sinh;
+using boost::math::quadrature::exp_sinh;
+using boost::math::quadrature::sinh_sinh;
+using boost::multiprecision::cpp_bin_float_50;
+using boost::multiprecision::cpp_bin_float_100;
+
+void test_bernoulli()
+{
+    // Each policy has a cache of its own, so this one is untouched by anything else in the program:
+    using namespace boost::math::policies;
+    typedef policy<digits10<40> > Policy;
+    Policy pol;
+    std::size_t n = boost::math::reserve_bernoulli_b2n<cpp_bin_float_50>(300, pol);
+    CHECK_LE(std::size_t(300), n);
+    cache_statistics before = boost::math::bernoulli_b2n_cache_statistics<cpp_bin_float_50>(pol);
+    CHECK_EQUAL(before.size, n);
+    CHECK_LE(std::size_t(1), before.growth_events);
+    CHECK_LE(0.0, before.growth_time);
+    // Everything already reserved is read without growing the cache:
+    std::vector<cpp_bin_float_50> b, t;
+    boost::math::bernoulli_b2n<cpp_bin_float_50>(0, 300, std::back_inserter(b), pol);
+    boost::math::tangent_t2n<cpp_bin_float_50>(1, 250, std::back_inserter(t), pol);
+    cache_statistics after = boost::math::bernoulli_b2n_cache_statistics<cpp_bin_float_50>(pol);
+    CHECK_EQUAL(before.growth_events, after.growth_events);
+    CHECK_EQUAL(before.size, after.size);
+    CHECK_EQUAL(boost::math::reserve_bernoulli_b2n<cpp_bin_float_50>(100, pol), n);
+    // And the values are the same as ever:
+    for (std::size_t i = 0; i < 120; ++i)
+    {
+        CHECK_ULP_CLOSE(boost::math::bernoulli_b2n<double>(static_cast<int>(i)), static_cast<double>(b[i]), 1);
+    }
+    CHECK_ULP_CLOSE(boost::math::tangent_t2n<double>(20), static_cast<double>(t[19]), 4);
+    // Asking for more grows the cache again:
+    boost::math::bernoulli_b2n<cpp_bin_float_50>(static_cast<int>(n + 10), pol);
+    after = boost::math::bernoulli_b2n_cache_statistics<cpp_bin_float_50>(pol);
+    CHECK_LE(before.growth_events + 1, after.growth_events);
+    CHECK_LE(n + 11, after.size);
+}
+
+void test_bernoulli_threads()
+{
+    // Many threads racing to fill a cold cache must all see the same values:
+    const unsigned threads = 8;
+    std::vector<std::vector<cpp_bin_float_100> > results(threads);
+    std::vector<std::thread> pool;
+    for (unsigned i = 0; i < threads; ++i)
+    {
+        pool.emplace_back([i, &results]() {
+            for (int k = 0; k < 200; k += 7)
+            {
+                results[i].push_back(boost::math::bernoulli_b2n<cpp_bin_float_100>(k + 30 * static_cast<int>(i % 3)));
+            }
+        });
+    }
+    for (auto& th : pool)
+    {
+        th.join();
+    }
+    for (unsigned i = 0; i < threads; ++i)
+    {
+        std::size_t j = 0;
+        for (int k = 0; k < 200; k += 7, ++j)
+        {
+            CHECK_EQUAL(boost::math::bernoulli_b2n<cpp_bin_float_100>(k + 30 * static_cast<int>(i % 3)), results[i][j]);
+        }
+    }
+}
+
+template<class Integrator, class F>
+void check_reserve(Integrator integrator, std::size_t max_refinements, F f, const char* name)
+{
+    using Real = decltype(f(0.0));
+    cache_statistics s = integrator.table_statistics();
+    // The rows computed by the constructor are the first growth event:
+    CHECK_EQUAL(s.growth_events, std::size_t(1));
+    std::size_t levels = integrator.reserve_refinements(max_refinements);
+    s = integrator.table_statistics();
+    CHECK_EQUAL(s.size, levels + 1);
+    CHECK_LE(levels + 1, max_refinements + 1);
+    // Integrating at any tolerance now never needs another row:
+    Integrator copy = integrator;
+    Real I1 = copy.integrate(f, Real(0));
+    cache_statistics t = integrator.table_statistics();
+    CHECK_EQUAL(s.growth_events, t.growth_events);
+    CHECK_EQUAL(s.size, t.size);
+    // And gives the same answer as the tables filled on demand:
+    Integrator cold(max_refinements);
+    Real I2 = cold.integrate(f, Real(0));
+    if (I1 != I2)
+    {
+        std::cerr << "  Integrals differ for " << name << "\n";
+    }
+    CHECK_EQUAL(I1, I2);
+    CHECK_LE(integrator.reserve_refinements(2), levels);
+}
+
+template<class Integrator, class F>
+void check_threads(std::size_t max_refinements, F f)
+{
+    using Real = decltype(f(0.0));
+    Integrator integrator(max_refinements);
+    Real expected = Integrator(max_refinements).integrate(f, Real(0));
+    const unsigned threads = 6;
+    std::vector<Real> results(threads);
+    std::vector<std::thread> pool;
+    for (unsigned i = 0; i < threads; ++i)
+    {
+        pool.emplace_back([i, &integrator, &results, f]() { results[i] = integrator.integrate(f, Real(0)); });
+    }
+    for (auto& th : pool)
+    {
+        th.join();
+    }
+    for (unsigned i = 0; i < threads; ++i)
+    {
+        CHECK_EQUAL(expected, results[i]);
+    }
+}
+
+template<class Real>
+void test_quadrature(std::size_t levels)
+{
+    using std::exp;
+    using std::sqrt;
+    using std::log;
+    auto f = [](Real x) { return sqrt(1 - x * x) * log(1 + x + 1 / Real(4)); };
+    auto g = [](Real x) { return exp(-x) / (1 + x * x); };
+    auto h = [](Real x) { return 1 / (1 + x * x + x * x * x * x); };
+    check_reserve(tanh_sinh<Real>(levels), levels, f, "tanh_sinh");
+    check_reserve(exp_sinh<Real>(levels), levels, g, "exp_sinh");
+    check_reserve(sinh_sinh<Real>(levels), levels, h, "sinh_sinh");
+    check_threads<tanh_sinh<Real> >(levels, f);
+    check_threads<exp_sinh<Real> >(levels, g);
+    check_threads<sinh_sinh<Real> >(levels, h);
+}
+
+int main()
+{
+    test_bernoulli();
+    test_bernoulli_threads();
+    test_quadrature<double>(12);
+    // Beyond the precomputed tables, so every row is computed at run time:
+    test_quadrature<cpp_bin_float_50>(7);
+    return boost::math::test::report_errors();
+}
@@ -6,6 +6,7 @@
 
 #define BOOST_TEST_MODULE test_cubic_b_spline
 
+#include <array>
 #include <random>
 #include <functional>
 #include <boost/random/uniform_real_distribution.hpp>
@@ -314,6 +315,95 @@ void test_outside_interval()
     cnull << spline(2000);
 }
 
+template<std::size_t k, class Real>
+void test_banded_solve()
+{
+    std::cout << "Testing the partitioned banded solver with " << k << " sub- and superdiagonals on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    std::mt19937 gen(12);
+    boost::random::uniform_real_distribution<Real> dis(-1, 1);
+    for (std::size_t n : {3, 10, 57, 1000})
+    {
+        // A random diagonally dominant band matrix, and a right hand side with a known solution:
+        std::vector<std::array<Real, 2*k + 1>> A(n);
+        for (auto & row : A)
+        {
+            for (auto & a : row)
+            {
+                a = dis(gen);
+            }
+            row[k] += 2*k + 1;
+        }
+        std::vector<Real> x(n);
+        for (auto & t : x)
+        {
+            t = dis(gen);
+        }
+        std::vector<Real> r(n, 0);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            for (std::size_t j = 0; j < 2*k + 1; ++j)
+            {
+                if (i + j >= k && i + j < n + k)
+                {
+                    r[i] += A[i][j]*x[i + j - k];
+                }
+            }
+        }
+        auto band = [&A](std::size_t i) { return A[i]; };
+        // Blocks short enough that the coupling between them does not underflow, and long enough that it does:
+        for (std::size_t min_block_rows : {1, 5, 200})
+        {
+            for (unsigned threads : {1, 2, 3, 8})
+            {
+                std::vector<Real> y = r;
+                boost::math::interpolators::detail::banded_solve<k>(band, y.data(), n, threads, min_block_rows);
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    BOOST_CHECK_SMALL(y[i] - x[i], 16*std::numeric_limits<Real>::epsilon());
+                }
+            }
+        }
+    }
+}
+
+template<class Real>
+void test_threaded_construction()
+{
+    std::cout << "Testing threaded and in place construction of cubic b splines on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    using std::sin;
+    // Enough points that the solve is split between threads:
+    std::vector<Real> v(70000);
+    Real x0 = 1;
+    Real step = Real(1)/128;
+    for (size_t i = 0; i < v.size(); ++i)
+    {
+        v[i] = sin(x0 + step * i);
+    }
+    boost::math::interpolators::cardinal_cubic_b_spline<Real> spline(v.begin(), v.end(), x0, step);
+    boost::math::interpolators::cardinal_cubic_b_spline<Real> threaded(v.begin(), v.end(), x0, step, std::numeric_limits<Real>::quiet_NaN(), std::numeric_limits<Real>::quiet_NaN(), 4);
+    boost::math::interpolators::cardinal_cubic_b_spline<Real> all_cores(v.data(), v.size(), x0, step, std::numeric_limits<Real>::quiet_NaN(), std::numeric_limits<Real>::quiet_NaN(), 0);
+    std::vector<Real> w;
+    w.reserve(v.size() + 2);
+    w = v;
+    boost::math::interpolators::cardinal_cubic_b_spline<Real> in_place(std::move(w), x0, step, Real(cos(x0)), std::numeric_limits<Real>::quiet_NaN(), 3);
+    boost::math::interpolators::cardinal_cubic_b_spline<Real> serial_in_place(std::vector<Real>(v), x0, step, Real(cos(x0)));
+    boost::math::interpolators::cardinal_cubic_b_spline<Real> given_derivative(v.data(), v.size(), x0, step, Real(cos(x0)));
+
+    Real tol = 64*std::numeric_limits<Real>::epsilon();
+    for (size_t i = 0; i < v.size(); i += 97)
+    {
+        for (Real x : {x0 + i*step, x0 + i*step + step/3})
+        {
+            BOOST_CHECK_SMALL(threaded(x) - spline(x), tol);
+            BOOST_CHECK_SMALL(all_cores(x) - spline(x), tol);
+            BOOST_CHECK_SMALL(threaded.prime(x) - spline.prime(x), tol/step);
+            BOOST_CHECK_SMALL(in_place(x) - given_derivative(x), tol);
+            BOOST_CHECK_SMALL(serial_in_place(x) - given_derivative(x), tol);
+            BOOST_CHECK_SMALL(in_place.double_prime(x) - given_derivative.double_prime(x), tol/(step*step));
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(test_cubic_b_spline)
 {
     test_b3_spline<float>();
@@ -348,4 +438,13 @@ BOOST_AUTO_TEST_CASE(test_cubic_b_spline)
 
     test_copy_move<double>();
     test_outside_interval<double>();
+
+    test_banded_solve<1, double>();
+    test_banded_solve<2, double>();
+    test_banded_solve<2, long double>();
+    test_banded_solve<1, cpp_bin_float_50>();
+
+    test_threaded_construction<float>();
+    test_threaded_construction<double>();
+    test_threaded_construction<long double>();
 }
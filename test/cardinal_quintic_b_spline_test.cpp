@@ -263,6 +263,42 @@ void test_quadratic_estimate_derivatives()
     }
 }
 
+template<class Real>
+void test_threaded_construction()
+{
+    using std::sin;
+    using std::cos;
+    // Enough points that the solve is split between threads:
+    Real t0 = 0;
+    Real h = Real(1)/Real(256);
+    size_t n = 70000;
+    std::vector<Real> y(n);
+    for (size_t i = 0; i < n; ++i) {
+        y[i] = sin(t0 + i*h);
+    }
+    std::pair<Real, Real> left_endpoint_derivatives{cos(t0), -sin(t0)};
+    auto qbs = cardinal_quintic_b_spline<Real>(y, t0, h);
+    auto threaded = cardinal_quintic_b_spline<Real>(y.data(), y.size(), t0, h, {std::numeric_limits<Real>::quiet_NaN(), std::numeric_limits<Real>::quiet_NaN()},
+                                                    {std::numeric_limits<Real>::quiet_NaN(), std::numeric_limits<Real>::quiet_NaN()}, 4);
+    auto given_derivatives = cardinal_quintic_b_spline<Real>(y.data(), y.size(), t0, h, left_endpoint_derivatives);
+    std::vector<Real> w;
+    w.reserve(n + 4);
+    w = y;
+    auto in_place = cardinal_quintic_b_spline<Real>(std::move(w), t0, h, left_endpoint_derivatives, {std::numeric_limits<Real>::quiet_NaN(), std::numeric_limits<Real>::quiet_NaN()}, 0);
+    auto serial_in_place = cardinal_quintic_b_spline<Real>(std::vector<Real>(y), t0, h);
+
+    Real tol = 64*std::numeric_limits<Real>::epsilon();
+    for (size_t i = 0; i < n - 1; i += 97) {
+        for (Real t : {t0 + i*h, t0 + i*h + h/3}) {
+            CHECK_ABSOLUTE_ERROR(qbs(t), threaded(t), tol);
+            CHECK_ABSOLUTE_ERROR(qbs.prime(t), threaded.prime(t), tol/h);
+            CHECK_ABSOLUTE_ERROR(qbs(t), serial_in_place(t), tol);
+            CHECK_ABSOLUTE_ERROR(given_derivatives(t), in_place(t), tol);
+            CHECK_ABSOLUTE_ERROR(given_derivatives.double_prime(t), in_place.double_prime(t), tol/(h*h));
+        }
+    }
+    CHECK_ULP_CLOSE(qbs.t_max(), in_place.t_max(), 0);
+}
 
 int main()
 {
@@ -285,6 +321,8 @@ int main()
     test_quadratic_estimate_derivatives<double>();
     test_quadratic_estimate_derivatives<long double>();
 
+    test_threaded_construction<double>();
+    test_threaded_construction<long double>();
 
     #ifdef BOOST_HAS_FLOAT128
         test_constant<float128>();
@@ -420,6 +420,141 @@ void test_cardinal_interpolation_condition()
 
 
 
+template<typename Real>
+void test_sliding_window()
+{
+    // A window of the most recent knots, in a buffer which fills up and then drops a knot for each pushed:
+    std::mt19937 gen(11);
+    std::uniform_real_distribution<Real> dis(Real(1)/4, 1);
+    std::size_t capacity = 20;
+    boost::circular_buffer<Real> x_buf(capacity);
+    boost::circular_buffer<Real> y_buf(capacity);
+    boost::circular_buffer<Real> dydx_buf(capacity);
+    std::vector<Real> x{0};
+    for (std::size_t i = 0; i < 5; ++i)
+    {
+        if (i > 0)
+        {
+            x.push_back(x.back() + dis(gen));
+        }
+        x_buf.push_back(x.back());
+        y_buf.push_back(dis(gen));
+        dydx_buf.push_back(dis(gen));
+    }
+    auto window = cubic_hermite<boost::circular_buffer<Real>>(std::move(x_buf), std::move(y_buf), std::move(dydx_buf));
+    std::vector<Real> y, dydx;
+    int64_t bytes = 0;
+    for (std::size_t i = 0; i < 10*capacity; ++i)
+    {
+        x.push_back(x.back() + dis(gen));
+        y.push_back(dis(gen));
+        dydx.push_back(dis(gen));
+        window.push_back(x.back(), y.back(), dydx.back());
+        if (i == capacity)
+        {
+            bytes = window.bytes();
+        }
+    }
+    // Once full, the memory used stays the same:
+    CHECK_EQUAL(bytes, window.bytes());
+    std::size_t first = x.size() - capacity;
+    CHECK_EQUAL(x[first], window.domain().first);
+    CHECK_EQUAL(x.back(), window.domain().second);
+    // The window agrees exactly with an interpolator built on the last knots:
+    std::vector<Real> x_last(x.begin() + first, x.end());
+    std::vector<Real> y_last(y.end() - capacity, y.end());
+    std::vector<Real> dydx_last(dydx.end() - capacity, dydx.end());
+    auto last = cubic_hermite<std::vector<Real>>(std::move(x_last), std::move(y_last), std::move(dydx_last));
+    std::size_t hint = 0;
+    for (Real t = x[first]; t <= x.back(); t += Real(1)/64)
+    {
+        CHECK_EQUAL(last(t), window(t));
+        CHECK_EQUAL(last.prime(t), window.prime(t));
+        CHECK_EQUAL(last(t), window(t, hint));
+    }
+    bool caught = false;
+    try
+    {
+        window(x[first - 1]);
+    }
+    catch (std::domain_error const &)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(true, caught);
+
+    // The containers must drop their knots together:
+    boost::circular_buffer<Real> x_short(4, Real(0));
+    boost::circular_buffer<Real> y_long(8);
+    boost::circular_buffer<Real> dydx_short(4, Real(0));
+    x_short[1] = 1; x_short[2] = 2; x_short[3] = 3;
+    y_long.push_back(0); y_long.push_back(0); y_long.push_back(0); y_long.push_back(0);
+    caught = false;
+    try
+    {
+        cubic_hermite<boost::circular_buffer<Real>>(std::move(x_short), std::move(y_long), std::move(dydx_short));
+    }
+    catch (std::domain_error const &)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(true, caught);
+}
+
+template<typename Real>
+void test_cardinal_sliding_window()
+{
+    Real x0 = Real(1)/3;
+    Real dx = Real(1)/7;
+    std::size_t capacity = 16;
+    boost::circular_buffer<Real> y_buf(capacity);
+    boost::circular_buffer<Real> dydx_buf(capacity);
+    boost::circular_buffer<std::array<Real, 2>> dat(capacity);
+    auto f = [](Real t) { return t*t; };
+    std::size_t n = 0;
+    for (; n < 4; ++n)
+    {
+        Real t = x0 + n*dx;
+        y_buf.push_back(f(t));
+        dydx_buf.push_back(2*t);
+        dat.push_back({f(t), 2*t});
+    }
+    auto window = cardinal_cubic_hermite<boost::circular_buffer<Real>>(std::move(y_buf), std::move(dydx_buf), x0, dx);
+    auto window_aos = cardinal_cubic_hermite_aos<boost::circular_buffer<std::array<Real, 2>>>(std::move(dat), x0, dx);
+    int64_t bytes = 0;
+    for (; n < 200; ++n)
+    {
+        if (n == capacity)
+        {
+            bytes = window.bytes();
+        }
+        Real t = x0 + n*dx;
+        window.push_back(f(t), 2*t);
+        window_aos.push_back(f(t), 2*t);
+        // Before the buffer is full, the domain grows; after, it slides right by dx with each push:
+        std::size_t dropped = n + 1 > capacity ? n + 1 - capacity : 0;
+        CHECK_EQUAL(x0 + dropped*dx, window.domain().first);
+        CHECK_EQUAL(x0 + dropped*dx, window_aos.domain().first);
+    }
+    CHECK_EQUAL(bytes, window.bytes());
+    // Cubic Hermite interpolation reproduces quadratics:
+    for (Real t = window.domain().first; t <= window.domain().second; t += Real(1)/64)
+    {
+        CHECK_ULP_CLOSE(f(t), window(t), 256);
+        CHECK_ULP_CLOSE(2*t, window.prime(t), 1024);
+        CHECK_ULP_CLOSE(f(t), window_aos(t), 256);
+        CHECK_ULP_CLOSE(2*t, window_aos.prime(t), 1024);
+    }
+
+    // With a container which grows, the left endpoint stays put:
+    std::vector<Real> y{f(x0), f(x0 + dx)};
+    std::vector<Real> dydx{2*x0, 2*(x0 + dx)};
+    auto growing = cardinal_cubic_hermite<std::vector<Real>>(std::move(y), std::move(dydx), x0, dx);
+    growing.push_back(f(x0 + 2*dx), 2*(x0 + 2*dx));
+    CHECK_EQUAL(x0, growing.domain().first);
+    CHECK_ULP_CLOSE(f(x0 + dx + dx/2), growing(x0 + dx + dx/2), 16);
+}
+
 int main()
 {
     test_constant<float>();
@@ -430,6 +565,8 @@ int main()
     test_cardinal_linear<float>();
     test_cardinal_quadratic<float>();
     test_cardinal_interpolation_condition<float>();
+    test_sliding_window<float>();
+    test_cardinal_sliding_window<float>();
 
     test_constant<double>();
     test_linear<double>();
@@ -439,6 +576,8 @@ int main()
     test_cardinal_linear<double>();
     test_cardinal_quadratic<double>();
     test_cardinal_interpolation_condition<double>();
+    test_sliding_window<double>();
+    test_cardinal_sliding_window<double>();
 
     test_constant<long double>();
     test_linear<long double>();
@@ -0,0 +1,198 @@
+/*
+ * Copyright 2020 Boost.Math contributors
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include <boost/math/distributions/binomial.hpp>
+#include <boost/math/distributions/hypergeometric.hpp>
+#include <boost/math/distributions/negative_binomial.hpp>
+#include <boost/math/distributions/poisson.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::math::binomial_distribution;
+using boost::math::hypergeometric_distribution;
+using boost::math::negative_binomial_distribution;
+using boost::math::poisson_distribution;
+using boost::multiprecision::cpp_bin_float_50;
+
+// The scalar functions themselves are not always accurate to a few ulp (the binomial pdf at
+// k = 0 is computed as pow(1 - p, n) for example) so compare against the same distribution
+// evaluated in a much wider type:
+template<class Real, class Reference>
+void check_values(std::vector<Real> const & computed, std::vector<Reference> const & expected, int ulps)
+{
+    CHECK_EQUAL(computed.size(), expected.size());
+    for (std::size_t i = 0; i < computed.size() && i < expected.size(); ++i)
+    {
+        Real e = static_cast<Real>(expected[i]);
+        if (e >= (std::numeric_limits<Real>::min)())
+        {
+            CHECK_ULP_CLOSE(e, computed[i], ulps);
+        }
+        else
+        {
+            CHECK_LE(computed[i], 2 * (std::numeric_limits<Real>::min)());
+        }
+    }
+}
+
+template<class Distribution, class ReferenceDistribution, class K>
+void check_ranges(Distribution const & dist, ReferenceDistribution const & reference, K k0, K k1)
+{
+    using Real = typename Distribution::value_type;
+    using Reference = typename ReferenceDistribution::value_type;
+    std::vector<Reference> p, c, q;
+    for (K k = k0; k <= k1; ++k)
+    {
+        p.push_back(pdf(reference, static_cast<Reference>(k)));
+        c.push_back(cdf(reference, static_cast<Reference>(k)));
+        q.push_back(cdf(complement(reference, static_cast<Reference>(k))));
+    }
+    std::vector<Real> computed(p.size());
+    auto end = pdf_range(dist, k0, k1, computed.begin());
+    CHECK_EQUAL(static_cast<std::size_t>(end - computed.begin()), p.size());
+    check_values(computed, p, 32);
+    cdf_range(dist, k0, k1, computed.begin());
+    check_values(computed, c, 32);
+    cdf_range(complement(dist, k0), k1, computed.begin());
+    check_values(computed, q, 32);
+}
+
+template<class Real, class Reference>
+void test_binomial()
+{
+    for (Real p : { Real(0.3), Real(0.01), Real(0.97) })
+    {
+        binomial_distribution<Real> dist(1000, p);
+        binomial_distribution<Reference> reference(1000, p);
+        check_ranges(dist, reference, Real(0), Real(1000));
+        check_ranges(dist, reference, Real(700), Real(800));
+        check_ranges(dist, reference, Real(5), Real(5));
+    }
+    binomial_distribution<Real> dist(100000, Real(0.125));
+    binomial_distribution<Reference> reference(100000, Real(0.125));
+    check_ranges(dist, reference, Real(11500), Real(13500));
+    // Degenerate success fractions:
+    for (Real p : { Real(0), Real(1) })
+    {
+        binomial_distribution<Real> d(20, p);
+        std::vector<Real> v(21);
+        pdf_range(d, 0, 20, v.begin());
+        for (int k = 0; k <= 20; ++k)
+        {
+            CHECK_EQUAL(pdf(d, Real(k)), v[k]);
+        }
+    }
+}
+
+template<class Real, class Reference>
+void test_poisson()
+{
+    for (Real mean : { Real(0.5), Real(7.25), Real(250), Real(5000) })
+    {
+        poisson_distribution<Real> dist(mean);
+        poisson_distribution<Reference> reference(mean);
+        check_ranges(dist, reference, Real(0), Real(std::floor(mean + 40 * std::sqrt(mean) + 40)));
+    }
+    // Entirely in one tail or the other:
+    poisson_distribution<Real> dist(250);
+    poisson_distribution<Reference> reference(250);
+    check_ranges(dist, reference, Real(20), Real(150));
+    check_ranges(dist, reference, Real(400), Real(500));
+    // Far enough into the tail that the pdf underflows:
+    check_ranges(dist, reference, Real(0), Real(3000));
+}
+
+template<class Real, class Reference>
+void test_negative_binomial()
+{
+    for (Real r : { Real(0.5), Real(1), Real(20), Real(1000) })
+    {
+        for (Real p : { Real(0.3), Real(0.9) })
+        {
+            negative_binomial_distribution<Real> dist(r, p);
+            negative_binomial_distribution<Reference> reference(r, p);
+            check_ranges(dist, reference, Real(0), static_cast<Real>(floor(mean(reference) + 20 * standard_deviation(reference) + 50)));
+        }
+    }
+}
+
+template<class Real, class Reference>
+void test_hypergeometric()
+{
+    hypergeometric_distribution<Real> dist(50, 100, 500);
+    hypergeometric_distribution<Reference> reference(50, 100, 500);
+    check_ranges(dist, reference, 0u, 50u);
+    check_ranges(dist, reference, 30u, 40u);
+    // Support starts at n + r - N = 200:
+    hypergeometric_distribution<Real> dist2(300, 400, 500);
+    hypergeometric_distribution<Reference> reference2(300, 400, 500);
+    check_ranges(dist2, reference2, 200u, 300u);
+    std::vector<Real> v;
+    cdf_range(complement(dist2, 250), 260u, std::back_inserter(v));
+    CHECK_EQUAL(v.size(), std::size_t(11));
+}
+
+void test_error_handling()
+{
+    binomial_distribution<double> dist(20, 0.25);
+    std::vector<double> v(30);
+    bool thrown = false;
+    try
+    {
+        pdf_range(dist, 1.5, 10, v.begin());
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+    thrown = false;
+    try
+    {
+        cdf_range(dist, 0, 21, v.begin());
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+    thrown = false;
+    try
+    {
+        cdf_range(complement(hypergeometric_distribution<double>(50, 100, 500), -1), 10u, v.begin());
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+    // An empty range writes nothing:
+    auto end = pdf_range(poisson_distribution<double>(3), 5, 4, v.begin());
+    CHECK_EQUAL(end == v.begin(), true);
+}
+
+template<class Real, class Reference>
+void test_all()
+{
+    test_binomial<Real, Reference>();
+    test_poisson<Real, Reference>();
+    test_negative_binomial<Real, Reference>();
+    test_hypergeometric<Real, Reference>();
+}
+
+int main()
+{
+    test_all<float, double>();
+    test_all<double, cpp_bin_float_50>();
+    test_error_handling();
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright 2020 Boost.Math contributors
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <list>
+#include <random>
+#include <vector>
+#include <limits>
+#include <boost/math/special_functions/erf.hpp>
+
+using boost::math::policies::policy;
+using boost::math::policies::promote_double;
+
+template<class Real>
+void test_erf_erfc()
+{
+    std::mt19937_64 gen(12345);
+    std::uniform_real_distribution<Real> dis(-26, 26);
+    std::vector<Real> z(5000);
+    for (auto & t : z)
+    {
+        t = dis(gen);
+    }
+    // Hit every interval boundary of the rational approximations, plus some tiny values:
+    std::vector<Real> special{0, Real(1e-12), Real(-1e-300), Real(0.5), Real(-0.5), Real(1.5), Real(2.5), Real(4.5), Real(5.8), Real(27.9), Real(28), Real(-28), Real(40)};
+    z.insert(z.end(), special.begin(), special.end());
+
+    std::vector<Real> y(z.size());
+    std::vector<Real> yc(z.size());
+    auto it = boost::math::erf(z.begin(), z.end(), y.begin());
+    CHECK_EQUAL(it == y.end(), true);
+    boost::math::erfc(z.cbegin(), z.cend(), yc.begin());
+
+    for (size_t i = 0; i < z.size(); ++i)
+    {
+        long double expected = boost::math::erf(static_cast<long double>(z[i]));
+        CHECK_ULP_CLOSE(expected, y[i], 3);
+        expected = boost::math::erfc(static_cast<long double>(z[i]));
+        if (expected > (std::numeric_limits<Real>::min)())
+        {
+            // Same error as the scalar 53-bit version: dominated by exp(-z*z) for large z.
+            CHECK_ULP_CLOSE(expected, yc[i], 4);
+        }
+        // Same approximations as the non-promoting scalar version:
+        CHECK_ULP_CLOSE(boost::math::erf(z[i], policy<promote_double<false>>()), y[i], 2);
+    }
+    CHECK_EQUAL(yc.back(), Real(0));
+    CHECK_EQUAL(y.back(), Real(1));
+}
+
+template<class Real>
+void test_inverses()
+{
+    std::mt19937_64 gen(54321);
+    std::uniform_real_distribution<Real> dis(-1, 1);
+    std::vector<Real> z(5000);
+    for (auto & t : z)
+    {
+        t = dis(gen);
+    }
+    // Into the tails as far as 1 - q is representable:
+    for (Real q = Real(0.25); q > std::numeric_limits<Real>::epsilon(); q /= 7)
+    {
+        z.push_back(1 - q);
+        z.push_back(q - 1);
+    }
+    z.push_back(0);
+
+    std::vector<Real> x(z.size());
+    boost::math::erf_inv(z.begin(), z.end(), x.begin());
+    for (size_t i = 0; i < z.size(); ++i)
+    {
+        long double expected = boost::math::erf_inv(static_cast<long double>(z[i]));
+        CHECK_ULP_CLOSE(expected, x[i], 3);
+    }
+
+    // erfc_inv goes all the way down to subnormal arguments:
+    std::vector<Real> w;
+    for (Real q = Real(1.99); q > (std::numeric_limits<Real>::denorm_min)(); q /= 3)
+    {
+        w.push_back(q);
+        if (2 - q != 2)
+        {
+            w.push_back(2 - q);
+        }
+    }
+    x.resize(w.size());
+    boost::math::erfc_inv(w.begin(), w.end(), x.begin());
+    for (size_t i = 0; i < w.size(); ++i)
+    {
+        long double expected = boost::math::erfc_inv(static_cast<long double>(w[i]));
+        CHECK_ULP_CLOSE(expected, x[i], 3);
+    }
+}
+
+template<class Real>
+void test_generic_path()
+{
+    // Non-contiguous input and a type that goes through the scalar loop:
+    std::list<Real> z{Real(-3), Real(-0.25), Real(0), Real(0.75), Real(2), Real(9)};
+    std::vector<Real> y(z.size());
+    boost::math::erfc(z.begin(), z.end(), y.begin());
+    size_t i = 0;
+    for (auto t : z)
+    {
+        CHECK_ULP_CLOSE(boost::math::erfc(t), y[i++], 0);
+    }
+}
+
+void test_error_handling()
+{
+    std::vector<double> z{std::numeric_limits<double>::quiet_NaN(), 0.5, 1.5, 1.0, -1.0};
+    std::vector<double> y(z.size());
+    boost::math::erf(z.begin(), z.begin() + 2, y.begin());
+    CHECK_NAN(y[0]);
+    bool thrown = false;
+    try
+    {
+        boost::math::erf_inv(z.begin() + 1, z.begin() + 3, y.begin());
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+    thrown = false;
+    try
+    {
+        boost::math::erf_inv(z.begin() + 3, z.end(), y.begin());
+    }
+    catch (const std::overflow_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+}
+
+int main()
+{
+    test_erf_erfc<float>();
+    test_erf_erfc<double>();
+    test_inverses<float>();
+    test_inverses<double>();
+    test_generic_path<long double>();
+    test_error_handling();
+    return boost::math::test::report_errors();
+}
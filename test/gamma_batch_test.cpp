@@ -0,0 +1,173 @@
+/*
+ * Copyright 2020 Boost.Math contributors
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <list>
+#include <random>
+#include <vector>
+#include <limits>
+#include <boost/math/special_functions/gamma.hpp>
+
+template<class Real>
+std::vector<Real> gamma_test_arguments(Real a, Real b)
+{
+    std::mt19937_64 gen(12345);
+    std::uniform_real_distribution<Real> dis(a, b);
+    std::vector<Real> z(3000);
+    for (auto & t : z)
+    {
+        t = dis(gen);
+    }
+    return z;
+}
+
+template<class Real>
+void test_tgamma(Real max_z)
+{
+    auto z = gamma_test_arguments<Real>(0, max_z);
+    // Integers, tiny values and either side of the split in the power term:
+    std::vector<Real> special{1, 2, 3, 10, 34, Real(1e-10), Real(1e-30), Real(0.5)};
+    if (max_z > 170)
+    {
+        special.insert(special.end(), {Real(140), Real(140.5), Real(141.25), Real(170.5)});
+    }
+    z.insert(z.end(), special.begin(), special.end());
+
+    std::vector<Real> y(z.size());
+    auto it = boost::math::tgamma(z.begin(), z.end(), y.begin());
+    CHECK_EQUAL(it == y.end(), true);
+    for (size_t i = 0; i < z.size(); ++i)
+    {
+        long double expected = boost::math::tgamma(static_cast<long double>(z[i]));
+        if (expected < (std::numeric_limits<Real>::max)())
+        {
+            // Comparable to the scalar version evaluated in double, which is up to 6 ulp:
+            CHECK_ULP_CLOSE(expected, y[i], 8);
+        }
+    }
+    CHECK_EQUAL(y[z.size() - special.size() + 3], Real(362880));
+}
+
+template<class Real>
+void test_lgamma()
+{
+    auto z = gamma_test_arguments<Real>(0, 20);
+    auto large = gamma_test_arguments<Real>(20, 1e6);
+    z.insert(z.end(), large.begin(), large.end());
+    std::vector<Real> special{1, 2, 3, Real(1.5), Real(0.999), Real(2.001), Real(14.99), 15, 100, Real(1e-20), Real(1e20)};
+    z.insert(z.end(), special.begin(), special.end());
+
+    std::vector<Real> y(z.size());
+    auto it = boost::math::lgamma(z.cbegin(), z.cend(), y.begin());
+    CHECK_EQUAL(it == y.end(), true);
+    for (size_t i = 0; i < z.size(); ++i)
+    {
+        long double expected = boost::math::lgamma(static_cast<long double>(z[i]));
+        // Near the roots at 1 and 2 only a small absolute error is possible:
+        CHECK_MOLLIFIED_CLOSE(expected, y[i], 8 * std::numeric_limits<Real>::epsilon());
+    }
+    CHECK_EQUAL(y[z.size() - special.size()], Real(0));
+    CHECK_EQUAL(y[z.size() - special.size() + 1], Real(0));
+}
+
+template<class Real>
+void test_tgamma_ratio(Real max_z)
+{
+    auto a = gamma_test_arguments<Real>(0, max_z);
+    std::vector<Real> b(a.rbegin(), a.rend());
+    // Beyond the factorial table, where tgamma_ratio uses a different method:
+    a.push_back(500);
+    b.push_back(Real(499.5));
+    a.push_back(Real(0.5));
+    b.push_back(200);
+
+    std::vector<Real> y(a.size());
+    auto it = boost::math::tgamma_ratio(a.begin(), a.end(), b.begin(), y.begin());
+    CHECK_EQUAL(it == y.end(), true);
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        long double expected = boost::math::tgamma_ratio(static_cast<long double>(a[i]), static_cast<long double>(b[i]));
+        if ((expected < (std::numeric_limits<Real>::max)()) && (expected > (std::numeric_limits<Real>::min)()))
+        {
+            CHECK_ULP_CLOSE(expected, y[i], 16);
+        }
+    }
+    CHECK_ULP_CLOSE(boost::math::tgamma_ratio(Real(500), Real(499.5)), y[a.size() - 2], 0);
+}
+
+template<class Real>
+void test_generic_path()
+{
+    std::list<Real> z{Real(0.25), Real(1), Real(2.5), Real(12), Real(250)};
+    std::vector<Real> y(z.size());
+    std::vector<Real> l(z.size());
+    boost::math::tgamma(z.begin(), z.end(), y.begin());
+    boost::math::lgamma(z.begin(), z.end(), l.begin());
+    size_t i = 0;
+    for (auto t : z)
+    {
+        CHECK_ULP_CLOSE(boost::math::tgamma(t), y[i], 0);
+        CHECK_ULP_CLOSE(boost::math::lgamma(t), l[i], 0);
+        ++i;
+    }
+}
+
+void test_error_handling()
+{
+    // Negative and non-finite arguments go through the scalar versions:
+    std::vector<double> z{-2.5, -0.5, -30.25, std::numeric_limits<double>::quiet_NaN(), -2.0};
+    std::vector<double> y(z.size());
+    boost::math::tgamma(z.begin(), z.begin() + 3, y.begin());
+    for (size_t i = 0; i < 3; ++i)
+    {
+        CHECK_ULP_CLOSE(boost::math::tgamma(z[i]), y[i], 0);
+    }
+    boost::math::lgamma(z.begin(), z.begin() + 3, y.begin());
+    for (size_t i = 0; i < 3; ++i)
+    {
+        CHECK_ULP_CLOSE(boost::math::lgamma(z[i]), y[i], 0);
+    }
+    bool thrown = false;
+    try
+    {
+        boost::math::tgamma(z.begin() + 3, z.end(), y.begin());
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+
+    std::vector<float> big{30, 36};
+    std::vector<float> fy(big.size());
+    thrown = false;
+    try
+    {
+        boost::math::tgamma(big.begin(), big.end(), fy.begin());
+    }
+    catch (const std::overflow_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+
+    // The three argument overload must not be chosen for the incomplete gamma function:
+    CHECK_ULP_CLOSE(boost::math::tgamma(2.0, 1.0, boost::math::policies::policy<>()), 2 * std::exp(-1.0), 2);
+}
+
+int main()
+{
+    test_tgamma<float>(35);
+    test_tgamma<double>(171.5);
+    test_lgamma<float>();
+    test_lgamma<double>();
+    test_tgamma_ratio<float>(30);
+    test_tgamma_ratio<double>(170);
+    test_generic_path<long double>();
+    test_error_handling();
+    return boost::math::test::report_errors();
+}
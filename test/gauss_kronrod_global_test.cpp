@@ -0,0 +1,168 @@
+/*
+ * Copyright 2020 Boost.Math contributors
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <atomic>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <stdexcept>
+#include <boost/math/quadrature/gauss_kronrod.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::math::quadrature::gauss_kronrod;
+using boost::math::quadrature::gauss_kronrod_statistics;
+using boost::math::constants::pi;
+using boost::math::constants::half_pi;
+using boost::multiprecision::cpp_bin_float_50;
+
+template<class Real, unsigned N>
+void test_known_integrals()
+{
+    using std::sqrt;
+    using std::exp;
+    using std::log;
+    using std::abs;
+    Real tol = boost::math::tools::root_epsilon<Real>();
+    Real inf = std::numeric_limits<Real>::infinity();
+    Real error, L1;
+    gauss_kronrod_statistics stats;
+
+    // A peak that the recursive bisection over-refines around:
+    auto f = [](Real x)->Real { return 1 / (x * x + Real(1) / 10000); };
+    Real Q = gauss_kronrod<Real, N>::integrate_global(f, Real(-1), Real(1), 1000, tol, &error, &L1, &stats);
+    Real expected = 200 * atan(Real(100));
+    CHECK_MOLLIFIED_CLOSE(expected, Q, 10 * tol);
+    CHECK_LE(error, abs(Q * tol));
+    CHECK_ULP_CLOSE(Q, L1, 8);
+    // Every bisection replaces one interval by two, and evaluates both of them:
+    CHECK_EQUAL(stats.evaluations, N * (2 * stats.intervals - 1));
+    CHECK_LE(std::size_t(2), stats.intervals);
+    CHECK_LE(1u, stats.depth);
+
+    // Reversed limits:
+    Real Q2 = gauss_kronrod<Real, N>::integrate_global(f, Real(1), Real(-1), 1000, tol);
+    CHECK_EQUAL(-Q, Q2);
+    Q2 = gauss_kronrod<Real, N>::integrate_global(f, Real(1), Real(1));
+    CHECK_EQUAL(Real(0), Q2);
+
+    // Infinite and semi-infinite ranges:
+    auto g = [](Real x)->Real { return exp(-x * x / 2); };
+    Q = gauss_kronrod<Real, N>::integrate_global(g, -inf, inf, 1000, tol);
+    CHECK_MOLLIFIED_CLOSE(sqrt(2 * pi<Real>()), Q, 10 * tol);
+    Q = gauss_kronrod<Real, N>::integrate_global(g, Real(0), inf, 1000, tol, &error, &L1);
+    CHECK_MOLLIFIED_CLOSE(sqrt(half_pi<Real>()), Q, 10 * tol);
+    CHECK_ULP_CLOSE(Q, L1, 8);
+    Q = gauss_kronrod<Real, N>::integrate_global(g, -inf, Real(0), 1000, tol);
+    CHECK_MOLLIFIED_CLOSE(sqrt(half_pi<Real>()), Q, 10 * tol);
+
+    // An integrable singularity at the end point, where the error can't be met before the
+    // intervals next to it become too small to bisect:
+    auto h = [](Real x)->Real { return x == 0 ? Real(0) : Real(log(x)); };
+    Q = gauss_kronrod<Real, N>::integrate_global(h, Real(0), Real(1), 100000, tol, &error, nullptr, &stats);
+    CHECK_MOLLIFIED_CLOSE(Real(-1), Q, sqrt(tol));
+    CHECK_LE(stats.intervals, std::size_t(100000));
+
+    // max_intervals is respected:
+    Q = gauss_kronrod<Real, N>::integrate_global(h, Real(0), Real(1), 7, tol, &error, nullptr, &stats);
+    CHECK_EQUAL(stats.intervals, std::size_t(7));
+    CHECK_LE(abs(Q + 1), 2 * error);
+}
+
+template<class Real>
+void test_against_recursive()
+{
+    using std::sqrt;
+    Real tol = boost::math::tools::root_epsilon<Real>();
+    Real error;
+    gauss_kronrod_statistics global_stats, recursive_stats;
+    auto f = [](Real x)->Real { return sqrt(x) / (1 + x * x); };
+    Real Q1 = gauss_kronrod<Real, 15>::integrate(f, Real(0), Real(20), 30, tol, &error, nullptr, &recursive_stats);
+    Real Q2 = gauss_kronrod<Real, 15>::integrate_global(f, Real(0), Real(20), 1000, tol, &error, nullptr, &global_stats);
+    CHECK_MOLLIFIED_CLOSE(Q1, Q2, 10 * tol);
+    CHECK_EQUAL(recursive_stats.evaluations, 15 * (2 * recursive_stats.intervals - 1));
+    // The recursive version splits the tolerance between both halves of each interval:
+    CHECK_LE(global_stats.evaluations, recursive_stats.evaluations);
+}
+
+template<class Real>
+void test_threads()
+{
+    using std::exp;
+    using std::sin;
+    Real tol = boost::math::tools::root_epsilon<Real>();
+    std::atomic<std::size_t> calls(0);
+    auto f = [&calls](Real x)->Real { ++calls; return exp(-x) * sin(50 * x) / (1 + x * x); };
+    Real error1, error2, L1, L2;
+    gauss_kronrod_statistics stats1, stats2;
+    Real Q1 = gauss_kronrod<Real, 21>::integrate_global(f, Real(0), Real(4), 5000, tol, &error1, &L1, &stats1);
+    CHECK_EQUAL(calls.load(), stats1.evaluations);
+    calls = 0;
+    Real Q2 = gauss_kronrod<Real, 21>::integrate_global(f, Real(0), Real(4), 5000, tol, &error2, &L2, &stats2, 4);
+    CHECK_EQUAL(calls.load(), stats2.evaluations);
+    CHECK_MOLLIFIED_CLOSE(Q1, Q2, 10 * tol);
+    CHECK_LE(error2, std::abs(Q2 * tol));
+    // The result depends upon the number of threads, but never on their timing:
+    for (unsigned i = 0; i < 5; ++i)
+    {
+        Real error3, L3;
+        gauss_kronrod_statistics stats3;
+        Real Q3 = gauss_kronrod<Real, 21>::integrate_global(f, Real(0), Real(4), 5000, tol, &error3, &L3, &stats3, 4);
+        CHECK_EQUAL(Q2, Q3);
+        CHECK_EQUAL(error2, error3);
+        CHECK_EQUAL(L2, L3);
+        CHECK_EQUAL(stats2.intervals, stats3.intervals);
+    }
+    // Asking for one thread per core works too:
+    Real Q4 = gauss_kronrod<Real, 21>::integrate_global(f, Real(0), Real(4), 5000, tol, nullptr, nullptr, nullptr, 0);
+    CHECK_MOLLIFIED_CLOSE(Q1, Q4, 10 * tol);
+
+    // Exceptions thrown by the integrand reach the caller:
+    auto g = [](Real x)->Real { if (x > 3) { throw std::domain_error("x > 3"); } return x; };
+    bool caught = false;
+    try
+    {
+        gauss_kronrod<Real, 21>::integrate_global(g, Real(0), Real(4), 5000, tol, nullptr, nullptr, nullptr, 4);
+    }
+    catch (const std::domain_error&)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(caught, true);
+}
+
+template<class Complex>
+void test_complex()
+{
+    typedef typename Complex::value_type Real;
+    using std::exp;
+    using std::cos;
+    using std::sin;
+    // Si(z) as in the tanh_sinh docs:
+    Complex z(2, 1);
+    auto f = [&z](Real t)->Complex { return -exp(-z * cos(t)) * cos(z * sin(t)); };
+    Complex Q1 = gauss_kronrod<Real, 15>::integrate(f, Real(0), half_pi<Real>(), 15, Real(1e-12));
+    Complex Q2 = gauss_kronrod<Real, 15>::integrate_global(f, Real(0), half_pi<Real>(), 1000, Real(1e-12), nullptr, nullptr, nullptr, 2);
+    CHECK_MOLLIFIED_CLOSE(Q1.real(), Q2.real(), Real(1e-12));
+    CHECK_MOLLIFIED_CLOSE(Q1.imag(), Q2.imag(), Real(1e-12));
+}
+
+int main()
+{
+    test_known_integrals<double, 15>();
+    test_known_integrals<double, 21>();
+    test_known_integrals<double, 31>();
+    test_known_integrals<double, 61>();
+    test_known_integrals<long double, 31>();
+    test_known_integrals<cpp_bin_float_50, 61>();
+    test_against_recursive<double>();
+    test_against_recursive<long double>();
+    test_threads<double>();
+    test_complex<std::complex<double> >();
+    return boost::math::test::report_errors();
+}
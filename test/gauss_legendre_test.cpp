@@ -0,0 +1,138 @@
+/*
+ * Copyright 2020 Boost.Math contributors
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <array>
+#include <cmath>
+#include <limits>
+#include <boost/math/quadrature/gauss_legendre.hpp>
+#include <boost/math/quadrature/gauss.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::math::quadrature::gauss;
+using boost::math::quadrature::gauss_legendre;
+using boost::math::constants::pi;
+using boost::multiprecision::cpp_bin_float_50;
+
+// The rules computed at runtime should agree with the tabulated ones:
+template<class Real, unsigned N>
+void test_against_tables(int weight_ulps)
+{
+    typedef gauss<Real, N> tabulated;
+    gauss_legendre<Real> rule(N);
+    CHECK_EQUAL(std::size_t(N), rule.points());
+    CHECK_EQUAL(tabulated::abscissa().size(), rule.abscissa().size());
+    CHECK_EQUAL(tabulated::weights().size(), rule.weights().size());
+    for (std::size_t i = 0; i < rule.abscissa().size(); ++i)
+    {
+        if (tabulated::abscissa()[i] == 0)
+        {
+            CHECK_EQUAL(Real(0), rule.abscissa()[i]);
+        }
+        else
+        {
+            CHECK_ULP_CLOSE(tabulated::abscissa()[i], rule.abscissa()[i], 2);
+        }
+        CHECK_ULP_CLOSE(tabulated::weights()[i], rule.weights()[i], weight_ulps);
+    }
+}
+
+template<class Real>
+void test_high_order()
+{
+    using std::pow;
+    using std::cos;
+    using std::sin;
+    using std::exp;
+    for (std::size_t n : { 1, 2, 3, 99, 100, 301 })
+    {
+        gauss_legendre<Real> rule(n);
+        // The weights sum to 2:
+        Real sum = 0;
+        for (std::size_t i = 0; i < rule.weights().size(); ++i)
+        {
+            sum += ((n & 1) && (i == 0)) ? rule.weights()[i] : 2 * rule.weights()[i];
+            CHECK_LE(Real(0), rule.abscissa()[i]);
+            CHECK_LE(rule.abscissa()[i], Real(1));
+            if (i)
+            {
+                CHECK_LE(rule.abscissa()[i - 1], rule.abscissa()[i]);
+            }
+        }
+        CHECK_ULP_CLOSE(Real(2), sum, 4);
+
+        // Polynomials of degree up to 2n - 1 are integrated exactly, up to the rounding of the
+        // nodes, which x^k magnifies k times:
+        for (unsigned k : { 0u, 1u, unsigned(n - 1), unsigned(2 * n - 2), unsigned(2 * n - 1) })
+        {
+            Real Q = rule.integrate([k](Real x)->Real { return pow(x, k); }, Real(0), Real(1));
+            CHECK_ULP_CLOSE(Real(1) / (k + 1), Q, k + 4);
+        }
+    }
+
+    // Resolving many oscillations with a single rule:
+    gauss_legendre<Real> rule(200);
+    Real L1;
+    Real Q = rule.integrate([](Real x)->Real { return cos(x); }, Real(0), Real(100), &L1);
+    // The integral cancels heavily, so the error is relative to the L1 norm:
+    CHECK_ABSOLUTE_ERROR(sin(Real(100)), Q, 10 * std::numeric_limits<Real>::epsilon() * L1);
+    CHECK_LE(abs(Q), L1);
+
+    // Reversed, empty and infinite ranges, as for gauss<Real, N>:
+    Real Q2 = rule.integrate([](Real x)->Real { return cos(x); }, Real(100), Real(0));
+    CHECK_EQUAL(-Q, Q2);
+    Q2 = rule.integrate([](Real x)->Real { return cos(x); }, Real(1), Real(1));
+    CHECK_EQUAL(Real(0), Q2);
+    Real inf = std::numeric_limits<Real>::infinity();
+    Q = rule.integrate([](Real x)->Real { return 1 / (1 + x * x); }, -inf, inf);
+    CHECK_MOLLIFIED_CLOSE(pi<Real>(), Q, 100 * std::numeric_limits<Real>::epsilon());
+
+    // And with vector valued integrands:
+    auto f = [](Real x) { std::array<Real, 2> r = { { cos(x), sin(x) } }; return r; };
+    std::array<Real, 2> Qv = rule.integrate(f, Real(0), Real(100));
+    // The vector and scalar sums may contract to fused multiply-adds differently, and both integrals
+    // cancel heavily, so they agree to a few ulps rather than exactly:
+    CHECK_ULP_CLOSE(rule.integrate([](Real x)->Real { return cos(x); }, Real(0), Real(100)), Qv[0], 16);
+    CHECK_ULP_CLOSE(rule.integrate([](Real x)->Real { return sin(x); }, Real(0), Real(100)), Qv[1], 16);
+}
+
+void test_cache()
+{
+    // Rules with the same number of points share their tables:
+    gauss_legendre<double> r1(123), r2(123), r3(124);
+    CHECK_EQUAL(&r1.abscissa(), &r2.abscissa());
+    CHECK_EQUAL(&r1.weights(), &r2.weights());
+    CHECK_EQUAL(false, &r1.abscissa() == &r3.abscissa());
+    // And copies share them too:
+    gauss_legendre<double> r4 = r1;
+    CHECK_EQUAL(&r1.abscissa(), &r4.abscissa());
+}
+
+int main()
+{
+    // float and double rules are computed in long double, and the others polished on the
+    // three term recurrence, so all are accurate to a few ulp:
+    test_against_tables<float, 7>(8);
+    test_against_tables<float, 30>(8);
+    test_against_tables<double, 7>(8);
+    test_against_tables<double, 10>(8);
+    test_against_tables<double, 15>(8);
+    test_against_tables<double, 20>(8);
+    test_against_tables<double, 25>(8);
+    test_against_tables<double, 30>(8);
+    test_against_tables<long double, 15>(8);
+    test_against_tables<long double, 30>(8);
+    test_against_tables<cpp_bin_float_50, 10>(8);
+    test_against_tables<cpp_bin_float_50, 25>(8);
+    test_high_order<float>();
+    test_high_order<double>();
+    test_high_order<long double>();
+    test_high_order<cpp_bin_float_50>();
+    test_cache();
+    return boost::math::test::report_errors();
+}
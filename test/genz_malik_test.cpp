@@ -0,0 +1,192 @@
+/*
+ * Copyright 2020 Boost.Math contributors
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <boost/math/quadrature/genz_malik.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/special_functions/erf.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::math::quadrature::genz_malik;
+using boost::math::quadrature::genz_malik_statistics;
+using boost::math::constants::pi;
+using boost::multiprecision::cpp_bin_float_50;
+
+template<class Real>
+void test_polynomials()
+{
+    using std::pow;
+    // The rule integrates polynomials of degree 7 exactly, so that one region suffices:
+    for (std::size_t n = 1; n <= 5; ++n)
+    {
+        std::vector<std::pair<Real, Real>> bounds(n, std::make_pair(Real(0), Real(2)));
+        auto f = [](std::vector<Real> const & x)->Real {
+            Real y = 1 + x[0] + pow(x[0], 7);
+            if (x.size() > 1)
+            {
+                y += pow(x[0], 3) * pow(x[1], 4);
+            }
+            if (x.size() > 2)
+            {
+                y += x[0] * x[1] * x[2] * pow(x[2], 2) * x[1];
+            }
+            return y;
+        };
+        // The exact values are sums of products of the integrals of x^k over [0, 2], 2^(k+1)/(k+1):
+        auto moment = [](int k) { return pow(Real(2), k + 1) / (k + 1); };
+        Real volume = pow(Real(2), static_cast<Real>(n));
+        Real expected = volume * (1 + moment(1) / 2 + moment(7) / 2);
+        if (n > 1)
+        {
+            expected += volume * moment(3) * moment(4) / 4;
+        }
+        if (n > 2)
+        {
+            expected += volume * moment(1) * moment(2) * moment(3) / 8;
+        }
+        Real error;
+        genz_malik_statistics stats;
+        Real Q = genz_malik<Real>::integrate(f, bounds, 1, boost::math::tools::root_epsilon<Real>(), &error, nullptr, &stats);
+        CHECK_ULP_CLOSE(expected, Q, 64);
+        CHECK_EQUAL(std::size_t(1), stats.regions);
+        CHECK_EQUAL((std::size_t(1) << n) + 2 * n * n + 2 * n + 1, stats.evaluations);
+        CHECK_EQUAL(0u, stats.depth);
+    }
+}
+
+template<class Real>
+void test_gaussian()
+{
+    using std::exp;
+    using std::abs;
+    using std::sqrt;
+    Real tol = (std::max)(sqrt(std::numeric_limits<Real>::epsilon()), Real(1e-7));
+    // A product of Gaussians, centred off the midpoint so that the regions are split unevenly:
+    for (std::size_t n = 2; n <= 4; ++n)
+    {
+        std::vector<std::pair<Real, Real>> bounds(n, std::make_pair(Real(0), Real(1)));
+        auto f = [](std::vector<Real> const & x)->Real {
+            Real r2 = 0;
+            for (std::size_t i = 0; i < x.size(); ++i)
+            {
+                r2 += (x[i] - Real(1) / 3) * (x[i] - Real(1) / 3);
+            }
+            return exp(-8 * r2);
+        };
+        Real one_dimension = sqrt(pi<Real>() / 8) * (boost::math::erf(Real(4) / 3 * sqrt(Real(2))) + boost::math::erf(Real(2) / 3 * sqrt(Real(2)))) / 2;
+        Real expected = pow(one_dimension, static_cast<Real>(n));
+        Real error, L1;
+        genz_malik_statistics stats;
+        Real Q = genz_malik<Real>::integrate(f, bounds, 100000, tol, &error, &L1, &stats);
+        CHECK_LE(error, abs(Q * tol));
+        CHECK_ABSOLUTE_ERROR(expected, Q, 2 * tol * expected);
+        CHECK_ULP_CLOSE(Q, L1, 64);
+        // Every bisection replaces one region by two, and evaluates both of them:
+        CHECK_EQUAL(stats.evaluations, ((std::size_t(1) << n) + 2 * n * n + 2 * n + 1) * (2 * stats.regions - 1));
+        CHECK_LE(std::size_t(2), stats.regions);
+
+        // Evaluating the children of several regions at once on a thread team changes the order of bisection,
+        // but the answer still meets the tolerance, and is independent of timing:
+        Real error2;
+        std::atomic<std::size_t> calls(0);
+        auto g = [&](std::vector<Real> const & x)->Real { ++calls; return f(x); };
+        genz_malik_statistics stats2;
+        Real Q2 = genz_malik<Real>::integrate(g, bounds, 100000, tol, &error2, nullptr, &stats2, 4);
+        CHECK_LE(error2, abs(Q2 * tol));
+        CHECK_ABSOLUTE_ERROR(expected, Q2, 2 * tol * expected);
+        CHECK_EQUAL(stats2.evaluations, calls.load());
+        for (int i = 0; i < 2; ++i)
+        {
+            CHECK_EQUAL(Q2, genz_malik<Real>::integrate(f, bounds, 100000, tol, nullptr, nullptr, nullptr, 4));
+        }
+    }
+}
+
+template<class Real>
+void test_bounds()
+{
+    auto f = [](std::vector<Real> const & x)->Real { return x[0] * x[0] + x[1]; };
+    std::vector<std::pair<Real, Real>> bounds{{Real(-1), Real(2)}, {Real(0), Real(1)}};
+    Real Q = genz_malik<Real>::integrate(f, bounds);
+    CHECK_ULP_CLOSE(Real(3) + Real(3) / 2, Q, 16);
+    // Reversing one pair of bounds changes the sign, reversing both does not:
+    std::vector<std::pair<Real, Real>> reversed{{Real(2), Real(-1)}, {Real(0), Real(1)}};
+    CHECK_EQUAL(-Q, genz_malik<Real>::integrate(f, reversed));
+    reversed[1] = std::make_pair(Real(1), Real(0));
+    CHECK_EQUAL(Q, genz_malik<Real>::integrate(f, reversed));
+    // A box of zero width:
+    Real error = 1;
+    std::vector<std::pair<Real, Real>> flat{{Real(-1), Real(2)}, {Real(1), Real(1)}};
+    CHECK_EQUAL(Real(0), genz_malik<Real>::integrate(f, flat, 100, Real(1e-5), &error));
+    CHECK_EQUAL(Real(0), error);
+
+    bool caught = false;
+    try
+    {
+        std::vector<std::pair<Real, Real>> infinite{{Real(0), std::numeric_limits<Real>::infinity()}, {Real(0), Real(1)}};
+        genz_malik<Real>::integrate(f, infinite);
+    }
+    catch (std::domain_error const &)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(true, caught);
+    caught = false;
+    try
+    {
+        genz_malik<Real>::integrate(f, std::vector<std::pair<Real, Real>>());
+    }
+    catch (std::domain_error const &)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(true, caught);
+}
+
+template<class Real>
+void test_vector_valued()
+{
+    using std::exp;
+    using std::abs;
+    Real tol = Real(1e-8);
+    // Several integrals over the same region, sharing the integrand evaluations:
+    auto f = [](std::vector<Real> const & x)->std::array<Real, 3> {
+        Real e = exp(-x[0] - x[1] - x[2]);
+        return std::array<Real, 3>{{e, x[0] * e, x[0] * x[1] * e}};
+    };
+    std::vector<std::pair<Real, Real>> bounds(3, std::make_pair(Real(0), Real(1)));
+    Real error;
+    std::array<Real, 3> Q = genz_malik<Real>::integrate(f, bounds, 10000, tol, &error);
+    Real m0 = 1 - exp(Real(-1));
+    Real m1 = 1 - 2 * exp(Real(-1));
+    CHECK_ABSOLUTE_ERROR(m0 * m0 * m0, Q[0], 2 * tol);
+    CHECK_ABSOLUTE_ERROR(m1 * m0 * m0, Q[1], 2 * tol);
+    CHECK_ABSOLUTE_ERROR(m1 * m1 * m0, Q[2], 2 * tol);
+    CHECK_LE(error, abs(Q[0] * tol));
+}
+
+int main()
+{
+    test_polynomials<float>();
+    test_polynomials<double>();
+    test_polynomials<long double>();
+    test_polynomials<cpp_bin_float_50>();
+    test_gaussian<float>();
+    test_gaussian<double>();
+    test_bounds<double>();
+    test_bounds<cpp_bin_float_50>();
+    test_vector_valued<double>();
+    test_vector_valued<long double>();
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright 2020 Boost.Math contributors
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <list>
+#include <random>
+#include <vector>
+#include <boost/math/special_functions/beta.hpp>
+
+using boost::math::ibeta_evaluator;
+
+template<class Real>
+void test_same_as_ibeta()
+{
+    // Parameters which between them reach every method in ibeta_imp, including
+    // the swapped and stepped variants of a and b:
+    std::vector<std::pair<Real, Real>> params{
+        {Real(0.5), Real(0.5)}, {1, 1}, {1, Real(3.5)}, {Real(2.5), 1},
+        {Real(0.25), Real(0.75)}, {Real(0.05), Real(0.9)}, {Real(0.5), 5}, {5, Real(0.5)}, {Real(0.5), 30},
+        {Real(2.5), Real(3.5)}, {3, 7}, {20, Real(12.5)}, {Real(31.5), 70}, {300, 400}, {Real(1e-3), 2}};
+    std::mt19937_64 gen(12345);
+    std::uniform_real_distribution<Real> dis(0, 1);
+    std::vector<Real> x(500);
+    for (auto & t : x)
+    {
+        t = dis(gen);
+    }
+    std::vector<Real> special{0, 1, Real(1e-10), 1 - std::numeric_limits<Real>::epsilon(), Real(0.1), Real(0.3), Real(0.5), Real(0.7)};
+    x.insert(x.end(), special.begin(), special.end());
+
+    for (auto const & p : params)
+    {
+        ibeta_evaluator<Real> ev(p.first, p.second);
+        CHECK_EQUAL(ev.a(), p.first);
+        CHECK_EQUAL(ev.b(), p.second);
+        for (auto t : x)
+        {
+            CHECK_ULP_CLOSE(boost::math::ibeta(p.first, p.second, t), ev.ibeta(t), 0);
+            CHECK_ULP_CLOSE(boost::math::ibetac(p.first, p.second, t), ev.ibetac(t), 0);
+        }
+    }
+}
+
+template<class Real>
+void test_ranges()
+{
+    ibeta_evaluator<Real> ev(Real(4.5), Real(0.5));
+    std::list<Real> x{Real(0.01), Real(0.2), Real(0.6), Real(0.99)};
+    std::vector<Real> y(x.size());
+    std::vector<Real> yc(x.size());
+    auto it = ev.ibeta(x.begin(), x.end(), y.begin());
+    CHECK_EQUAL(it == y.end(), true);
+    ev.ibetac(x.begin(), x.end(), yc.begin());
+    size_t i = 0;
+    for (auto t : x)
+    {
+        CHECK_ULP_CLOSE(boost::math::ibeta(Real(4.5), Real(0.5), t), y[i], 0);
+        CHECK_ULP_CLOSE(boost::math::ibetac(Real(4.5), Real(0.5), t), yc[i], 0);
+        ++i;
+    }
+}
+
+void test_error_handling()
+{
+    bool thrown = false;
+    try
+    {
+        ibeta_evaluator<double> ev(-1, 2);
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+    thrown = false;
+    try
+    {
+        ibeta_evaluator<double> ev(0, 0);
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+    thrown = false;
+    try
+    {
+        ibeta_evaluator<double> ev(2, 3);
+        ev.ibeta(1.5);
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+}
+
+int main()
+{
+    test_same_as_ibeta<float>();
+    test_same_as_ibeta<double>();
+    test_same_as_ibeta<long double>();
+    test_ranges<double>();
+    test_error_handling();
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,167 @@
+/*
+ * Copyright 2020 Boost.Math contributors
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <list>
+#include <random>
+#include <vector>
+#include <limits>
+#include <boost/math/special_functions/gamma.hpp>
+
+template<class Real>
+std::vector<Real> igamma_test_arguments(Real lo, Real hi)
+{
+    std::mt19937_64 gen(12345);
+    std::uniform_real_distribution<Real> dis(lo, hi);
+    std::vector<Real> z(3000);
+    for (auto & t : z)
+    {
+        t = dis(gen);
+    }
+    return z;
+}
+
+template<class Real>
+void check_against_long_double(std::vector<Real> const & a, std::vector<Real> const & x, std::vector<Real> const & p, std::vector<Real> const & q)
+{
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        long double expected_p = boost::math::gamma_p(static_cast<long double>(a[i]), static_cast<long double>(x[i]));
+        long double expected_q = boost::math::gamma_q(static_cast<long double>(a[i]), static_cast<long double>(x[i]));
+        // The scalar double precision versions (without promotion to long double) are
+        // within a few ulp, the batch versions within 10-20 ulp:
+        if (expected_p > (std::numeric_limits<Real>::min)())
+        {
+            CHECK_ULP_CLOSE(static_cast<Real>(expected_p), p[i], 32);
+        }
+        if (expected_q > (std::numeric_limits<Real>::min)())
+        {
+            CHECK_ULP_CLOSE(static_cast<Real>(expected_q), q[i], 32);
+        }
+    }
+}
+
+template<class Real>
+void test_both_varying(Real max_a)
+{
+    auto a = igamma_test_arguments<Real>(0, max_a);
+    auto x = igamma_test_arguments<Real>(0, 2 * max_a + 5);
+    std::reverse(x.begin(), x.end());
+    // Integer and half integer a, x either side of the switch between the series
+    // and the continued fraction, and x = 0:
+    std::vector<Real> sa{1, 2, 10, Real(0.5), Real(0.5), Real(0.5), Real(2.5), 20, 20, 3};
+    std::vector<Real> sx{Real(0.5), 2, 9, Real(1.0999), Real(1.1), Real(1.1001), 3, Real(19.99), 20, 0};
+    a.insert(a.end(), sa.begin(), sa.end());
+    x.insert(x.end(), sx.begin(), sx.end());
+
+    std::vector<Real> p(a.size());
+    std::vector<Real> q(a.size());
+    auto it = boost::math::gamma_p(a.begin(), a.end(), x.begin(), p.begin());
+    CHECK_EQUAL(it == p.end(), true);
+    it = boost::math::gamma_q(a.cbegin(), a.cend(), x.cbegin(), q.begin());
+    CHECK_EQUAL(it == q.end(), true);
+    check_against_long_double(a, x, p, q);
+    CHECK_EQUAL(p.back(), Real(0));
+    CHECK_EQUAL(q.back(), Real(1));
+}
+
+template<class Real>
+void test_fixed_a()
+{
+    // Chi squared and Poisson style arguments, plus a > 150 which is handled by
+    // the scalar functions:
+    for (Real a : {Real(0.5), Real(1), Real(7.5), Real(31), Real(149.5), Real(400)})
+    {
+        auto x = igamma_test_arguments<Real>(0, 3 * a + 10);
+        std::vector<Real> av(x.size(), a);
+        std::vector<Real> p(x.size());
+        std::vector<Real> q(x.size());
+        auto it = boost::math::gamma_p(a, x.begin(), x.end(), p.begin());
+        CHECK_EQUAL(it == p.end(), true);
+        boost::math::gamma_q(a, x.begin(), x.end(), q.begin());
+        check_against_long_double(av, x, p, q);
+        if (a > 150)
+        {
+            for (size_t i = 0; i < x.size(); ++i)
+            {
+                CHECK_ULP_CLOSE(boost::math::gamma_p(a, x[i]), p[i], 0);
+                CHECK_ULP_CLOSE(boost::math::gamma_q(a, x[i]), q[i], 0);
+            }
+        }
+    }
+    // An integer a is promoted like the scalar version:
+    std::vector<Real> x{1, 2, 3};
+    std::vector<Real> q(x.size());
+    boost::math::gamma_q(3, x.begin(), x.end(), q.begin());
+    CHECK_ULP_CLOSE(static_cast<Real>(boost::math::gamma_q(3, 2.0)), q[1], 32);
+}
+
+template<class Real>
+void test_generic_path()
+{
+    std::list<Real> a{Real(0.25), Real(1), Real(2.5), Real(12), Real(250)};
+    std::list<Real> x{Real(0.5), Real(3), Real(2), Real(10), Real(240)};
+    std::vector<Real> p(a.size());
+    std::vector<Real> q(a.size());
+    boost::math::gamma_p(a.begin(), a.end(), x.begin(), p.begin());
+    boost::math::gamma_q(Real(2.5), x.begin(), x.end(), q.begin());
+    size_t i = 0;
+    auto ia = a.begin();
+    for (auto t : x)
+    {
+        CHECK_ULP_CLOSE(boost::math::gamma_p(*ia, t), p[i], 0);
+        CHECK_ULP_CLOSE(boost::math::gamma_q(Real(2.5), t), q[i], 0);
+        ++i;
+        ++ia;
+    }
+}
+
+void test_error_handling()
+{
+    std::vector<double> a{-1, 2};
+    std::vector<double> x{1, -1};
+    std::vector<double> y(a.size());
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        bool thrown = false;
+        try
+        {
+            boost::math::gamma_p(a.begin() + i, a.begin() + i + 1, x.begin() + i, y.begin());
+        }
+        catch (const std::domain_error&)
+        {
+            thrown = true;
+        }
+        CHECK_EQUAL(thrown, true);
+    }
+    // Errors go through the policy, and a NaN gives a NaN as for the scalar version:
+    using namespace boost::math::policies;
+    typedef policy<domain_error<ignore_error> > ignore_policy;
+    a.push_back(std::numeric_limits<double>::quiet_NaN());
+    x.push_back(1);
+    y.resize(a.size());
+    boost::math::gamma_q(a.begin(), a.end(), x.begin(), y.begin(), ignore_policy());
+    for (auto t : y)
+    {
+        CHECK_NAN(t);
+    }
+    // The scalar overloads are still found:
+    CHECK_ULP_CLOSE(boost::math::gamma_p(2.0, 1.0, policy<>()), 1 - 2 * std::exp(-1.0), 4);
+    CHECK_ULP_CLOSE(boost::math::gamma_q(2.0, 1.0), 2 * std::exp(-1.0), 4);
+}
+
+int main()
+{
+    test_both_varying<float>(30);
+    test_both_varying<double>(10);
+    test_both_varying<double>(160);
+    test_fixed_a<float>();
+    test_fixed_a<double>();
+    test_generic_path<long double>();
+    test_error_handling();
+    return boost::math::test::report_errors();
+}
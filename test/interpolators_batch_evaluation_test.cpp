@@ -0,0 +1,235 @@
+/*
+ * Copyright Boost.Math contributors, 2020
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+#include <boost/math/interpolators/cubic_hermite.hpp>
+#include <boost/math/interpolators/pchip.hpp>
+#include <boost/math/interpolators/makima.hpp>
+#include <boost/math/interpolators/quintic_hermite.hpp>
+#include <boost/math/interpolators/septic_hermite.hpp>
+#include <boost/math/interpolators/catmull_rom.hpp>
+#include <boost/circular_buffer.hpp>
+
+using boost::math::interpolators::cubic_hermite;
+using boost::math::interpolators::pchip;
+using boost::math::interpolators::makima;
+using boost::math::interpolators::quintic_hermite;
+using boost::math::interpolators::septic_hermite;
+using boost::math::catmull_rom;
+using boost::math::interpolators::detail::find_interval;
+
+template<typename Real>
+std::vector<Real> random_abscissas(std::size_t n, std::mt19937_64& gen)
+{
+    std::uniform_real_distribution<Real> dis(Real(1)/4, Real(2));
+    std::vector<Real> x(n);
+    x[0] = -1;
+    for (std::size_t i = 1; i < n; ++i)
+    {
+        x[i] = x[i-1] + dis(gen);
+    }
+    return x;
+}
+
+// Queries in [x0, xf], sorted or not, with runs of repeated values and both endpoints:
+template<typename Real>
+std::vector<Real> queries(Real x0, Real xf, std::size_t m, bool sorted, std::mt19937_64& gen)
+{
+    std::uniform_real_distribution<Real> dis(x0, xf);
+    std::vector<Real> t(m);
+    for (auto & s : t)
+    {
+        s = dis(gen);
+    }
+    t[0] = x0;
+    t[1] = xf;
+    t[2] = t[3] = t[4];
+    if (sorted)
+    {
+        std::sort(t.begin(), t.end());
+    }
+    return t;
+}
+
+template<typename Real>
+void test_find_interval()
+{
+    std::mt19937_64 gen(12345);
+    for (std::size_t n : {2, 3, 4, 17, 100, 1000})
+    {
+        std::vector<Real> x = random_abscissas<Real>(n, gen);
+        boost::circular_buffer<Real> buf(x.begin(), x.end());
+        auto t = queries<Real>(x.front(), x.back(), 200, false, gen);
+        for (Real s : t)
+        {
+            if (s == x.back())
+            {
+                continue;
+            }
+            std::size_t expected = std::upper_bound(x.begin(), x.end(), s) - x.begin() - 1;
+            // Every hint, including those out of range, finds the same interval:
+            for (std::size_t hint = 0; hint < n + 2; hint += (n > 30 ? 7 : 1))
+            {
+                CHECK_EQUAL(expected, find_interval(x, s, hint));
+                CHECK_EQUAL(expected, find_interval(buf, s, hint));
+            }
+        }
+        // The abscissas themselves lie at the start of their intervals:
+        for (std::size_t i = 0; i + 1 < n; ++i)
+        {
+            CHECK_EQUAL(i, find_interval(x, x[i], 0));
+            CHECK_EQUAL(i, find_interval(x, x[i], n - 1));
+        }
+    }
+}
+
+// Checks the batch and hinted forms give exactly the same values as the scalar form:
+template<class Interpolator, class Real>
+void check_forms(Interpolator const & f, std::vector<Real> const & t)
+{
+    std::vector<Real> y(t.size());
+    std::vector<Real> dy(t.size());
+    auto end = f(t.begin(), t.end(), y.begin());
+    CHECK_EQUAL(true, end == y.end());
+    f.prime(t.begin(), t.end(), dy.begin());
+    std::size_t hint = 0;
+    std::size_t prime_hint = 0;
+    for (std::size_t i = 0; i < t.size(); ++i)
+    {
+        CHECK_EQUAL(f(t[i]), y[i]);
+        CHECK_EQUAL(f.prime(t[i]), dy[i]);
+        CHECK_EQUAL(f(t[i]), f(t[i], hint));
+        CHECK_EQUAL(f.prime(t[i]), f.prime(t[i], prime_hint));
+    }
+}
+
+template<typename Real>
+void test_hermite_splines()
+{
+    using std::sin;
+    using std::cos;
+    std::mt19937_64 gen(35);
+    std::size_t n = 500;
+    std::vector<Real> x = random_abscissas<Real>(n, gen);
+    std::vector<Real> y(n), dydx(n), d2ydx2(n), d3ydx3(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        y[i] = sin(x[i]);
+        dydx[i] = cos(x[i]);
+        d2ydx2[i] = -sin(x[i]);
+        d3ydx3[i] = -cos(x[i]);
+    }
+    for (bool sorted : {true, false})
+    {
+        auto t = queries<Real>(x.front(), x.back(), 5000, sorted, gen);
+
+        auto x_copy = x; auto y_copy = y; auto dydx_copy = dydx;
+        auto ch = cubic_hermite<std::vector<Real>>(std::move(x_copy), std::move(y_copy), std::move(dydx_copy));
+        check_forms(ch, t);
+
+        x_copy = x; y_copy = y;
+        auto pc = pchip<std::vector<Real>>(std::move(x_copy), std::move(y_copy));
+        check_forms(pc, t);
+
+        x_copy = x; y_copy = y;
+        auto mk = makima<std::vector<Real>>(std::move(x_copy), std::move(y_copy));
+        check_forms(mk, t);
+
+        x_copy = x; y_copy = y; dydx_copy = dydx; auto d2ydx2_copy = d2ydx2;
+        auto qh = quintic_hermite<std::vector<Real>>(std::move(x_copy), std::move(y_copy), std::move(dydx_copy), std::move(d2ydx2_copy));
+        check_forms(qh, t);
+        std::vector<Real> d2y(t.size());
+        qh.double_prime(t.begin(), t.end(), d2y.begin());
+        std::size_t hint = 0;
+        for (std::size_t i = 0; i < t.size(); ++i)
+        {
+            CHECK_EQUAL(qh.double_prime(t[i]), d2y[i]);
+            CHECK_EQUAL(qh.double_prime(t[i]), qh.double_prime(t[i], hint));
+        }
+
+        x_copy = x; y_copy = y; dydx_copy = dydx; d2ydx2_copy = d2ydx2; auto d3ydx3_copy = d3ydx3;
+        auto sh = septic_hermite<std::vector<Real>>(std::move(x_copy), std::move(y_copy), std::move(dydx_copy), std::move(d2ydx2_copy), std::move(d3ydx3_copy));
+        check_forms(sh, t);
+    }
+
+    // Out of range queries throw, and leave the hint alone:
+    auto x_copy = x; auto y_copy = y; auto dydx_copy = dydx;
+    auto ch = cubic_hermite<std::vector<Real>>(std::move(x_copy), std::move(y_copy), std::move(dydx_copy));
+    std::size_t hint = 7;
+    bool caught = false;
+    try
+    {
+        ch(x.back() + 1, hint);
+    }
+    catch (std::domain_error const &)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(true, caught);
+    CHECK_EQUAL(std::size_t(7), hint);
+    // The hint is the interval containing the last query:
+    ch(x[n/2] + (x[n/2+1] - x[n/2])/2, hint);
+    CHECK_EQUAL(n/2, hint);
+}
+
+template<typename Real>
+void test_catmull_rom()
+{
+    using std::sin;
+    using std::cos;
+    std::mt19937_64 gen(17);
+    std::uniform_real_distribution<Real> dis(-1, 1);
+    std::vector<std::array<Real, 2>> points(300);
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+        Real theta = 2*i*Real(3.14159265358979323846)/points.size();
+        points[i] = {cos(theta) + dis(gen)/8, sin(theta) + dis(gen)/8};
+    }
+    for (bool closed : {false, true})
+    {
+        auto copy = points;
+        catmull_rom<std::array<Real, 2>> cr(std::move(copy), closed);
+        for (bool sorted : {true, false})
+        {
+            auto t = queries<Real>(Real(0), cr.max_parameter(), 3000, sorted, gen);
+            std::vector<std::array<Real, 2>> p(t.size());
+            std::vector<std::array<Real, 2>> dp(t.size());
+            cr(t.begin(), t.end(), p.begin());
+            cr.prime(t.begin(), t.end(), dp.begin());
+            std::size_t hint = 0;
+            for (std::size_t i = 0; i < t.size(); ++i)
+            {
+                auto q = cr(t[i]);
+                auto dq = cr.prime(t[i]);
+                CHECK_EQUAL(q[0], p[i][0]);
+                CHECK_EQUAL(q[1], p[i][1]);
+                CHECK_EQUAL(dq[0], dp[i][0]);
+                CHECK_EQUAL(dq[1], dp[i][1]);
+                auto r = cr(t[i], hint);
+                CHECK_EQUAL(q[0], r[0]);
+                CHECK_EQUAL(q[1], r[1]);
+            }
+        }
+    }
+}
+
+int main()
+{
+    test_find_interval<float>();
+    test_find_interval<double>();
+    test_hermite_splines<float>();
+    test_hermite_splines<double>();
+    test_hermite_splines<long double>();
+    test_catmull_rom<float>();
+    test_catmull_rom<double>();
+    return boost::math::test::report_errors();
+}
@@ -197,6 +197,29 @@ void test_multithreaded_variance()
     BOOST_CHECK_CLOSE_FRACTION(mc.variance(), exact_variance, 0.05);
 }
 
+template<class Real>
+void test_many_threads()
+{
+    std::cout << "Testing naive Monte-Carlo integration with many threads on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    auto g = [](std::vector<Real> const & x)->Real
+    {
+        return x[0]*x[1];
+    };
+    vector<pair<Real, Real>> bounds{{ Real(0), Real(1)}, { Real(0), Real(1)}};
+    // More threads than cores, so that they are preempted in the middle of publishing:
+    naive_monte_carlo<Real, decltype(g)> mc(g, bounds, (Real) 0.0005, false, 32, 7136);
+    auto task = mc.integrate();
+    Real y = task.get();
+    BOOST_CHECK_CLOSE_FRACTION(y, 0.25, 0.01);
+    BOOST_CHECK_CLOSE_FRACTION(mc.variance(), (Real) 7/(Real) 144, 0.05);
+
+    // Zero threads means one:
+    naive_monte_carlo<Real, decltype(g)> mc1(g, bounds, (Real) 0.001, false, 0, 7136);
+    task = mc1.integrate();
+    y = task.get();
+    BOOST_CHECK_CLOSE_FRACTION(y, 0.25, 0.02);
+}
+
 template<class Real>
 void test_variance()
 {
@@ -540,5 +563,9 @@ BOOST_AUTO_TEST_CASE(naive_monte_carlo_test)
 #if !defined(TEST) || TEST == 23
     test_alternative_rng_2<double, 3>();
 #endif
+#if !defined(TEST) || TEST == 24
+    test_many_threads<float>();
+    test_many_threads<double>();
+#endif
 
 }
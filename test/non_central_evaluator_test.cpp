@@ -0,0 +1,199 @@
+/*
+ * Copyright 2020 Boost.Math contributors
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <limits>
+#include <list>
+#include <stdexcept>
+#include <vector>
+#include <boost/math/distributions/non_central_beta.hpp>
+#include <boost/math/distributions/non_central_chi_squared.hpp>
+#include <boost/math/distributions/non_central_f.hpp>
+#include <boost/math/distributions/non_central_t.hpp>
+
+using boost::math::non_central_beta_distribution;
+using boost::math::non_central_chi_squared_distribution;
+using boost::math::non_central_f_distribution;
+using boost::math::non_central_t_distribution;
+using boost::math::non_central_beta_evaluator;
+using boost::math::non_central_chi_squared_evaluator;
+using boost::math::non_central_f_evaluator;
+using boost::math::non_central_t_evaluator;
+
+// The evaluators compute exactly what cdf() does, so the results must agree to the last bit,
+// whichever order the points come in:
+template<class Evaluator>
+void check_evaluator(typename Evaluator::value_type lower, typename Evaluator::value_type upper, std::size_t n,
+                     const typename Evaluator::value_type* extra, std::size_t n_extra,
+                     Evaluator evaluator)
+{
+    using Real = typename Evaluator::value_type;
+    std::vector<Real> x;
+    for (std::size_t i = 0; i <= n; ++i)
+    {
+        x.push_back(lower + (upper - lower) * i / n);
+    }
+    x.insert(x.end(), extra, extra + n_extra);
+    for (std::size_t i = n + 1; i-- > 0;)
+    {
+        x.push_back(x[i]);
+    }
+    auto dist = evaluator.distribution();
+    for (Real t : x)
+    {
+        Real p = evaluator.cdf(t);
+        Real q = evaluator.ccdf(t);
+        CHECK_ULP_CLOSE(cdf(dist, t), p, 0);
+        CHECK_ULP_CLOSE(cdf(complement(dist, t)), q, 0);
+    }
+    std::vector<Real> p(x.size());
+    std::vector<Real> q(x.size());
+    Evaluator fresh(dist);
+    auto end = fresh.cdf(x.begin(), x.end(), p.begin());
+    CHECK_EQUAL(static_cast<std::size_t>(end - p.begin()), x.size());
+    fresh.ccdf(x.begin(), x.end(), q.begin());
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        CHECK_ULP_CLOSE(cdf(dist, x[i]), p[i], 0);
+        CHECK_ULP_CLOSE(cdf(complement(dist, x[i])), q[i], 0);
+    }
+}
+
+template<class Real>
+void test_chi_squared()
+{
+    const Real extra[] = { 0, Real(1e-5), Real(1e-3), 1000 };
+    // Small non-centrality uses the series of Ding, large the forward and backward
+    // sums over the Poisson terms:
+    for (Real l : { Real(0.5), Real(20), Real(200), Real(2000) })
+    {
+        for (Real k : { Real(0.5), Real(3), Real(50) })
+        {
+            non_central_chi_squared_distribution<Real> dist(k, l);
+            Real m = mean(dist);
+            Real s = standard_deviation(dist);
+            check_evaluator(Real(0), m + 8 * s, 100, extra, 4, non_central_chi_squared_evaluator<Real>(dist));
+        }
+    }
+}
+
+template<class Real>
+void test_beta()
+{
+    const Real extra[] = { 0, 1, Real(1e-5), Real(1 - Real(1e-5)) };
+    for (Real l : { Real(0), Real(0.5), Real(30), Real(500) })
+    {
+        for (Real a : { Real(0.5), Real(4) })
+        {
+            for (Real b : { Real(2), Real(60) })
+            {
+                non_central_beta_distribution<Real> dist(a, b, l);
+                check_evaluator(Real(0), Real(1), 100, extra, 4, non_central_beta_evaluator<Real>(dist));
+            }
+        }
+    }
+}
+
+template<class Real>
+void test_f()
+{
+    const Real extra[] = { 0, Real(1e-5), 1000 };
+    for (Real l : { Real(0), Real(2), Real(100) })
+    {
+        for (Real v1 : { Real(1), Real(9) })
+        {
+            for (Real v2 : { Real(3), Real(40) })
+            {
+                non_central_f_distribution<Real> dist(v1, v2, l);
+                check_evaluator(Real(0), Real(20), 100, extra, 3, non_central_f_evaluator<Real>(dist));
+            }
+        }
+    }
+}
+
+template<class Real>
+void test_t()
+{
+    const Real extra[] = { 0, Real(1e-5), Real(-1e-5), 200, -200 };
+    for (Real delta : { Real(-3), Real(0), Real(0.5), Real(4), Real(40) })
+    {
+        for (Real v : { Real(1), Real(6.5), Real(90) })
+        {
+            non_central_t_distribution<Real> dist(v, delta);
+            check_evaluator(Real(delta - 12), Real(delta + 12), 100, extra, 5, non_central_t_evaluator<Real>(dist));
+        }
+    }
+    non_central_t_distribution<Real> dist(std::numeric_limits<Real>::infinity(), Real(1.5));
+    non_central_t_evaluator<Real> evaluator(dist);
+    CHECK_ULP_CLOSE(cdf(complement(dist, Real(2))), evaluator.ccdf(Real(2)), 0);
+}
+
+void test_iterators()
+{
+    non_central_chi_squared_distribution<double> dist(4, 30);
+    non_central_chi_squared_evaluator<double> evaluator(dist);
+    std::list<float> x = { 1, 10, 30, 60 };
+    std::list<double> p(x.size());
+    evaluator.cdf(x.begin(), x.end(), p.begin());
+    CHECK_ULP_CLOSE(cdf(dist, 60.0), p.back(), 0);
+}
+
+void test_error_handling()
+{
+    non_central_chi_squared_evaluator<double> chi(non_central_chi_squared_distribution<double>(4, 30));
+    non_central_beta_evaluator<double> beta(non_central_beta_distribution<double>(2, 3, 4));
+    non_central_f_evaluator<double> f(non_central_f_distribution<double>(2, 3, 4));
+    bool thrown = false;
+    try
+    {
+        chi.cdf(-1);
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+    thrown = false;
+    try
+    {
+        beta.ccdf(1.5);
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+    thrown = false;
+    try
+    {
+        f.cdf(std::numeric_limits<double>::infinity());
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+    // The evaluators are still usable afterwards:
+    CHECK_ULP_CLOSE(cdf(chi.distribution(), 20.0), chi.cdf(20), 0);
+    CHECK_ULP_CLOSE(cdf(beta.distribution(), 0.25), beta.cdf(0.25), 0);
+}
+
+int main()
+{
+    test_chi_squared<float>();
+    test_chi_squared<double>();
+    test_beta<float>();
+    test_beta<double>();
+    test_f<float>();
+    test_f<double>();
+    test_t<float>();
+    test_t<double>();
+    test_iterators();
+    test_error_handling();
+    return boost::math::test::report_errors();
+}
@@ -226,8 +226,54 @@ void test_monotonicity()
 }
 
 
+template<typename Real>
+void test_sliding_window()
+{
+    // A buffer which is not yet full when the interpolator is built, and which then drops a knot for each pushed.
+    // Since the derivative at a knot depends only upon its neighbours, the window agrees with the interpolator of all the knots:
+    std::mt19937 gen(12);
+    std::uniform_real_distribution<Real> dis(Real(1)/4, 1);
+    std::size_t capacity = 25;
+    boost::circular_buffer<Real> x_buf(capacity);
+    boost::circular_buffer<Real> y_buf(capacity);
+    std::vector<Real> x;
+    std::vector<Real> y;
+    Real t = 0;
+    for (std::size_t i = 0; i < 10; ++i)
+    {
+        t += dis(gen);
+        x.push_back(t);
+        y.push_back(dis(gen));
+        x_buf.push_back(x.back());
+        y_buf.push_back(y.back());
+    }
+    auto x_copy = x;
+    auto y_copy = y;
+    auto all = pchip<std::vector<Real>>(std::move(x_copy), std::move(y_copy));
+    auto window = pchip<boost::circular_buffer<Real>>(std::move(x_buf), std::move(y_buf));
+    for (std::size_t i = 0; i < 10*capacity; ++i)
+    {
+        t += dis(gen);
+        x.push_back(t);
+        y.push_back(dis(gen));
+        all.push_back(x.back(), y.back());
+        window.push_back(x.back(), y.back());
+    }
+    // Away from the knot which was first when the window was built:
+    std::size_t first = x.size() - capacity;
+    CHECK_EQUAL(x[first], window.domain().first);
+    CHECK_EQUAL(x.back(), window.domain().second);
+    for (Real s = x[first]; s <= x.back(); s += Real(1)/64)
+    {
+        CHECK_EQUAL(all(s), window(s));
+        CHECK_EQUAL(all.prime(s), window.prime(s));
+    }
+}
+
 int main()
 {
+    test_sliding_window<float>();
+    test_sliding_window<double>();
     test_constant<float>();
     test_linear<float>();
     test_interpolation_condition<float>();
@@ -0,0 +1,169 @@
+/*
+ * Copyright Boost.Math contributors, 2020
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <boost/math/quadrature/tanh_sinh.hpp>
+#include <boost/math/quadrature/exp_sinh.hpp>
+#include <boost/math/quadrature/sinh_sinh.hpp>
+#include <boost/math/quadrature/ooura_fourier_integrals.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::math::quadrature::tanh_sinh;
+using boost::math::quadrature::exp_sinh;
+using boost::math::quadrature::sinh_sinh;
+using boost::math::quadrature::ooura_fourier_sin;
+using boost::math::quadrature::ooura_fourier_cos;
+using boost::multiprecision::cpp_bin_float_50;
+
+template<class Quadrature>
+bool throws_on_load(std::string const & s)
+{
+    std::istringstream is(s);
+    try
+    {
+        Quadrature q(is);
+    }
+    catch (std::runtime_error const &)
+    {
+        return true;
+    }
+    return false;
+}
+
+template<class Real>
+void test_tanh_sinh()
+{
+    using std::log;
+    using std::sqrt;
+    auto f = [](Real x)->Real { return log(x)*sqrt(x); };
+    tanh_sinh<Real> integrator;
+    Real Q = integrator.integrate(f, Real(0), Real(1));
+
+    std::ostringstream os;
+    integrator.save_tables(os);
+    std::istringstream is(os.str());
+    tanh_sinh<Real> loaded(is);
+    // The loaded tables are exactly those saved, so the results are identical:
+    CHECK_EQUAL(Q, loaded.integrate(f, Real(0), Real(1)));
+    CHECK_EQUAL(integrator.table_statistics().size, loaded.table_statistics().size);
+    // And the loaded object carries on extending them as required:
+    CHECK_EQUAL(integrator.reserve_refinements(12), loaded.reserve_refinements(12));
+    Real g = integrator.integrate([](Real x)->Real { return 1/sqrt(x); }, Real(0), Real(1));
+    CHECK_EQUAL(g, loaded.integrate([](Real x)->Real { return 1/sqrt(x); }, Real(0), Real(1)));
+
+    // Saving the loaded object gives a file of the same size (the bytes may differ in the padding of long double):
+    std::ostringstream os2;
+    integrator.save_tables(os2);
+    std::ostringstream os3;
+    loaded.save_tables(os3);
+    CHECK_EQUAL(os2.str().size(), os3.str().size());
+
+    // Tables for other rules, other types, truncated or corrupt tables are rejected:
+    std::string s = os.str();
+    CHECK_EQUAL(true, throws_on_load<exp_sinh<Real>>(s));
+    CHECK_EQUAL(true, throws_on_load<tanh_sinh<float>>(s));
+    CHECK_EQUAL(true, throws_on_load<tanh_sinh<Real>>(s.substr(0, s.size()/2)));
+    CHECK_EQUAL(true, throws_on_load<tanh_sinh<Real>>(std::string()));
+    std::string corrupt = s;
+    corrupt[3] = 'X';
+    CHECK_EQUAL(true, throws_on_load<tanh_sinh<Real>>(corrupt));
+    if (std::is_floating_point<Real>::value)
+    {
+        // After the header come the maximum refinements, initial row length, t_max, t_crossover and number of rows,
+        // then the first complement index of row 0, which must not point past the end of the row:
+        const std::size_t first_complement_offset = 8 + 5*8 + 2*8 + 2*sizeof(Real) + 8;
+        corrupt = s;
+        std::fill(corrupt.begin() + first_complement_offset, corrupt.begin() + first_complement_offset + 8, '\x7f');
+        CHECK_EQUAL(true, throws_on_load<tanh_sinh<Real>>(corrupt));
+    }
+}
+
+template<class Real>
+void test_exp_sinh()
+{
+    using std::exp;
+    auto f = [](Real x)->Real { return exp(-x)*x; };
+    exp_sinh<Real> integrator;
+    Real Q = integrator.integrate(f);
+    std::ostringstream os;
+    integrator.save_tables(os);
+    std::istringstream is(os.str());
+    exp_sinh<Real> loaded(is);
+    CHECK_EQUAL(Q, loaded.integrate(f));
+    CHECK_EQUAL(true, throws_on_load<sinh_sinh<Real>>(os.str()));
+}
+
+template<class Real>
+void test_sinh_sinh()
+{
+    using std::exp;
+    auto f = [](Real x)->Real { return exp(-x*x); };
+    sinh_sinh<Real> integrator;
+    Real Q = integrator.integrate(f);
+    std::ostringstream os;
+    integrator.save_tables(os);
+    std::istringstream is(os.str());
+    sinh_sinh<Real> loaded(is);
+    CHECK_EQUAL(Q, loaded.integrate(f));
+    CHECK_EQUAL(true, throws_on_load<tanh_sinh<Real>>(os.str()));
+}
+
+template<class Real>
+void test_ooura()
+{
+    using std::exp;
+    auto f = [](Real t)->Real { return exp(-t); };
+    ooura_fourier_sin<Real> sin_integrator;
+    ooura_fourier_cos<Real> cos_integrator;
+    auto s = sin_integrator.integrate(f, Real(2));
+    auto c = cos_integrator.integrate(f, Real(2));
+
+    std::ostringstream sin_os, cos_os;
+    sin_integrator.save_tables(sin_os);
+    cos_integrator.save_tables(cos_os);
+    std::istringstream sin_is(sin_os.str()), cos_is(cos_os.str());
+    ooura_fourier_sin<Real> sin_loaded(sin_is);
+    ooura_fourier_cos<Real> cos_loaded(cos_is);
+    CHECK_EQUAL(sin_integrator.big_nodes().size(), sin_loaded.big_nodes().size());
+    CHECK_EQUAL(s.first, sin_loaded.integrate(f, Real(2)).first);
+    CHECK_EQUAL(c.first, cos_loaded.integrate(f, Real(2)).first);
+    CHECK_EQUAL(true, throws_on_load<ooura_fourier_cos<Real>>(sin_os.str()));
+
+    // Truncated tables are rejected, including one cut short after the header which claims to hold no levels at all:
+    std::string sin_s = sin_os.str();
+    std::string cos_s = cos_os.str();
+    CHECK_EQUAL(true, throws_on_load<ooura_fourier_sin<Real>>(sin_s.substr(0, sin_s.size()/2)));
+    CHECK_EQUAL(true, throws_on_load<ooura_fourier_cos<Real>>(cos_s.substr(0, cos_s.size()/2)));
+    // The header is 8 bytes of magic and five 8 byte integers, followed by the requested and saved numbers of levels:
+    const std::size_t levels_offset = 8 + 6*8;
+    std::string no_levels = sin_s.substr(0, levels_offset + 8);
+    std::fill(no_levels.begin() + levels_offset, no_levels.end(), '\0');
+    CHECK_EQUAL(true, throws_on_load<ooura_fourier_sin<Real>>(no_levels));
+    no_levels = cos_s.substr(0, levels_offset + 8);
+    std::fill(no_levels.begin() + levels_offset, no_levels.end(), '\0');
+    CHECK_EQUAL(true, throws_on_load<ooura_fourier_cos<Real>>(no_levels));
+}
+
+int main()
+{
+    test_tanh_sinh<double>();
+    test_tanh_sinh<long double>();
+    test_tanh_sinh<cpp_bin_float_50>();
+    test_exp_sinh<double>();
+    test_exp_sinh<cpp_bin_float_50>();
+    test_sinh_sinh<double>();
+    test_sinh_sinh<cpp_bin_float_50>();
+    test_ooura<float>();
+    test_ooura<double>();
+    return boost::math::test::report_errors();
+}
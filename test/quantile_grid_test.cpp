@@ -0,0 +1,165 @@
+/*
+ * Copyright 2020 Boost.Math contributors
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <algorithm>
+#include <cmath>
+#include <future>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <boost/math/distributions/beta.hpp>
+#include <boost/math/distributions/gamma.hpp>
+#include <boost/math/distributions/non_central_t.hpp>
+#include <boost/math/distributions/students_t.hpp>
+#include <boost/math/distributions/quantile_grid.hpp>
+
+using boost::math::quantile_grid;
+
+template<class Real>
+std::vector<Real> uniform_grid(std::size_t n)
+{
+    std::vector<Real> p(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        p[i] = (i + Real(0.5))/n;
+    }
+    return p;
+}
+
+template<class Distribution>
+void check_against_quantile(Distribution const & dist, std::vector<typename Distribution::value_type> const & p,
+                            std::vector<typename Distribution::value_type> const & q, int ulps)
+{
+    CHECK_EQUAL(p.size(), q.size());
+    // Where the quantile is ill conditioned (gamma with a small shape parameter) neither
+    // this nor quantile() is accurate to the last few bits:
+    for (std::size_t i = 0; i < p.size(); ++i)
+    {
+        CHECK_ULP_CLOSE(quantile(dist, p[i]), q[i], ulps);
+    }
+}
+
+template<class Distribution>
+void test_distribution(Distribution const & dist, std::size_t n)
+{
+    using Real = typename Distribution::value_type;
+    std::vector<Real> p = uniform_grid<Real>(n);
+    std::vector<Real> q(p.size());
+    auto end = quantile_grid(dist, p.begin(), p.end(), q.begin());
+    CHECK_EQUAL(static_cast<std::size_t>(end - q.begin()), p.size());
+    check_against_quantile(dist, p, q, 16);
+
+    // Descending and repeated probabilities, and a jump back to the start:
+    std::vector<Real> r(p.rbegin(), p.rend());
+    r.insert(r.begin() + r.size()/2, r[r.size()/2]);
+    r.push_back(r[0]);
+    q.resize(r.size());
+    quantile_grid(dist, r.begin(), r.end(), q.begin());
+    check_against_quantile(dist, r, q, 16);
+
+    // Random probabilities, spread over many orders of magnitude in both tails:
+    std::mt19937_64 gen(12345);
+    std::uniform_real_distribution<Real> dis(-15, 15);
+    std::vector<Real> s(2000);
+    for (auto & t : s)
+    {
+        Real e = std::exp(dis(gen));
+        t = e/(1 + e);
+    }
+    std::sort(s.begin(), s.end());
+    q.resize(s.size());
+    quantile_grid(dist, s.begin(), s.end(), q.begin());
+    check_against_quantile(dist, s, q, 16);
+
+    // Any iterators will do for the sequential version:
+    std::list<Real> l(p.begin(), p.begin() + 100);
+    std::list<Real> lq(l.size());
+    quantile_grid(dist, l.begin(), l.end(), lq.begin());
+    CHECK_ULP_CLOSE(quantile(dist, l.back()), lq.back(), 16);
+}
+
+template<class Real>
+void test_distributions()
+{
+    test_distribution(boost::math::beta_distribution<Real>(Real(2.5), 7), 5000);
+    test_distribution(boost::math::beta_distribution<Real>(Real(0.5), Real(0.5)), 5000);
+    test_distribution(boost::math::gamma_distribution<Real>(Real(3.3)), 5000);
+    test_distribution(boost::math::gamma_distribution<Real>(Real(0.2), 2), 5000);
+    test_distribution(boost::math::students_t_distribution<Real>(Real(4.5)), 5000);
+    test_distribution(boost::math::non_central_t_distribution<Real>(5, Real(1.5)), 500);
+}
+
+void test_threads()
+{
+    boost::math::beta_distribution<double> dist(2.5, 7);
+    std::vector<double> p = uniform_grid<double>(10000);
+    std::vector<double> expected(p.size());
+    quantile_grid(dist, p.begin(), p.end(), expected.begin());
+    for (unsigned threads : {0u, 1u, 3u, 8u})
+    {
+        std::vector<double> q(p.size());
+        auto end = quantile_grid(dist, p.begin(), p.end(), q.begin(), threads);
+        CHECK_EQUAL(static_cast<std::size_t>(end - q.begin()), p.size());
+        check_against_quantile(dist, p, q, 16);
+    }
+    // A user supplied executor:
+    std::size_t calls = 0;
+    auto deferred = [&calls](std::function<void()> f) {
+        ++calls;
+        return std::async(std::launch::deferred, std::move(f));
+    };
+    std::vector<double> q(p.size());
+    quantile_grid(dist, p.begin(), p.end(), q.begin(), 5, deferred);
+    CHECK_EQUAL(calls, std::size_t(5));
+    check_against_quantile(dist, p, q, 16);
+    // Too few points to be worth splitting:
+    calls = 0;
+    quantile_grid(dist, p.begin(), p.begin() + 100, q.begin(), 5, deferred);
+    CHECK_EQUAL(calls, std::size_t(0));
+    CHECK_EQUAL(q[99], expected[99]);
+}
+
+void test_error_handling()
+{
+    boost::math::gamma_distribution<double> dist(2);
+    std::vector<double> p = uniform_grid<double>(1000);
+    std::vector<double> q(p.size());
+    p[700] = 1.5;
+    bool thrown = false;
+    try
+    {
+        quantile_grid(dist, p.begin(), p.end(), q.begin());
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+    // Errors in any task are rethrown once all the tasks have finished:
+    thrown = false;
+    try
+    {
+        quantile_grid(dist, p.begin(), p.end(), q.begin(), 4u);
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+    CHECK_ULP_CLOSE(quantile(dist, p[999]), q[999], 16);
+}
+
+int main()
+{
+    test_distributions<float>();
+    test_distributions<double>();
+    test_threads();
+    test_error_handling();
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,302 @@
+/*
+ * Copyright Boost.Math contributors, 2020
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/quadrature/quasi_monte_carlo.hpp>
+
+using std::vector;
+using std::pair;
+using boost::math::constants::pi;
+using boost::math::quadrature::quasi_monte_carlo;
+using boost::math::quadrature::sobol_sequence;
+using boost::math::quadrature::halton_sequence;
+using boost::math::quadrature::lattice_sequence;
+
+void test_sobol_sequence()
+{
+    sobol_sequence seq(32);
+    CHECK_EQUAL(std::size_t(32), seq.dimension());
+    vector<uint64_t> no_shift(32, 0);
+    vector<double> x(32);
+    // The first points in the first three dimensions are well known:
+    double expected[6][3] = { {0, 0, 0}, {0.5, 0.5, 0.5}, {0.75, 0.25, 0.25}, {0.25, 0.75, 0.75}, {0.375, 0.375, 0.625}, {0.875, 0.875, 0.125} };
+    for (uint64_t k = 0; k < 6; ++k)
+    {
+        seq(k, no_shift, x);
+        for (std::size_t j = 0; j < 3; ++j)
+        {
+            CHECK_EQUAL(expected[k][j], x[j]);
+        }
+    }
+
+    // A digital shift keeps the first 2^m points a net, so every coordinate has one point in each interval of width 2^-m,
+    // and in each pair of the first two coordinates one point in each box of area 2^-m:
+    std::mt19937_64 gen(12345);
+    vector<uint64_t> shift(32);
+    for (auto & s : shift)
+    {
+        s = gen();
+    }
+    const unsigned m = 8;
+    const uint64_t n = 1 << m;
+    vector<vector<unsigned>> counts(32, vector<unsigned>(n, 0));
+    vector<vector<unsigned>> boxes(m + 1, vector<unsigned>(n, 0));
+    for (uint64_t k = 0; k < n; ++k)
+    {
+        seq(k, shift, x);
+        for (std::size_t j = 0; j < 32; ++j)
+        {
+            CHECK_LE(0.0, x[j]);
+            CHECK_LE(x[j], 1.0);
+            ++counts[j][static_cast<std::size_t>(std::ldexp(x[j], m))];
+        }
+        for (unsigned a = 0; a <= m; ++a)
+        {
+            uint64_t i = static_cast<uint64_t>(std::ldexp(x[0], a));
+            uint64_t j = static_cast<uint64_t>(std::ldexp(x[1], m - a));
+            ++boxes[a][(i << (m - a)) + j];
+        }
+    }
+    for (std::size_t j = 0; j < 32; ++j)
+    {
+        for (uint64_t i = 0; i < n; ++i)
+        {
+            CHECK_EQUAL(1u, counts[j][i]);
+        }
+    }
+    for (unsigned a = 0; a <= m; ++a)
+    {
+        for (uint64_t i = 0; i < n; ++i)
+        {
+            CHECK_EQUAL(1u, boxes[a][i]);
+        }
+    }
+}
+
+void test_halton_sequence()
+{
+    halton_sequence seq(5);
+    vector<uint64_t> no_shift(5, 0);
+    vector<double> x(5);
+    // The first b points in base b are the multiples of 1/b, in the order of the radical inverse:
+    unsigned primes[5] = { 2, 3, 5, 7, 11 };
+    for (std::size_t j = 0; j < 5; ++j)
+    {
+        for (uint64_t k = 0; k < primes[j]; ++k)
+        {
+            seq(k, no_shift, x);
+            CHECK_ULP_CLOSE(double(k)/primes[j], x[j], 1);
+        }
+    }
+    seq(5, no_shift, x);
+    CHECK_ULP_CLOSE(0.625, x[0], 1);  // 101 -> 0.101
+    CHECK_ULP_CLOSE(7.0/9, x[1], 1);  // 12 -> 0.21
+}
+
+void test_lattice_sequence()
+{
+    lattice_sequence seq(32);
+    vector<uint64_t> no_shift(32, 0);
+    vector<double> x(32);
+    // Every block of 2^m points is a lattice, whose projection onto each coordinate is the multiples of 2^-m,
+    // and which the baker's transform folds onto the multiples of 2^(1-m), twice each:
+    const unsigned m = 10;
+    const uint64_t n = 1 << m;
+    vector<vector<unsigned>> counts(32, vector<unsigned>(n / 2, 0));
+    for (uint64_t k = 0; k < n; ++k)
+    {
+        seq(k, no_shift, x);
+        for (std::size_t j = 0; j < 32; ++j)
+        {
+            double i = std::ldexp(x[j], m - 1);
+            CHECK_EQUAL(std::floor(i), i);
+            ++counts[j][static_cast<std::size_t>(i)];
+        }
+    }
+    for (std::size_t j = 0; j < 32; ++j)
+    {
+        for (uint64_t i = 0; i < n / 2; ++i)
+        {
+            CHECK_EQUAL(2u, counts[j][i]);
+        }
+    }
+}
+
+template<class Real, class Sequence>
+void test_smooth_integrand(std::size_t dimension, Real error_goal)
+{
+    using std::sin;
+    using std::abs;
+    // A product of functions with integral 1 on [0, 1]:
+    auto f = [](vector<Real> const & x)->Real
+    {
+        Real y = 1;
+        for (std::size_t j = 0; j < x.size(); ++j)
+        {
+            y *= pi<Real>()*sin(pi<Real>()*x[j])/2;
+        }
+        return y;
+    };
+    vector<pair<Real, Real>> bounds(dimension, pair<Real, Real>(0, 1));
+    quasi_monte_carlo<Real, decltype(f), Sequence> qmc(f, bounds, error_goal, false, 2, 1234);
+    auto task = qmc.integrate();
+    Real Q = task.get();
+    CHECK_LE(qmc.current_error_estimate(), error_goal);
+    CHECK_LE(abs(Q - 1), 5*error_goal);
+    CHECK_EQUAL(Q, qmc.current_estimate());
+    CHECK_EQUAL(Real(1), qmc.progress());
+
+    // The result depends upon the seed, but not on the number of threads:
+    quasi_monte_carlo<Real, decltype(f), Sequence> qmc1(f, bounds, error_goal, false, 1, 1234);
+    task = qmc1.integrate();
+    CHECK_EQUAL(Q, task.get());
+    CHECK_EQUAL(qmc.calls(), qmc1.calls());
+}
+
+template<class Real, class Sequence>
+void test_convergence()
+{
+    using std::exp;
+    // Quasi-Monte Carlo needs far fewer points than the 1/sqrt(N) convergence of Monte Carlo for a smooth integrand:
+    auto f = [](vector<Real> const & x)->Real
+    {
+        Real r = 0;
+        for (std::size_t j = 0; j < x.size(); ++j)
+        {
+            r += x[j]/(j + 1);
+        }
+        return exp(r);
+    };
+    vector<pair<Real, Real>> bounds(8, pair<Real, Real>(0, 1));
+    Real error_goal = Real(1)/Real(100000);
+    quasi_monte_carlo<Real, decltype(f), Sequence> qmc(f, bounds, error_goal, false, 1, 42);
+    auto task = qmc.integrate();
+    Real Q = task.get();
+    Real expected = 1;
+    for (std::size_t j = 0; j < 8; ++j)
+    {
+        expected *= (j + 1)*(exp(Real(1)/(j + 1)) - 1);
+    }
+    CHECK_ABSOLUTE_ERROR(expected, Q, 10*error_goal);
+    // The variance of f is about 2.2, so Monte Carlo would need 2x10^10 calls:
+    CHECK_LE(qmc.calls(), uint64_t(5000000));
+}
+
+template<class Real>
+void test_infinite_bounds()
+{
+    using std::exp;
+    auto f = [](vector<Real> const & x)->Real
+    {
+        return exp(-x[0]*x[0] - x[1]*x[1] - x[2]);
+    };
+    Real inf = std::numeric_limits<Real>::infinity();
+    vector<pair<Real, Real>> bounds{{-inf, inf}, {-inf, Real(0)}, {Real(0), inf}};
+    Real error_goal = Real(1)/Real(1000);
+    quasi_monte_carlo<Real, decltype(f)> qmc(f, bounds, error_goal, true, 2, 99);
+    auto task = qmc.integrate();
+    Real Q = task.get();
+    CHECK_ABSOLUTE_ERROR(pi<Real>()/2, Q, 5*error_goal);
+}
+
+template<class Real>
+void test_cancel_and_restart()
+{
+    auto f = [](vector<Real> const & x)->Real
+    {
+        return x[0]*x[1]*x[2]*x[3];
+    };
+    vector<pair<Real, Real>> bounds(4, pair<Real, Real>(0, 1));
+    quasi_monte_carlo<Real, decltype(f), lattice_sequence> qmc(f, bounds, Real(0), false, 2, 17);
+    auto task = qmc.integrate();
+    qmc.cancel();
+    Real y = task.get();
+    CHECK_LE(y, Real(1));
+    CHECK_LE(Real(0), y);
+
+    qmc.update_target_error(Real(1)/Real(100000));
+    task = qmc.integrate();
+    y = task.get();
+    CHECK_ABSOLUTE_ERROR(Real(1)/Real(16), y, Real(1)/Real(10000));
+    CHECK_EQUAL(std::chrono::duration<Real>(0).count(), qmc.estimated_time_to_completion().count());
+}
+
+void test_exceptions()
+{
+    auto f = [](vector<double> const & x)->double
+    {
+        if (x[0] > 0.75)
+        {
+            throw std::domain_error("You have done something wrong.\n");
+        }
+        return 1;
+    };
+    vector<pair<double, double>> bounds{{0.0, 1.0}, {0.0, 1.0}};
+    bool caught = false;
+    try
+    {
+        // Either from the constructor, which evaluates the first point of each shift, or from the future:
+        quasi_monte_carlo<double, decltype(f)> qmc(f, bounds, 1e-12, false, 2);
+        qmc.integrate().get();
+    }
+    catch (std::domain_error const &)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(true, caught);
+
+    // Non-finite values are reported with where they happened:
+    auto g = [](vector<double> const & x)->double { return 1/(x[0] - x[0]); };
+    caught = false;
+    try
+    {
+        quasi_monte_carlo<double, decltype(g)> qmc2(g, bounds, 1e-3, false, 1);
+        qmc2.integrate().get();
+    }
+    catch (std::domain_error const &)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(true, caught);
+
+    // Too many dimensions for the sequence:
+    vector<pair<double, double>> big(33, pair<double, double>(0, 1));
+    caught = false;
+    try
+    {
+        quasi_monte_carlo<double, decltype(f)> qmc3(f, big, 1e-3);
+    }
+    catch (std::domain_error const &)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(true, caught);
+}
+
+int main()
+{
+    test_sobol_sequence();
+    test_halton_sequence();
+    test_lattice_sequence();
+    test_smooth_integrand<double, sobol_sequence>(5, 1e-4);
+    test_smooth_integrand<double, sobol_sequence>(20, 1e-2);
+    test_smooth_integrand<double, halton_sequence>(5, 1e-4);
+    test_smooth_integrand<double, lattice_sequence>(5, 1e-4);
+    test_smooth_integrand<double, lattice_sequence>(20, 1e-2);
+    test_smooth_integrand<long double, sobol_sequence>(8, 1e-3L);
+    test_convergence<double, sobol_sequence>();
+    test_convergence<double, lattice_sequence>();
+    test_infinite_bounds<double>();
+    test_cancel_and_restart<double>();
+    test_exceptions();
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,167 @@
+/*
+ * Copyright 2020 Boost.Math contributors
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <random>
+#include <vector>
+#include <boost/math/distributions/beta.hpp>
+#include <boost/math/distributions/gamma.hpp>
+#include <boost/math/distributions/normal.hpp>
+#include <boost/math/distributions/students_t.hpp>
+#include <boost/math/distributions/tabulated_quantile.hpp>
+
+using boost::math::tabulated_quantile;
+
+template<class Real>
+std::vector<Real> random_probabilities()
+{
+    std::mt19937_64 gen(12345);
+    std::uniform_real_distribution<Real> dis(0, 1);
+    std::vector<Real> p(5000);
+    for (auto & t : p)
+    {
+        t = dis(gen);
+    }
+    // Band and piece boundaries, the median and either side of the tabulated range:
+    std::vector<Real> special{Real(0.5), Real(0.25), Real(0.75), Real(0.125), Real(0.875), Real(1e-3), Real(1) - Real(1e-3), Real(0.3)};
+    p.insert(p.end(), special.begin(), special.end());
+    return p;
+}
+
+template<class Distribution>
+void test_distribution(Distribution const & dist, typename Distribution::value_type tolerance)
+{
+    using Real = typename Distribution::value_type;
+    tabulated_quantile<Distribution> q(dist, tolerance);
+    CHECK_LE(q.max_relative_error(), tolerance);
+    if (quantile(dist, Real(1)/4294967296uLL) > (std::numeric_limits<Real>::min)())
+    {
+        CHECK_ULP_CLOSE(Real(1)/4294967296uLL, q.lower_limit(), 0);
+        CHECK_ULP_CLOSE(Real(1)/4294967296uLL, q.upper_limit(), 0);
+    }
+
+    for (auto p : random_probabilities<Real>())
+    {
+        if (p == 1)
+        {
+            continue;
+        }
+        Real expected = quantile(dist, p);
+        // The check points are only a sample of each piece, so allow some slack,
+        // and near a sign change only an error relative to the scale of the
+        // quantile is possible:
+        Real scale = (std::max)(abs(expected), abs(quantile(dist, Real(0.25))));
+        CHECK_ABSOLUTE_ERROR(expected, q(p), 4*tolerance*scale);
+    }
+    // Outside the table the distribution's own quantile is used:
+    for (Real p : {q.lower_limit()/2, Real(1e-20), Real(1 - q.upper_limit()/2)})
+    {
+        // For float the upper end of the table is 1 - epsilon/2, as 1 - upper_limit()/2 rounds to 1:
+        if (p < 1)
+        {
+            CHECK_ULP_CLOSE(quantile(dist, p), q(p), 0);
+        }
+    }
+}
+
+template<class Real>
+void test_distributions()
+{
+    Real tol = 256*std::numeric_limits<Real>::epsilon();
+    test_distribution(boost::math::gamma_distribution<Real>(Real(2.5)), tol);
+    test_distribution(boost::math::gamma_distribution<Real>(Real(0.1), 3), tol);
+    // The lower tail underflows for float long before the default minimum probability:
+    tabulated_quantile<boost::math::gamma_distribution<Real>> tiny(boost::math::gamma_distribution<Real>(Real(0.02)));
+    CHECK_LE(quantile(tiny.distribution(), tiny.lower_limit()/2), (std::numeric_limits<Real>::min)());
+    CHECK_ULP_CLOSE(quantile(tiny.distribution(), Real(1e-30)), tiny(Real(1e-30)), 0);
+    test_distribution(boost::math::beta_distribution<Real>(2, 3), tol);
+    test_distribution(boost::math::beta_distribution<Real>(Real(0.5), Real(0.5)), tol);
+    test_distribution(boost::math::students_t_distribution<Real>(5), tol);
+    test_distribution(boost::math::students_t_distribution<Real>(Real(1.5)), tol);
+    test_distribution(boost::math::normal_distribution<Real>(1, 2), tol);
+    // A looser tolerance needs fewer pieces:
+    boost::math::gamma_distribution<Real> g(Real(2.5));
+    tabulated_quantile<boost::math::gamma_distribution<Real>> coarse(g, Real(1e-4));
+    tabulated_quantile<boost::math::gamma_distribution<Real>> fine(g, tol);
+    CHECK_LE(coarse.pieces(), fine.pieces());
+    CHECK_LE(coarse.max_relative_error(), Real(1e-4));
+}
+
+void test_error_handling()
+{
+    boost::math::gamma_distribution<double> g(2);
+    tabulated_quantile<boost::math::gamma_distribution<double>> q(g);
+    CHECK_EQUAL(q(0.0), 0.0);
+    bool thrown = false;
+    try
+    {
+        q(1.0);
+    }
+    catch (const std::overflow_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+    thrown = false;
+    try
+    {
+        q(1.5);
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+    thrown = false;
+    try
+    {
+        tabulated_quantile<boost::math::gamma_distribution<double>> bad(g, 0.0);
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+    thrown = false;
+    try
+    {
+        tabulated_quantile<boost::math::gamma_distribution<double>> bad(g, 1e-10, 0.5);
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+    // A tolerance below the accuracy of the quantile itself cannot be met:
+    thrown = false;
+    try
+    {
+        tabulated_quantile<boost::math::gamma_distribution<double>> bad(g, 1e-20);
+    }
+    catch (const boost::math::evaluation_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+
+    // When the domain errors don't throw, nothing is tabulated and every p goes to the distribution:
+    typedef boost::math::policies::policy<boost::math::policies::domain_error<boost::math::policies::ignore_error>> ignore_policy;
+    boost::math::gamma_distribution<double, ignore_policy> gi(2);
+    tabulated_quantile<boost::math::gamma_distribution<double, ignore_policy>> quiet(gi, 0.0);
+    CHECK_EQUAL(quiet.lower_limit(), 1.0);
+    CHECK_EQUAL(quiet.upper_limit(), 1.0);
+    CHECK_EQUAL(quiet(0.3), quantile(gi, 0.3));
+    CHECK_EQUAL(quiet(0.9), quantile(gi, 0.9));
+}
+
+int main()
+{
+    test_distributions<float>();
+    test_distributions<double>();
+    test_error_handling();
+    return boost::math::test::report_errors();
+}
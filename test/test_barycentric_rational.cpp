@@ -252,6 +252,64 @@ void test_weights()
 
 }
 
+template<class Real>
+void test_batch()
+{
+    std::cout << "Testing batch evaluation and fused derivative of barycentric interpolation on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+
+    std::mt19937 gen(10);
+    boost::random::uniform_real_distribution<Real> dis(0.1f, 1);
+    std::vector<Real> x(300);
+    std::vector<Real> y(300);
+    x[0] = 0;
+    y[0] = 0;
+    for (size_t i = 1; i < x.size(); ++i)
+    {
+        x[i] = x[i-1] + dis(gen);
+        y[i] = sin(x[i]/5);
+    }
+    boost::math::barycentric_rational<Real> interpolator(x.data(), y.data(), y.size());
+
+    // A length which is not a multiple of the block size, with points at the nodes and outside the range of the data:
+    std::vector<Real> t(1003);
+    boost::random::uniform_real_distribution<Real> tdis(x.front() - 1, x.back() + 1);
+    for (auto & s : t)
+    {
+        s = tdis(gen);
+    }
+    for (size_t i = 0; i < 20; ++i)
+    {
+        t[3*i] = x[7*i];
+    }
+    std::vector<Real> z(t.size());
+    std::vector<Real> z_prime(t.size());
+    auto end = interpolator(t.begin(), t.end(), z.begin());
+    BOOST_CHECK(end == z.end());
+    interpolator.prime(t.begin(), t.end(), z_prime.begin());
+    // The fused value and derivative are compared with those computed in higher precision, since the two pass formula of prime(x) cancels more:
+    std::vector<long double> x_long(x.begin(), x.end());
+    std::vector<long double> y_long(y.begin(), y.end());
+    boost::math::barycentric_rational<long double> reference(x_long.data(), y_long.data(), y_long.size());
+    Real tol = 100*numeric_limits<Real>::epsilon();
+    for (size_t i = 0; i < t.size(); ++i)
+    {
+        Real expected = interpolator(t[i]);
+        BOOST_CHECK_SMALL(z[i] - expected, tol);
+        auto p = interpolator.value_and_prime(t[i]);
+        BOOST_CHECK_SMALL(static_cast<long double>(p.first) - reference(t[i]), static_cast<long double>(10*tol));
+        BOOST_CHECK_SMALL(z_prime[i] - p.second, tol);
+        // The long double reference derivative is itself checked against the existing prime(x):
+        long double reference_prime = reference.value_and_prime(t[i]).second;
+        BOOST_CHECK_SMALL(reference_prime - reference.prime(t[i]), static_cast<long double>(tol));
+        BOOST_CHECK_SMALL(static_cast<long double>(p.second) - reference_prime, static_cast<long double>(10*tol));
+    }
+    for (size_t i = 0; i < 20; ++i)
+    {
+        BOOST_CHECK_EQUAL(z[3*i], y[7*i]);
+        BOOST_CHECK_EQUAL(z_prime[3*i], interpolator.prime(x[7*i]));
+    }
+}
+
 
 BOOST_AUTO_TEST_CASE(barycentric_rational)
 {
@@ -282,8 +340,12 @@ BOOST_AUTO_TEST_CASE(barycentric_rational)
 
     test_runge<double>();
     //test_runge<long double>();
+
     //test_runge<cpp_bin_float_50>();
 
+    test_batch<float>();
+    test_batch<double>();
+
 #ifdef BOOST_HAS_FLOAT128
     //test_interpolation_condition<boost::multiprecision::float128>();
     //test_constant<boost::multiprecision::float128>();
@@ -41,6 +41,7 @@
    using std::setprecision;
 #include <limits>
   using std::numeric_limits;
+#include <vector>
 
 template <class RealType>
 RealType NaivePDF(RealType mean, RealType sd, RealType x)
@@ -311,6 +312,63 @@ void test_spots(RealType)
     BOOST_MATH_CHECK_THROW(quantile(normal_distribution<RealType>(0, 1), 2), std::domain_error);
 } // template <class RealType>void test_spots(RealType)
 
+template <class RealType>
+void test_ranges(RealType)
+{
+   // The range versions of pdf, cdf and quantile should agree with the scalar
+   // versions to within a few epsilon (float and double use the block kernels,
+   // which always evaluate at double precision):
+   RealType tolerance = (std::max)(boost::math::tools::epsilon<RealType>(), static_cast<RealType>(boost::math::tools::epsilon<double>())) * 8;
+   normal_distribution<RealType> dist(static_cast<RealType>(1.5), static_cast<RealType>(2.25));
+   std::vector<RealType> x, p, result(41);
+   for(int i = -20; i <= 20; ++i)
+   {
+      x.push_back(dist.mean() + dist.standard_deviation() * i / 2);
+      p.push_back(static_cast<RealType>(i + 21) / 42);
+   }
+   BOOST_CHECK(pdf(dist, x.begin(), x.end(), result.begin()) == result.end());
+   for(unsigned i = 0; i < x.size(); ++i)
+      BOOST_CHECK_CLOSE_FRACTION(result[i], pdf(dist, x[i]), tolerance);
+   cdf(dist, x.begin(), x.end(), result.begin());
+   for(unsigned i = 0; i < x.size(); ++i)
+   {
+      // The scalar float version rounds (x - mean) / sd to float before calling erfc,
+      // so allow for the conditioning of erfc in the tails:
+      RealType z = (x[i] - dist.mean()) / dist.standard_deviation();
+      BOOST_CHECK_CLOSE_FRACTION(result[i], cdf(dist, x[i]), tolerance * (1 + z * z));
+   }
+   quantile(dist, p.begin(), p.end(), result.begin());
+   for(unsigned i = 0; i < p.size(); ++i)
+   {
+      // Absolute error near the mean, where adding the location cancels:
+      RealType expected = quantile(dist, p[i]);
+      BOOST_CHECK_SMALL(static_cast<RealType>(result[i] - expected), static_cast<RealType>(tolerance * (fabs(expected) + dist.mean())));
+   }
+   // Limits and errors are handled exactly as the scalar versions do:
+   p[0] = 0;
+   p[1] = 1;
+   BOOST_MATH_CHECK_THROW(quantile(dist, p.begin(), p.begin() + 1, result.begin()), std::overflow_error);
+   BOOST_MATH_CHECK_THROW(quantile(dist, p.begin() + 1, p.begin() + 2, result.begin()), std::overflow_error);
+   p[1] = 2;
+   BOOST_MATH_CHECK_THROW(quantile(dist, p.begin() + 1, p.begin() + 2, result.begin()), std::domain_error);
+   if(std::numeric_limits<RealType>::has_infinity)
+   {
+      x[0] = -std::numeric_limits<RealType>::infinity();
+      x[1] = std::numeric_limits<RealType>::infinity();
+      cdf(dist, x.begin(), x.begin() + 2, result.begin());
+      BOOST_CHECK_EQUAL(result[0], 0);
+      BOOST_CHECK_EQUAL(result[1], 1);
+      pdf(dist, x.begin(), x.begin() + 2, result.begin());
+      BOOST_CHECK_EQUAL(result[0], 0);
+      BOOST_CHECK_EQUAL(result[1], 0);
+   }
+   if(std::numeric_limits<RealType>::has_quiet_NaN)
+   {
+      x[0] = std::numeric_limits<RealType>::quiet_NaN();
+      BOOST_MATH_CHECK_THROW(cdf(dist, x.begin(), x.begin() + 1, result.begin()), std::domain_error);
+   }
+} // template <class RealType>void test_ranges(RealType)
+
 BOOST_AUTO_TEST_CASE( test_main )
 {
     // Check that can generate normal distribution using the two convenience methods:
@@ -327,10 +385,14 @@ BOOST_AUTO_TEST_CASE( test_main )
    // (Parameter value, arbitrarily zero, only communicates the floating point type).
   test_spots(0.0F); // Test float. OK at decdigits = 0 tolerance = 0.0001 %
   test_spots(0.0); // Test double. OK at decdigits 7, tolerance = 1e07 %
+  test_ranges(0.0F);
+  test_ranges(0.0);
 #ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
   test_spots(0.0L); // Test long double.
+  test_ranges(0.0L);
 #if !BOOST_WORKAROUND(BOOST_BORLANDC, BOOST_TESTED_AT(0x0582))
   test_spots(boost::math::concepts::real_concept(0.)); // Test real concept.
+  test_ranges(boost::math::concepts::real_concept(0.));
 #endif
 #else
    std::cout << "<note>The long double tests have been disabled on this platform "
@@ -0,0 +1,207 @@
+/*
+ * Copyright 2020 Boost.Math contributors
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <array>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <vector>
+#include <boost/math/quadrature/gauss.hpp>
+#include <boost/math/quadrature/gauss_kronrod.hpp>
+#include <boost/math/quadrature/tanh_sinh.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::math::quadrature::gauss;
+using boost::math::quadrature::gauss_kronrod;
+using boost::math::quadrature::gauss_kronrod_statistics;
+using boost::math::quadrature::tanh_sinh;
+using boost::math::constants::pi;
+using boost::multiprecision::cpp_bin_float_50;
+
+// The moments of a kernel which is expensive to evaluate, computed together:
+template<class Real, std::size_t M>
+std::array<Real, M> moments(Real x, std::size_t* calls = nullptr)
+{
+    using std::exp;
+    if (calls)
+    {
+        ++*calls;
+    }
+    std::array<Real, M> result;
+    Real kernel = exp(-x * x);
+    Real p = 1;
+    for (std::size_t i = 0; i < M; ++i)
+    {
+        result[i] = kernel * p;
+        p *= x;
+    }
+    return result;
+}
+
+template<class Real>
+void test_gauss()
+{
+    // Non-adaptive rules perform the same arithmetic on each component as on a scalar integrand, up to
+    // the contraction of multiply-adds, which the compiler may do differently in the two loops; so the
+    // results agree to a few ulps of the L1 norm, which bounds the rounding errors of either sum:
+    auto f = [](Real x) { return moments<Real, 6>(x); };
+    Real L1;
+    std::array<Real, 6> Q = gauss<Real, 20>::integrate(f, Real(-1), Real(2), &L1);
+    for (std::size_t i = 0; i < Q.size(); ++i)
+    {
+        auto g = [i](Real x)->Real { return moments<Real, 6>(x)[i]; };
+        Real expected = gauss<Real, 20>::integrate(g, Real(-1), Real(2));
+        CHECK_ABSOLUTE_ERROR(expected, Q[i], 4*std::numeric_limits<Real>::epsilon()*L1);
+    }
+    // L1 is the integral of the largest component, which here is the first or the last:
+    CHECK_LE(Q[0], L1);
+    CHECK_LE(L1, Q[0] + Q[5] + Q[4]);
+
+    std::array<Real, 6> Q2 = gauss<Real, 20>::integrate(f, Real(2), Real(-1));
+    for (std::size_t i = 0; i < Q.size(); ++i)
+    {
+        CHECK_EQUAL(-Q[i], Q2[i]);
+    }
+
+    // And over infinite ranges:
+    Real inf = std::numeric_limits<Real>::infinity();
+    Q = gauss<Real, 30>::integrate(f, Real(1), inf, &L1);
+    for (std::size_t i = 0; i < Q.size(); ++i)
+    {
+        auto g = [i](Real x)->Real { return moments<Real, 6>(x)[i]; };
+        Real expected = gauss<Real, 30>::integrate(g, Real(1), inf);
+        CHECK_ABSOLUTE_ERROR(expected, Q[i], 4*std::numeric_limits<Real>::epsilon()*L1);
+    }
+}
+
+template<class Real>
+void test_gauss_kronrod()
+{
+    using std::abs;
+    using std::sqrt;
+    Real tol = boost::math::tools::root_epsilon<Real>();
+    Real inf = std::numeric_limits<Real>::infinity();
+    std::size_t calls = 0;
+    auto f = [&calls](Real x) { return moments<Real, 5>(x, &calls); };
+    Real error, L1;
+    gauss_kronrod_statistics stats;
+    std::array<Real, 5> Q = gauss_kronrod<Real, 15>::integrate(f, Real(0), inf, 15, tol, &error, &L1, &stats);
+    // The integrand is evaluated once for all of the components:
+    CHECK_EQUAL(calls, stats.evaluations);
+    // The half moments are Gamma((i+1)/2)/2:
+    std::array<Real, 5> expected = { { sqrt(pi<Real>()) / 2, Real(1) / 2, sqrt(pi<Real>()) / 4, Real(1) / 2, 3 * sqrt(pi<Real>()) / 8 } };
+    for (std::size_t i = 0; i < Q.size(); ++i)
+    {
+        CHECK_ABSOLUTE_ERROR(expected[i], Q[i], 10 * tol);
+    }
+    // The error estimate is in the maximum norm:
+    CHECK_LE(error, Q[0] * tol);
+
+    calls = 0;
+    Q = gauss_kronrod<Real, 31>::integrate_global(f, Real(0), inf, 1000, tol, &error, &L1, &stats);
+    CHECK_EQUAL(calls, stats.evaluations);
+    for (std::size_t i = 0; i < Q.size(); ++i)
+    {
+        CHECK_ABSOLUTE_ERROR(expected[i], Q[i], 10 * tol);
+    }
+    CHECK_LE(error, Q[0] * tol);
+
+    // An empty range gives zeros:
+    Q = gauss_kronrod<Real, 15>::integrate(f, Real(1), Real(1));
+    for (std::size_t i = 0; i < Q.size(); ++i)
+    {
+        CHECK_EQUAL(Real(0), Q[i]);
+    }
+
+    // With max_depth = 0 the components are bit-identical to scalar integration:
+    Q = gauss_kronrod<Real, 15>::integrate(f, Real(-1), Real(1), 0);
+    for (std::size_t i = 0; i < Q.size(); ++i)
+    {
+        auto g = [i](Real x)->Real { return moments<Real, 5>(x)[i]; };
+        Real Qi = gauss_kronrod<Real, 15>::integrate(g, Real(-1), Real(1), 0);
+        CHECK_EQUAL(Qi, Q[i]);
+    }
+}
+
+template<class Real>
+void test_tanh_sinh()
+{
+    using std::sqrt;
+    using std::log;
+    using std::cos;
+    Real tol = boost::math::tools::root_epsilon<Real>();
+    tanh_sinh<Real> integrator;
+    // End point singularities in some components, but not others:
+    auto f = [](Real x) { std::array<Real, 3> r = { { 1 / sqrt(x), log(x), cos(x) } }; return r; };
+    Real error, L1;
+    std::size_t levels;
+    std::array<Real, 3> Q = integrator.integrate(f, Real(0), Real(1), tol, &error, &L1, &levels);
+    CHECK_ULP_CLOSE(Real(2), Q[0], 50);
+    CHECK_ULP_CLOSE(Real(-1), Q[1], 50);
+    CHECK_ULP_CLOSE(sin(Real(1)), Q[2], 50);
+    CHECK_LE(error, tol * L1);
+
+    // Over [-1, 1] with no limits given:
+    auto g = [](Real x) { std::array<Real, 2> r = { { sqrt(1 - x * x), x * x } }; return r; };
+    std::array<Real, 2> Q2 = integrator.integrate(g, tol);
+    CHECK_ULP_CLOSE(pi<Real>() / 2, Q2[0], 50);
+    CHECK_ULP_CLOSE(Real(2) / 3, Q2[1], 50);
+}
+
+void test_other_containers()
+{
+    // Dynamically sized vectors:
+    std::size_t n = 50;
+    auto f = [n](double x)
+    {
+        std::vector<double> r(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            r[i] = std::cos(i * x);
+        }
+        return r;
+    };
+    std::vector<double> Q = gauss_kronrod<double, 61>::integrate(f, 0.0, pi<double>() / 2, 20, 1e-12);
+    CHECK_EQUAL(n, Q.size());
+    CHECK_ULP_CLOSE(pi<double>() / 2, Q[0], 10);
+    for (std::size_t i = 1; i < n; ++i)
+    {
+        CHECK_ABSOLUTE_ERROR(std::sin(i * pi<double>() / 2) / i, Q[i], 1e-12);
+    }
+
+    // Complex components:
+    auto g = [](double x)
+    {
+        std::array<std::complex<double>, 2> r = { { std::exp(std::complex<double>(0, x)), std::complex<double>(x, -x) } };
+        return r;
+    };
+    std::array<std::complex<double>, 2> Qc = gauss<double, 20>::integrate(g, 0.0, pi<double>());
+    CHECK_ABSOLUTE_ERROR(0.0, Qc[0].real(), 1e-14);
+    CHECK_ULP_CLOSE(2.0, Qc[0].imag(), 10);
+    CHECK_ULP_CLOSE(pi<double>() * pi<double>() / 2, Qc[1].real(), 10);
+    CHECK_ULP_CLOSE(-pi<double>() * pi<double>() / 2, Qc[1].imag(), 10);
+}
+
+int main()
+{
+    test_gauss<float>();
+    test_gauss<double>();
+    test_gauss<long double>();
+    test_gauss<cpp_bin_float_50>();
+    test_gauss_kronrod<float>();
+    test_gauss_kronrod<double>();
+    test_gauss_kronrod<long double>();
+    test_gauss_kronrod<cpp_bin_float_50>();
+    test_tanh_sinh<float>();
+    test_tanh_sinh<double>();
+    test_tanh_sinh<long double>();
+    test_tanh_sinh<cpp_bin_float_50>();
+    test_other_containers();
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,224 @@
+/*
+ * Copyright Boost.Math contributors, 2020
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/quadrature/vegas_monte_carlo.hpp>
+
+using std::vector;
+using std::pair;
+using boost::math::constants::pi;
+using boost::math::quadrature::vegas_monte_carlo;
+
+template<class Real>
+void test_peaked_integrand()
+{
+    using std::exp;
+    using std::abs;
+    // A narrow Gaussian, normalized to have integral 1 over the unit hypercube, which defeats naive Monte Carlo:
+    auto f = [](vector<Real> const & x)->Real
+    {
+        const Real sigma = Real(1)/Real(100);
+        Real r = 0;
+        for (std::size_t j = 0; j < x.size(); ++j)
+        {
+            r += (x[j] - Real(1)/Real(2))*(x[j] - Real(1)/Real(2));
+        }
+        Real normalization = 2*pi<Real>()*sigma*sigma;
+        return exp(-r/(2*sigma*sigma))/(normalization*normalization);
+    };
+    vector<pair<Real, Real>> bounds(4, pair<Real, Real>(0, 1));
+    Real error_goal = Real(1)/Real(1000);
+    vegas_monte_carlo<Real, decltype(f)> mc(f, bounds, error_goal, false, 2, 7);
+    auto task = mc.integrate();
+    Real Q = task.get();
+    CHECK_LE(mc.current_error_estimate(), error_goal);
+    CHECK_LE(abs(Q - 1), 5*error_goal);
+    CHECK_EQUAL(Q, mc.current_estimate());
+    CHECK_EQUAL(Real(1), mc.progress());
+    // The estimates of the iterations should be consistent:
+    CHECK_LE(mc.chi_squared_per_dof(), Real(5));
+    // Naive Monte Carlo needs ~10^9 calls for this error:
+    CHECK_LE(mc.calls(), uint64_t(5000000));
+
+    // The result depends upon the seed, but not on the number of threads:
+    vegas_monte_carlo<Real, decltype(f)> mc1(f, bounds, error_goal, false, 1, 7);
+    task = mc1.integrate();
+    CHECK_EQUAL(Q, task.get());
+    CHECK_EQUAL(mc.calls(), mc1.calls());
+}
+
+template<class Real>
+void test_product()
+{
+    // Separable integrands are what VEGAS is designed for; each factor has integral 1 on [0, 1]:
+    auto f = [](vector<Real> const & x)->Real
+    {
+        Real y = 1;
+        for (std::size_t j = 0; j < x.size(); ++j)
+        {
+            y *= 3*x[j]*x[j];
+        }
+        return y;
+    };
+    vector<pair<Real, Real>> bounds(6, pair<Real, Real>(0, 1));
+    Real error_goal = Real(1)/Real(1000);
+    vegas_monte_carlo<Real, decltype(f)> mc(f, bounds, error_goal, true, 3, 11, 20000, 30);
+    auto task = mc.integrate();
+    Real Q = task.get();
+    CHECK_ABSOLUTE_ERROR(Real(1), Q, 5*error_goal);
+}
+
+template<class Real>
+void test_infinite_bounds()
+{
+    using std::exp;
+    auto f = [](vector<Real> const & x)->Real
+    {
+        return exp(-x[0]*x[0] - x[1]*x[1] - x[2]);
+    };
+    Real inf = std::numeric_limits<Real>::infinity();
+    vector<pair<Real, Real>> bounds{{-inf, inf}, {-inf, Real(0)}, {Real(0), inf}};
+    Real error_goal = Real(1)/Real(1000);
+    vegas_monte_carlo<Real, decltype(f)> mc(f, bounds, error_goal, true, 2, 99);
+    auto task = mc.integrate();
+    Real Q = task.get();
+    CHECK_ABSOLUTE_ERROR(pi<Real>()/2, Q, 5*error_goal);
+}
+
+template<class Real>
+void test_cancel_and_restart()
+{
+    auto f = [](vector<Real> const & x)->Real
+    {
+        return x[0]*x[1]*x[2]*x[3];
+    };
+    vector<pair<Real, Real>> bounds(4, pair<Real, Real>(0, 1));
+    vegas_monte_carlo<Real, decltype(f)> mc(f, bounds, Real(0), false, 2, 17);
+    auto task = mc.integrate();
+    mc.cancel();
+    Real y = task.get();
+    CHECK_LE(y, Real(1));
+    CHECK_LE(Real(0), y);
+
+    mc.update_target_error(Real(1)/Real(10000));
+    task = mc.integrate();
+    y = task.get();
+    CHECK_ABSOLUTE_ERROR(Real(1)/Real(16), y, Real(5)/Real(10000));
+    CHECK_EQUAL(std::chrono::duration<Real>(0).count(), mc.estimated_time_to_completion().count());
+}
+
+template<class Real>
+void test_chi_squared_before_integrate()
+{
+    using std::isnan;
+    auto f = [](vector<Real> const & x)->Real
+    {
+        return x[0]*x[1];
+    };
+    vector<pair<Real, Real>> bounds(2, pair<Real, Real>(0, 1));
+    vegas_monte_carlo<Real, decltype(f)> mc(f, bounds, Real(1)/Real(1000), false, 1, 5);
+    // There is no chi-squared until two iterations have been combined:
+    CHECK_EQUAL(true, isnan(mc.chi_squared_per_dof()));
+}
+
+template<class Real>
+void test_constant_integrand()
+{
+    using std::isfinite;
+    auto f = [](vector<Real> const &)->Real
+    {
+        return Real(15)/Real(2);
+    };
+    vector<pair<Real, Real>> bounds{{Real(0), Real(2)}, {Real(0), Real(1)}};
+    Real error_goal = Real(1)/Real(100);
+    // With a single bin the density stays uniform, so every sample is the same and the variance of each iteration
+    // is zero; it must not come out negative from the difference of two large numbers and swamp the sums:
+    vegas_monte_carlo<Real, decltype(f)> mc(f, bounds, error_goal, false, 2, 3, 5000, 1);
+    auto task = mc.integrate();
+    Real Q = task.get();
+    CHECK_ULP_CLOSE(Real(15), Q, 10);
+    CHECK_EQUAL(Real(0), mc.current_error_estimate());
+    CHECK_EQUAL(Real(1), mc.progress());
+
+    // With many bins the density fluctuates, so the samples are merely nearly equal:
+    vegas_monte_carlo<Real, decltype(f)> mc1(f, bounds, error_goal, false, 2, 3, 5000, 20);
+    task = mc1.integrate();
+    Q = task.get();
+    CHECK_ABSOLUTE_ERROR(Real(15), Q, 5*error_goal);
+    CHECK_EQUAL(true, isfinite(mc1.current_error_estimate()));
+    CHECK_LE(Real(0), mc1.current_error_estimate());
+    CHECK_LE(mc1.current_error_estimate(), error_goal);
+}
+
+void test_exceptions()
+{
+    auto f = [](vector<double> const & x)->double
+    {
+        if (x[0] > 0.75)
+        {
+            throw std::domain_error("You have done something wrong.\n");
+        }
+        return 1;
+    };
+    vector<pair<double, double>> bounds{{0.0, 1.0}, {0.0, 1.0}};
+    vegas_monte_carlo<double, decltype(f)> mc(f, bounds, 1e-12, false, 2);
+    bool caught = false;
+    try
+    {
+        mc.integrate().get();
+    }
+    catch (std::domain_error const &)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(true, caught);
+
+    // Non-finite values are reported with where they happened:
+    auto g = [](vector<double> const & x)->double { return 1/(x[0] - x[0]); };
+    vegas_monte_carlo<double, decltype(g)> mc2(g, bounds, 1e-3, false, 1);
+    caught = false;
+    try
+    {
+        mc2.integrate().get();
+    }
+    catch (std::domain_error const &)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(true, caught);
+
+    vector<pair<double, double>> backwards{{1.0, 0.0}};
+    caught = false;
+    try
+    {
+        vegas_monte_carlo<double, decltype(g)> mc3(g, backwards, 1e-3);
+    }
+    catch (std::domain_error const &)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(true, caught);
+}
+
+int main()
+{
+    test_peaked_integrand<double>();
+    test_peaked_integrand<long double>();
+    test_product<double>();
+    test_infinite_bounds<double>();
+    test_cancel_and_restart<double>();
+    test_chi_squared_before_integrate<double>();
+    test_constant_integrand<double>();
+    test_constant_integrand<long double>();
+    test_exceptions();
+    return boost::math::test::report_errors();
+}
@@ -126,6 +126,57 @@ void test_bump()
     }
 }
 
+template<class Real>
+void test_batch()
+{
+    using std::abs;
+    using std::log;
+    std::mt19937_64 gen(5);
+    std::uniform_real_distribution<Real> dis(-1, 1);
+    // Noise, so that no sample is negligible:
+    std::size_t n = 1000;
+    std::vector<Real> v(n);
+    for (auto & y : v)
+    {
+        y = dis(gen);
+    }
+    Real t0 = -3;
+    Real h = Real(1)/Real(7);
+    auto ws = whittaker_shannon<std::vector<Real>>(std::move(v), t0, h);
+    // Enough points that the far sums are interpolated, including the samples, the ends, and some outside the range:
+    std::vector<Real> t(30000);
+    std::uniform_real_distribution<Real> tdis(t0 - 2*h, t0 + (n + 1)*h);
+    for (auto & s : t)
+    {
+        s = tdis(gen);
+    }
+    t[0] = t0;
+    t[1] = t0 + (n - 1)*h;
+    for (Real tol : {std::numeric_limits<Real>::epsilon(), Real(1e-5)})
+    {
+        std::vector<Real> y(t.size());
+        auto end = ws(t.begin(), t.end(), y.begin(), tol);
+        CHECK_EQUAL(true, end == y.end());
+        for (std::size_t i = 0; i < t.size(); ++i)
+        {
+            // Each term is in error by tol relative to its size, and there are about log(n) units of them:
+            Real expected = ws(t[i]);
+            if (!CHECK_ABSOLUTE_ERROR(expected, y[i], 64*tol*log(Real(n))))
+            {
+                std::cerr << "  Problem occurred at abscissa " << t[i] << " with tolerance " << tol << "\n";
+                break;
+            }
+        }
+        CHECK_EQUAL(ws[0], y[0]);
+    }
+    // With few points, the sums are done directly:
+    std::vector<Real> y(5);
+    ws(t.begin(), t.begin() + 5, y.begin());
+    for (std::size_t i = 0; i < 5; ++i)
+    {
+        CHECK_EQUAL(ws(t[i]), y[i]);
+    }
+}
 
 int main()
 {
@@ -138,5 +189,9 @@ int main()
 
     test_trivial<float>();
     test_trivial<double>();
+
+    test_batch<float>();
+    test_batch<double>();
+    test_batch<long double>();
     return boost::math::test::report_errors();
 }